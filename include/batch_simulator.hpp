@@ -0,0 +1,147 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the BatchSimulator class, which plays
+ * many headless games of one level on several threads and reports how
+ * they went.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "random_generator.hpp"
+#include "distance_field.hpp"
+#include "level_topology.hpp"
+#include "room_overlay.hpp"
+#include "game_session.hpp"
+#include "simulation_report.hpp"
+
+// The ways in which a simulated Player chooses its Moves
+enum class PlayerPolicy
+{
+  kRandomWalk,    // A random open direction
+  kWallFollower,  // The first open direction of right, ahead, left, back
+  kShortestPath,  // Straight to the Treasure, then straight to the exit
+};
+
+// A BatchSimulator plays games of a level with GameSessions, each on a
+// RoomOverlay of one shared LevelTopology, and counts the wins, losses,
+// bullets fired, and Rooms where Players died. The exit is open to a
+// Player only while it holds the Treasure. In an encounter, every policy
+// shoots if it has a bullet and holds fire otherwise.
+//
+// Every game is played with its own random stream, derived from the
+// simulator's seed and the game's index, so the report depends only on
+// the seed and never on the number of threads or which thread played
+// which game.
+//
+// Each thread starts with an equal share of the games, and takes them
+// kChunkGames at a time. A thread which runs out steals the second half
+// of another thread's remaining games. The shares are packed ranges which
+// are only changed by compare-and-swap, and each thread counts its games
+// in a SimulationReport of its own which is merged once every thread has
+// finished, so no lock is taken while games are played.
+class BatchSimulator
+{
+  public:
+
+    // The number of games which a thread takes from its own share at once
+    static constexpr size_t kChunkGames = 16;
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // A thread count of 0 uses one thread per hardware thread.
+      BatchSimulator( const PlayerPolicy policy,
+                      const uint64_t seed,
+                      const size_t thread_count = 0 );
+
+    // SIMULATION:
+
+      // This method plays game_count games of the Labyrinth as it is now,
+      // each with the given number of bullets and at most max_actions
+      // actions, and returns the report. The report is valid until the
+      // next simulation.
+      // An exception is thrown if:
+      //   The policy is not a valid PlayerPolicy (invalid_argument)
+      //   game_count is 2^32 or more (domain_error)
+      //   The policy is kShortestPath and the Labyrinth has no exit or
+      //     no Treasure (logic_error)
+      //   There is not enough memory for the level, the deaths counted
+      //     per Room by each thread, or the report (bad_alloc)
+      //   A thread cannot be started (system_error)
+      const SimulationReport& Run( const Labyrinth& l,
+                                   const size_t game_count,
+                                   const uint32_t bullets = 1,
+                                   const size_t max_actions = 100000 );
+
+    // This method returns the number of threads used by Run().
+    size_t ThreadCount() const;
+
+  private:
+
+    // The games left in one thread's share, as [begin, end) packed into
+    // the low and high 32 bits. The padding keeps each share in a cache
+    // line of its own.
+    struct GameShare
+    {
+      std::atomic<uint64_t> games;
+      char padding[64 - sizeof(std::atomic<uint64_t>)];
+    };
+
+    // The distance fields which guide kShortestPath, stored row-major
+    struct Guide
+    {
+      const uint32_t* to_treasure;
+      const uint32_t* to_exit;
+    };
+
+    const PlayerPolicy policy_;
+    const size_t thread_count_;
+    RandomGenerator rng_;
+    SimulationReport report_;
+
+    // This private method takes the next games for the given thread into
+    // [begin, end): from its own share if any are left, and otherwise
+    // from another thread's.
+    // Returns false if every share is empty.
+    static bool TakeGames( GameShare* const shares,
+                           const size_t thread,
+                           const size_t thread_count,
+                           uint64_t& begin,
+                           uint64_t& end );
+
+    // This private method plays one game on the overlay and counts it in
+    // the tally. The deaths in each Room are counted in death_counts, in
+    // row-major order. scratch is used by kShortestPath after the Treasure
+    // is dropped.
+    void PlayGame( RoomOverlay& overlay,
+                   const Guide& guide,
+                   DistanceField& scratch,
+                   RandomGenerator rng,
+                   const uint32_t bullets,
+                   const size_t max_actions,
+                   SimulationReport& tally,
+                   std::vector<uint64_t>& death_counts ) const;
+
+    // This private method returns the direction of the next Move of the
+    // game by the policy, or kNone if there is no open direction. facing
+    // is the direction of the last Move, and to_treasure guides
+    // kShortestPath to the Treasure.
+    Direction ChooseMove( const GameSession& s,
+                          const LevelTopology& topology,
+                          const uint32_t* const to_treasure,
+                          const uint32_t* const to_exit,
+                          const Direction facing,
+                          RandomGenerator& rng ) const;
+};
@@ -0,0 +1,152 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the CommandJournal class, an append-only
+ * record of the commands which changed a game, in a compact binary
+ * format.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "coordinate.hpp"
+
+// The commands which change a game: the setup and play methods of the
+// Labyrinth, and the actions of the GameSession. The comment after each
+// command lists the parts of a JournalEntry which it uses.
+enum class JournalCommand
+{
+  kConnectRooms,   // room, and the direction of the other Room
+  kSetSpawn1,      // room
+  kSetSpawn2,      // room
+  kSetExit,        // room and direction
+  kSetInhabitant,  // room and inhabitant
+  kSetItem,        // room and item
+  kAttackEnemy,    // room
+  kTakeItem,       // room
+  kDropTreasure,   // room
+  kMove,           // direction
+  kShoot,
+  kHoldFire,
+  kRestart,
+};
+
+// One command of a CommandJournal. The parts which the command does not
+// use are left as they are.
+struct JournalEntry
+{
+  JournalCommand command = JournalCommand::kRestart;
+  Coordinate room;
+  Direction direction = Direction::kNone;
+  Inhabitant inhabitant = Inhabitant::kNone;
+  Item item = Item::kNone;
+};
+
+// The commands are encoded one after another:
+//   One byte with the JournalCommand in the low 4 bits, and the
+//     Direction, Inhabitant, or Item of the command in the high 4 bits
+//   The x and then the y of the Room, if the command uses one, each as
+//     an unsigned LEB128 number (7 bits per byte, low bits first)
+// so a Move takes one byte, and a command on a Room of a Labyrinth up to
+// 128 Rooms wide takes three.
+//
+// The stream format is a header followed by the commands, to the end of
+// the stream, so a journal file can be appended to as the game goes:
+//   Header: the 8 bytes "LABYJRN1", then x_size, y_size, and bullets,
+//           each a 64-bit little-endian unsigned integer
+//
+// A CommandJournal records the game of one Labyrinth of a given size,
+// whose Player is given a number of bullets; a JournaledGame records into
+// it, and a JournalReplayer rebuilds the game from it.
+class CommandJournal
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // This constructor creates an empty journal of a game of a
+      // Labyrinth of the given size, whose Player is given the given
+      // number of bullets.
+      // An exception is thrown if:
+      //   A size of 0 is given (domain_error)
+      CommandJournal( const size_t x_size,
+                      const size_t y_size,
+                      const uint32_t bullets );
+
+      // Parameterized constructor
+      // This constructor reads a journal from a stream, to its end.
+      // An exception is thrown if:
+      //   The header is missing or invalid (runtime_error)
+      //   A command is damaged, or the stream ends in the middle of one
+      //     (runtime_error)
+      //   There is not enough memory for the commands (bad_alloc)
+      explicit CommandJournal( std::istream& in );
+
+    // COMMANDS:
+
+      // This method appends a command to the journal.
+      // An exception is thrown if:
+      //   The command is not a valid JournalCommand, or its Direction,
+      //     Inhabitant, or Item is not a valid enumerator
+      //     (invalid_argument)
+      //   The Room is outside the Labyrinth (domain_error)
+      //   There is not enough memory for the command (bad_alloc)
+      void Append( const JournalEntry& entry );
+
+      // This method returns the command which begins at the given byte
+      // offset, and advances the offset to the next command. The first
+      // command begins at offset 0.
+      // An exception is thrown if:
+      //   The offset is at or beyond the end of the commands
+      //     (out_of_range)
+      //   The command is damaged (runtime_error)
+      JournalEntry Decode( size_t& offset ) const;
+
+      // This method returns the number of commands.
+      size_t Size() const;
+
+      // This method returns the number of bytes of encoded commands.
+      size_t ByteSize() const;
+
+    // GAME:
+
+      // These methods return the size of the Labyrinth of the game.
+      size_t XSize() const;
+      size_t YSize() const;
+
+      // This method returns the bullets which the Player is given.
+      uint32_t Bullets() const;
+
+    // STREAMS:
+
+      // This method writes the header and every command to a stream.
+      // An exception is thrown if:
+      //   The stream cannot be written (runtime_error)
+      void Write( std::ostream& out ) const;
+
+      // This method writes the commands from the given byte offset to a
+      // stream which already holds the journal up to that offset.
+      // An exception is thrown if:
+      //   The offset is beyond the end of the commands (out_of_range)
+      //   The stream cannot be written (runtime_error)
+      void WriteFrom( std::ostream& out, const size_t offset ) const;
+
+  private:
+
+    size_t x_size_;
+    size_t y_size_;
+    uint32_t bullets_;
+
+    size_t size_ = 0;
+    std::vector<uint8_t> bytes_;
+};
@@ -0,0 +1,163 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the ConcurrentLabyrinth class, a copy of
+ * a Labyrinth whose Rooms and exit may be read and changed by several
+ * threads at once.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "room_properties.hpp"
+#include "room_cell.hpp"
+#include "coordinate.hpp"
+#include "wall_grid.hpp"
+#include "labyrinth_status.hpp"
+#include "labyrinth.hpp"
+
+// A ConcurrentLabyrinth is a Labyrinth which several game threads can
+// share. Its Walls and spawns are copied from a Labyrinth and never
+// change; every other part of it is atomic:
+//   Each Room is a RoomCell in an atomic byte. A Room is read with one
+//   load, so readers never wait, and changed with a compare-and-swap
+//   which only succeeds if the Room has not changed since it was read.
+//   Two threads can therefore never both kill the same Minotaur or take
+//   the same Item: exactly one succeeds, and the other sees the result.
+//   The exit is packed into one atomic word, so it is set at most once
+//   and is never seen half set.
+//   Whether the Treasure is in a Room is an atomic flag. It is claimed
+//   by a compare-and-swap before the Treasure is dropped, so at most one
+//   Treasure is ever dropped; it is cleared just after the Treasure is
+//   taken, and a drop in between fails with kTreasureAlreadySet.
+//
+// Taking and attacking return what was taken or attacked, because the
+// Room may change between a caller reading it and changing it.
+class ConcurrentLabyrinth
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // This constructor copies the Labyrinth as it is now.
+      // An exception is thrown if:
+      //   There is not enough memory for the copy (bad_alloc)
+      explicit ConcurrentLabyrinth( const Labyrinth& l );
+
+    // SIZE:
+
+      // These methods return the number of Rooms along each axis.
+      size_t XSize() const;
+      size_t YSize() const;
+
+    // SPECIAL ROOMS AND WALLS:
+
+      // These methods return the spawn Rooms of the Players.
+      Coordinate Spawn1() const;
+      Coordinate Spawn2() const;
+
+      // This method returns true if the exit has been set, and false
+      // otherwise.
+      bool HasExit() const;
+
+      // This method returns the Room which has the exit.
+      // An exception is thrown if:
+      //   The exit has not been set (logic_error)
+      Coordinate ExitRoom() const;
+
+      // This method returns true if a Room holds the Treasure, and false
+      // otherwise.
+      bool HasTreasure() const;
+
+    // PLAY:
+
+      // This method returns the current Inhabitant of the Room.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      Inhabitant GetInhabitant( const Coordinate rm ) const;
+
+      // This method returns the current Item in the given Room, but does
+      // not change it.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      Item ItemAt( const Coordinate rm ) const;
+
+    // NON-THROWING:
+    //
+    // The ConcurrentLabyrinth is not modified upon failure.
+
+      // This method sets the exit of the Labyrinth on a Wall. If several
+      // threads set the exit at once, exactly one succeeds.
+      // Returns kOutOfBounds, kInvalidDirection, kNotAWall, or
+      // kExitAlreadySet upon failure.
+      LabyrinthStatus TrySetExit( const Coordinate rm, const Direction d );
+
+      // This method attacks the Inhabitant of the Room, and sets the
+      // resultant Inhabitant. The value is the Inhabitant attacked.
+      // Returns kOutOfBounds or kNoEnemy upon failure.
+      LabyrinthResult<Inhabitant> TryAttackEnemy( const Coordinate rm );
+
+      // This method takes the Item from the Room. The value is the Item
+      // taken.
+      // Returns kOutOfBounds or kNoItem upon failure.
+      LabyrinthResult<Item> TryTakeItem( const Coordinate rm );
+
+      // This method drops the Treasure in the given Room, replacing any
+      // Item there, as Labyrinth::TryDropTreasure() does.
+      // Returns kOutOfBounds or kTreasureAlreadySet upon failure.
+      LabyrinthStatus TryDropTreasure( const Coordinate rm );
+
+      // This method returns the type of RoomBorder in the given direction.
+      // Returns kOutOfBounds or kInvalidDirection upon failure.
+      LabyrinthResult<RoomBorder>
+        TryDirectionCheck( const Coordinate rm, const Direction d ) const;
+
+    // UNCHECKED:
+    //
+    // These methods skip the bounds check, like those of the Labyrinth.
+
+      Inhabitant GetInhabitantUnchecked( const Coordinate rm ) const;
+
+      Item ItemAtUnchecked( const Coordinate rm ) const;
+
+      // Direction d must not be kNone.
+      RoomBorder DirectionCheckUnchecked( const Coordinate rm,
+                                          const Direction d ) const;
+
+      // Returns kNoEnemy upon failure.
+      LabyrinthResult<Inhabitant> AttackEnemyUnchecked( const Coordinate rm );
+
+      // Returns kNoItem upon failure.
+      LabyrinthResult<Item> TakeItemUnchecked( const Coordinate rm );
+
+  private:
+
+    const size_t x_size_;
+    const size_t y_size_;
+    WallGrid walls_;
+    std::unique_ptr<std::atomic<uint8_t>[]> rooms_;  // RoomCell bits
+
+    const Coordinate spawn_1_;
+    const Coordinate spawn_2_;
+
+    // The exit Room's row-major index, shifted left by 3, with the
+    // Direction in the low 3 bits; 0 if the exit has not been set
+    std::atomic<uint64_t> exit_;
+    std::atomic<bool> treasure_set_;
+
+    // This private method returns true if the Room is within the
+    // Labyrinth, and false otherwise.
+    bool WithinBounds( const Coordinate rm ) const;
+
+    // This private method returns the atomic byte of the Room.
+    // Bounds are not checked.
+    std::atomic<uint8_t>& CellAt( const Coordinate rm ) const;
+};
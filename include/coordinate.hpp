@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-01-01
+ * Last edited: 2026-10-18
  *
  * This C++ header file contains the implementation of a Coordinate struct
  * used by the Labyrinth and LabyrinthMap classes.
@@ -10,6 +10,10 @@
 
 #pragma once
 
+#include <cstddef>
+
+// Both axes use size_t so that Coordinates can address every Room of
+// a Labyrinth whose Room count fits in memory.
 struct Coordinate
 {
   size_t x;
@@ -30,6 +34,11 @@ struct Coordinate
     y = y_coordinate;
   }
 
+  // Copy constructor
+  // Defaulted so that Coordinate stays trivially copyable and is passed
+  // by value in registers.
+  Coordinate( const Coordinate& c ) = default;
+
   // Operator overload for ==
   bool operator==( const Coordinate& c ) const
   {
@@ -38,10 +47,5 @@ struct Coordinate
   }
 
   // Operator overload for =
-  Coordinate& operator=( const Coordinate& c )
-  {
-    x = c.x;
-    y = c.y;
-    return *this;
-  }
+  Coordinate& operator=( const Coordinate& c ) = default;
 };
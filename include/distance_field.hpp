@@ -0,0 +1,151 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the DistanceField class, which finds the
+ * number of steps from one or more source Rooms to every Room of a
+ * Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "packed_coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_view.hpp"
+#include "room_layout.hpp"
+
+// A DistanceField holds the distance of every Room of a Labyrinth from the
+// nearest of a set of source Rooms, counted in steps through broken Walls,
+// as found by a breadth-first search. The exit does not lead to a Room and
+// is never crossed.
+//
+// The distances are stored in one array of 32-bit numbers, in the order
+// given to the constructor. By default it is row-major, indexed like the
+// Rooms of the Labyrinth: the Room at (x, y) is found at index
+// (y * x_size + x). In Morton order the Rooms to the north and south of a
+// Room are usually as close to it as those to the east and west, which
+// keeps the search within fewer cache lines and pages in large
+// Labyrinths. The search queue of PackedCoordinates is kept between
+// searches, so a DistanceField which is reused for Labyrinths of the same
+// size or smaller does not allocate memory.
+class DistanceField
+{
+  public:
+
+    // The distance of a Room which cannot be reached from any source
+    static constexpr uint32_t kUnreachable = UINT32_MAX;
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // No distances are held until one of the Compute methods is called.
+      explicit DistanceField( const RoomOrder order = RoomOrder::kRowMajor );
+
+    // SEARCH:
+
+      // This method finds the distance of every Room from the given Room.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      //   The Labyrinth has 2^32 or more Rooms (domain_error)
+      //   There is not enough memory for the distances (bad_alloc)
+      void Compute( const LabyrinthView& l, const Coordinate source );
+
+      // This method finds the distance of every Room from the nearest of
+      // the given Rooms. A Room may be given more than once.
+      // An exception is thrown if:
+      //   No Room is given (invalid_argument)
+      //   A Room is outside the Labyrinth (domain_error)
+      //   The Labyrinth has 2^32 or more Rooms (domain_error)
+      //   There is not enough memory for the distances (bad_alloc)
+      void Compute( const LabyrinthView& l,
+                    const std::vector<Coordinate>& sources );
+
+      // This method finds the distance of every Room from the Room which
+      // has the exit.
+      // An exception is thrown if:
+      //   The exit has not been set (logic_error)
+      //   The Labyrinth has 2^32 or more Rooms (domain_error)
+      //   There is not enough memory for the distances (bad_alloc)
+      void ComputeFromExit( const LabyrinthView& l );
+
+      // This method finds the distance of every Room from the Room which
+      // has the Treasure.
+      // An exception is thrown if:
+      //   No Room has the Treasure (logic_error)
+      //   The Labyrinth has 2^32 or more Rooms (domain_error)
+      //   There is not enough memory for the distances (bad_alloc)
+      void ComputeFromTreasure( const LabyrinthView& l );
+
+    // RESULTS:
+
+      // This method returns the distance of the Room from the nearest
+      // source, or kUnreachable.
+      // An exception is thrown if:
+      //   Nothing has been computed (logic_error)
+      //   The Room is outside the searched Labyrinth (domain_error)
+      uint32_t DistanceTo( const Coordinate rm ) const;
+
+      // This method returns the array of distances, or nullptr if nothing
+      // has been computed. The array is valid until the next search. In
+      // row-major order it holds XSize() * YSize() numbers; in Morton
+      // order it is indexed like MortonLayout( XSize(), YSize() ), and its
+      // padding entries are kUnreachable.
+      const uint32_t* Distances() const;
+
+      // This method returns the order of the distances.
+      RoomOrder Order() const;
+
+      // This method returns the greatest distance of a reachable Room.
+      uint32_t MaxDistance() const;
+
+      // This method returns the number of Rooms which can be reached,
+      // including the sources.
+      size_t ReachableCount() const;
+
+      // These methods return the size of the searched Labyrinth, or 0 if
+      // nothing has been computed.
+      size_t XSize() const;
+      size_t YSize() const;
+
+  private:
+
+    const RoomOrder order_;
+    std::vector<uint32_t> distances_;
+    std::vector<PackedCoordinate> queue_;  // Reused between searches
+    size_t queue_end_ = 0;
+    size_t x_size_ = 0;
+    size_t y_size_ = 0;
+    uint32_t max_distance_ = 0;
+    size_t reachable_count_ = 0;
+
+    // This private method prepares the distances for a search of the
+    // Labyrinth, marking every Room as unreachable.
+    // An exception is thrown if:
+    //   The Labyrinth has 2^32 or more Rooms (domain_error)
+    //   There is not enough memory for the distances (bad_alloc)
+    void Reset( const LabyrinthView& l );
+
+    // This private method returns the index of the Room's distance.
+    // Bounds are not checked; the Room must be within the Labyrinth.
+    size_t IndexOf( const Coordinate rm ) const;
+
+    // This private method adds a source Room to the search queue.
+    // Bounds are not checked; the Room must be within the Labyrinth.
+    void AddSource( const Coordinate rm );
+
+    // This private method runs the breadth-first search from the queued
+    // sources, in the order of the distances.
+    void Search( const LabyrinthView& l );
+
+    // This private method runs the breadth-first search with the given
+    // layout of the distances.
+    template <typename Layout>
+    void Search( const LabyrinthView& l, const Layout& layout );
+};
@@ -0,0 +1,81 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the EllerGenerator class, which generates
+ * a maze one row at a time with Eller's algorithm.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "maze_stream.hpp"
+#include "random_generator.hpp"
+
+// An EllerGenerator generates a perfect maze one row at a time and hands
+// each completed row to a sink, without ever building a Labyrinth. Only
+// the set labels of the current row are kept, so memory use depends on the
+// x size alone and mazes far larger than memory can be written straight
+// to a file with a MazeStreamWriter.
+//
+// Rows are given in the bitmap layout of a WallGrid: WallGrid::WordsPerRow()
+// east Wall words and as many south Wall words, with the padding bits and
+// the Walls on the outside of the maze set.
+//
+// Two generators with the same size and seed produce the same sequence of
+// mazes.
+class EllerGenerator
+{
+  public:
+
+    // The sink is given the y coordinate of each row in order, and the
+    // row's east and south Wall words, which are only valid during the
+    // call.
+    using RowSink = std::function<void( const size_t y,
+                                        const uint64_t* const east,
+                                        const uint64_t* const south )>;
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    EllerGenerator( const size_t x_size,
+                    const size_t y_size,
+                    const uint64_t seed );
+
+    // This method generates a maze, giving each row to the sink.
+    // An exception is thrown if:
+    //   There is not enough memory for one row (bad_alloc)
+    //   The sink throws
+    void Generate( const RowSink& sink );
+
+    // This method generates a maze into a MazeStreamWriter of the same
+    // size which has not been written to yet.
+    // An exception is thrown if:
+    //   The writer is for a different size or has been written to
+    //     (invalid_argument)
+    //   There is not enough memory for one row (bad_alloc)
+    //   The writer throws
+    void Generate( MazeStreamWriter& writer );
+
+    // These methods return the size of the generated mazes.
+    size_t XSize() const;
+    size_t YSize() const;
+
+  private:
+
+    const size_t x_size_;
+    const size_t y_size_;
+    RandomGenerator rng_;
+
+    // Random bits not yet used by RandomBit()
+    uint64_t bits_ = 0;
+    size_t bits_left_ = 0;
+
+    // This private method returns a random bit.
+    bool RandomBit();
+};
@@ -0,0 +1,714 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the FixedLabyrinth class template, a
+ * Labyrinth whose size is fixed at compile time and whose Rooms and Walls
+ * are stored inline.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "room_properties.hpp"
+#include "room_cell.hpp"
+#include "coordinate.hpp"
+#include "wall_grid.hpp"
+#include "labyrinth_status.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_view.hpp"
+
+// A FixedLabyrinth<X, Y> behaves like a Labyrinth of X by Y Rooms, but
+// holds its Rooms and Wall bitmaps in std::arrays instead of on the heap,
+// so a small level can live on the stack or inside another object, and
+// its bounds and index math are constants which the compiler can fold
+// and unroll.
+//
+// The Walls use the bitmap layout of a WallGrid, and the Rooms the
+// row-major layout of a Labyrinth, so a FixedLabyrinth converts to a
+// LabyrinthView and is accepted by the same algorithms (DistanceField,
+// FloodFill, PathFinder, LandmarkIndex, and LevelValidator).
+//
+// The Rooms must number fewer than 2^32, the limit of the algorithms.
+template <size_t X, size_t Y>
+class FixedLabyrinth
+{
+  static_assert( X > 0 && Y > 0,
+                 "A FixedLabyrinth must have at least one Room." );
+  static_assert( X <= UINT32_MAX / Y,
+                 "A FixedLabyrinth must have fewer than 2^32 Rooms." );
+
+  public:
+
+    static constexpr size_t kRoomCount = X * Y;
+    static constexpr size_t kWordsPerRow = ( X + 63 ) / 64;
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Default constructor
+      // Every Wall exists initially, and every Room is empty.
+      FixedLabyrinth();
+
+      // Parameterized constructor
+      // This constructor copies the Walls, Rooms, spawns, and exit of a
+      // Labyrinth of the same size, e.g. one carved by a MazeGenerator.
+      // An exception is thrown if:
+      //   The Labyrinth is not X by Y Rooms (invalid_argument)
+      explicit FixedLabyrinth( const Labyrinth& l );
+
+    // SETUP:
+
+      // This method connects two Rooms by breaking the Wall between them.
+      // An exception is thrown if:
+      //   One or both Rooms are outside the Labyrinth (domain_error)
+      //   The Rooms are the same (logic_error)
+      //   The Rooms are not adjacent (logic_error)
+      //   The Rooms are already connected (logic_error)
+      //   The Wall between the Rooms is the exit (logic_error)
+      void ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 );
+
+      // These methods set the primary and secondary spawn Rooms.
+      // Spawns can be changed at any time.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      void SetSpawn1( const Coordinate rm );
+      void SetSpawn2( const Coordinate rm );
+
+      // This method sets the exit of the Labyrinth on a Wall.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      //   The Direction is invalid (kNone) (invalid_argument)
+      //   The Direction has another Room (invalid_argument)
+      //   The Exit has already been set (logic_error)
+      void SetExit( const Coordinate rm, const Direction d );
+
+      // This method places an Inhabitant in a Room.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      //   Inhabitant inh is a null Inhabitant (i.e. Inhabitant::kNone)
+      //     (invalid_argument)
+      //   The Inhabitant of the Room has already been set (logic_error)
+      void SetInhabitant( const Coordinate rm, const Inhabitant inh );
+
+      // This method places an Item in a Room.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      //   Item itm is a null Item (i.e. Item::kNone) (invalid_argument)
+      //   The Item of the Room has already been set (logic_error)
+      //   Item itm is a Treasure but the Treasure has already been placed
+      //     in another room (logic_error)
+      void SetItem( const Coordinate rm, const Item itm );
+
+    // PLAY:
+
+      // This method returns the current Inhabitant of the Room.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      Inhabitant GetInhabitant( const Coordinate rm ) const;
+
+      // This method returns the current Item in the given Room, but does
+      // not change it.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      Item ItemAt( const Coordinate rm ) const;
+
+      // This method returns the type of RoomBorder in the given direction.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      //   Direction d is kNone (invalid_argument)
+      RoomBorder DirectionCheck( const Coordinate rm,
+                                 const Direction d ) const;
+
+    // SIZE:
+
+      // These methods return the number of Rooms along each axis.
+      static constexpr size_t XSize();
+      static constexpr size_t YSize();
+
+    // SPECIAL ROOMS AND WALLS:
+
+      // These methods return the spawn Rooms of the Players.
+      Coordinate Spawn1() const;
+      Coordinate Spawn2() const;
+
+      // This method returns true if the exit has been set, and false
+      // otherwise.
+      bool HasExit() const;
+
+      // This method returns the Room which has the exit.
+      // An exception is thrown if:
+      //   The exit has not been set (logic_error)
+      Coordinate ExitRoom() const;
+
+      // This method returns a view of the Labyrinth for the algorithms
+      // which are shared with Labyrinth. The view is valid while the
+      // FixedLabyrinth exists.
+      operator LabyrinthView() const;
+
+    // NON-THROWING:
+
+      // Returns kOutOfBounds, kSameRoom, kNotAdjacent, kAlreadyConnected,
+      // or kExitInTheWay upon failure.
+      LabyrinthStatus TryConnectRooms( const Coordinate rm_1,
+                                       const Coordinate rm_2 );
+
+    // UNCHECKED:
+    //
+    // These methods skip the bounds check for Coordinates which are already
+    // known to be within the Labyrinth. Giving a Room outside the
+    // Labyrinth is undefined behaviour.
+
+      Inhabitant GetInhabitantUnchecked( const Coordinate rm ) const;
+
+      Item ItemAtUnchecked( const Coordinate rm ) const;
+
+      // Direction d must not be kNone.
+      RoomBorder DirectionCheckUnchecked( const Coordinate rm,
+                                          const Direction d ) const;
+
+  private:
+
+    std::array<RoomCell, kRoomCount> rooms_;
+    std::array<uint64_t, kWordsPerRow * Y> east_;
+    std::array<uint64_t, kWordsPerRow * Y> south_;
+
+    Coordinate spawn_1_;
+    Coordinate spawn_2_;
+    Coordinate exit_room_;
+    Direction exit_direction_ = Direction::kNone;
+    bool exit_set_ = false;
+    bool treasure_set_ = false;
+
+    // This private method returns the index of the Room at (x, y) in
+    // rooms_.
+    static constexpr size_t IndexOf( const size_t x, const size_t y );
+
+    // This private method returns true if the Room is within the bounds
+    // of the Labyrinth, and false otherwise.
+    static bool WithinBounds( const Coordinate rm );
+
+    // This private method returns the Direction from rm_1 to rm_2 if the
+    // two Rooms are adjacent, or kNone otherwise.
+    static Direction DirectionBetween( const Coordinate rm_1,
+                                       const Coordinate rm_2 );
+
+    // This private method returns true if the Room has a Wall in the
+    // given direction, which must not be kNone.
+    // Bounds are not checked.
+    bool IsWall( const Coordinate rm, const Direction d ) const;
+
+    // This private method breaks the Wall of the Room in the given
+    // direction, which must lead to another Room.
+    void BreakWall( const Coordinate rm, const Direction d );
+};
+
+template <size_t X, size_t Y>
+constexpr size_t FixedLabyrinth<X, Y>::kRoomCount;
+
+template <size_t X, size_t Y>
+constexpr size_t FixedLabyrinth<X, Y>::kWordsPerRow;
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Default constructor
+// Every Wall exists initially, and every Room is empty.
+template <size_t X, size_t Y>
+FixedLabyrinth<X, Y>::FixedLabyrinth()
+{
+  // Setting every bit also sets the padding bits, as in a WallGrid
+  east_.fill( ~uint64_t(0) );
+  south_.fill( ~uint64_t(0) );
+}
+
+// Parameterized constructor
+// This constructor copies the Walls, Rooms, spawns, and exit of a
+// Labyrinth of the same size, e.g. one carved by a MazeGenerator.
+// An exception is thrown if:
+//   The Labyrinth is not X by Y Rooms (invalid_argument)
+template <size_t X, size_t Y>
+FixedLabyrinth<X, Y>::FixedLabyrinth( const Labyrinth& l )
+{
+  if( l.XSize() != X || l.YSize() != Y )
+  {
+    throw std::invalid_argument( "Error: FixedLabyrinth() was given a "\
+      "Labyrinth of a different size.\n" );
+  }
+
+  const WallGrid& walls = l.Walls();
+  std::copy( walls.EastRow(0), walls.EastRow(0) + east_.size(),
+             east_.begin() );
+  std::copy( walls.SouthRow(0), walls.SouthRow(0) + south_.size(),
+             south_.begin() );
+  std::copy( l.Cells(), l.Cells() + kRoomCount, rooms_.begin() );
+  for( const RoomCell cell : rooms_ )
+  {
+    treasure_set_ = treasure_set_ || cell.GetItem() == Item::kTreasure;
+  }
+
+  spawn_1_ = l.Spawn1();
+  spawn_2_ = l.Spawn2();
+  if( l.HasExit() )
+  {
+    exit_room_ = l.ExitRoom();
+    exit_direction_ = l.ExitDirection();
+    exit_set_ = true;
+  }
+}
+
+// SETUP:
+
+// This method connects two Rooms by breaking the Wall between them.
+// An exception is thrown if:
+//   One or both Rooms are outside the Labyrinth (domain_error)
+//   The Rooms are the same (logic_error)
+//   The Rooms are not adjacent (logic_error)
+//   The Rooms are already connected (logic_error)
+//   The Wall between the Rooms is the exit (logic_error)
+template <size_t X, size_t Y>
+void FixedLabyrinth<X, Y>::ConnectRooms( const Coordinate rm_1,
+                                         const Coordinate rm_2 )
+{
+  switch( TryConnectRooms(rm_1, rm_2) )
+  {
+    case LabyrinthStatus::kOk:
+      return;
+    case LabyrinthStatus::kOutOfBounds:
+      throw std::domain_error( "Error: ConnectRooms() was given a "\
+        "Coordinate outside of the Labyrinth.\n" );
+    case LabyrinthStatus::kSameRoom:
+      throw std::logic_error( "Error: ConnectRooms() was given the same "\
+        "coordinate for the two Rooms.\n" );
+    case LabyrinthStatus::kNotAdjacent:
+      throw std::logic_error( "Error: ConnectRooms() was given two "\
+        "coordinates which are not adjacent, and therefore cannot be "\
+        "connected.\n" );
+    case LabyrinthStatus::kAlreadyConnected:
+      throw std::logic_error( "Error: ConnectRooms() was given two Rooms "\
+        "which are already connected.\n" );
+    default:
+      throw std::logic_error( "Error: ConnectRooms() was given two Rooms "\
+        "separated by the exit.\n" );
+  }
+}
+
+// These methods set the primary and secondary spawn Rooms.
+// Spawns can be changed at any time.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+template <size_t X, size_t Y>
+void FixedLabyrinth<X, Y>::SetSpawn1( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: SetSpawn1() was given an "\
+      "invalid Coordinate.\n" );
+  }
+  spawn_1_ = rm;
+}
+
+template <size_t X, size_t Y>
+void FixedLabyrinth<X, Y>::SetSpawn2( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: SetSpawn2() was given an "\
+      "invalid Coordinate.\n" );
+  }
+  spawn_2_ = rm;
+}
+
+// This method sets the exit of the Labyrinth on a Wall.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The Direction is invalid (kNone) (invalid_argument)
+//   The Direction has another Room (invalid_argument)
+//   The Exit has already been set (logic_error)
+template <size_t X, size_t Y>
+void FixedLabyrinth<X, Y>::SetExit( const Coordinate rm, const Direction d )
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: SetExit() was given an "\
+      "invalid Coordinate.\n" );
+  }
+  else if( d == Direction::kNone )
+  {
+    throw std::invalid_argument( "Error: SetExit() was given an "\
+      "invalid direction (kNone).\n" );
+  }
+  else if( !IsWall(rm, d) )
+  {
+    throw std::invalid_argument( "Error: SetExit() was given a "\
+      "direction with a Room, not a Wall.\n" );
+  }
+  else if( exit_set_ )
+  {
+    throw std::logic_error( "Error: SetExit() was called when an exit "\
+      "already exists.\n" );
+  }
+
+  // The Wall itself is kept, as in a Labyrinth
+  exit_room_ = rm;
+  exit_direction_ = d;
+  exit_set_ = true;
+}
+
+// This method places an Inhabitant in a Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   Inhabitant inh is a null Inhabitant (i.e. Inhabitant::kNone)
+//     (invalid_argument)
+//   The Inhabitant of the Room has already been set (logic_error)
+template <size_t X, size_t Y>
+void FixedLabyrinth<X, Y>::SetInhabitant( const Coordinate rm,
+                                          const Inhabitant inh )
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: SetInhabitant() was given an "\
+      "invalid Coordinate.\n" );
+  }
+  else if( inh == Inhabitant::kNone )
+  {
+    throw std::invalid_argument( "Error: SetInhabitant() was given a null "\
+      "Inhabitant.\n" );
+  }
+
+  RoomCell& cell = rooms_[IndexOf(rm.x, rm.y)];
+  if( cell.GetInhabitant() != Inhabitant::kNone )
+  {
+    throw std::logic_error( "Error: SetInhabitant() cannot replace an "\
+      "existing Inhabitant.\n" );
+  }
+  cell.SetInhabitant( inh );
+}
+
+// This method places an Item in a Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   Item itm is a null Item (i.e. Item::kNone) (invalid_argument)
+//   The Item of the Room has already been set (logic_error)
+//   Item itm is a Treasure but the Treasure has already been placed
+//     in another room (logic_error)
+template <size_t X, size_t Y>
+void FixedLabyrinth<X, Y>::SetItem( const Coordinate rm, const Item itm )
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: SetItem() was given an invalid "\
+      "Coordinate.\n" );
+  }
+  else if( itm == Item::kNone )
+  {
+    throw std::invalid_argument( "Error: SetItem() was given an invalid "\
+      "Item.\n" );
+  }
+
+  RoomCell& cell = rooms_[IndexOf(rm.x, rm.y)];
+  if( cell.GetItem() != Item::kNone )
+  {
+    throw std::logic_error( "Error: SetItem() cannot replace an existing "\
+      "Item.\n" );
+  }
+  else if( itm == Item::kTreasure && treasure_set_ )
+  {
+    throw std::logic_error( "Error: SetItem() was given a Treasure, "\
+      "but the Treasure has already been set in the Labyrinth.\n" );
+  }
+
+  cell.SetItem( itm );
+  treasure_set_ = treasure_set_ || itm == Item::kTreasure;
+}
+
+// PLAY:
+
+// This method returns the current Inhabitant of the Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+template <size_t X, size_t Y>
+Inhabitant FixedLabyrinth<X, Y>::GetInhabitant( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: GetInhabitant() was given a "\
+      "Coordinate outside of the Labyrinth.\n" );
+  }
+  return GetInhabitantUnchecked( rm );
+}
+
+// This method returns the current Item in the given Room, but does
+// not change it.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+template <size_t X, size_t Y>
+Item FixedLabyrinth<X, Y>::ItemAt( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: ItemAt() was given a "\
+      "Coordinate outside of the Labyrinth.\n" );
+  }
+  return ItemAtUnchecked( rm );
+}
+
+// This method returns the type of RoomBorder in the given direction.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   Direction d is kNone (invalid_argument)
+template <size_t X, size_t Y>
+RoomBorder FixedLabyrinth<X, Y>::DirectionCheck( const Coordinate rm,
+                                                 const Direction d ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: DirectionCheck() was given a "\
+      "Coordinate outside of the Labyrinth.\n" );
+  }
+  else if( d == Direction::kNone )
+  {
+    throw std::invalid_argument( "Error: DirectionCheck() was given an "\
+      "invalid direction (kNone).\n" );
+  }
+  return DirectionCheckUnchecked( rm, d );
+}
+
+// SIZE:
+
+// These methods return the number of Rooms along each axis.
+template <size_t X, size_t Y>
+constexpr size_t FixedLabyrinth<X, Y>::XSize()
+{
+  return X;
+}
+
+template <size_t X, size_t Y>
+constexpr size_t FixedLabyrinth<X, Y>::YSize()
+{
+  return Y;
+}
+
+// SPECIAL ROOMS AND WALLS:
+
+// These methods return the spawn Rooms of the Players.
+template <size_t X, size_t Y>
+Coordinate FixedLabyrinth<X, Y>::Spawn1() const
+{
+  return spawn_1_;
+}
+
+template <size_t X, size_t Y>
+Coordinate FixedLabyrinth<X, Y>::Spawn2() const
+{
+  return spawn_2_;
+}
+
+// This method returns true if the exit has been set, and false
+// otherwise.
+template <size_t X, size_t Y>
+bool FixedLabyrinth<X, Y>::HasExit() const
+{
+  return exit_set_;
+}
+
+// This method returns the Room which has the exit.
+// An exception is thrown if:
+//   The exit has not been set (logic_error)
+template <size_t X, size_t Y>
+Coordinate FixedLabyrinth<X, Y>::ExitRoom() const
+{
+  if( !exit_set_ )
+  {
+    throw std::logic_error( "Error: ExitRoom() was called, but the exit "\
+      "has not been set.\n" );
+  }
+  return exit_room_;
+}
+
+// This method returns a view of the Labyrinth for the algorithms
+// which are shared with Labyrinth. The view is valid while the
+// FixedLabyrinth exists.
+template <size_t X, size_t Y>
+FixedLabyrinth<X, Y>::operator LabyrinthView() const
+{
+  return LabyrinthView( X, Y, east_.data(), south_.data(), rooms_.data(),
+                        spawn_1_, spawn_2_, exit_set_, exit_room_ );
+}
+
+// NON-THROWING:
+
+// This method connects two Rooms by breaking the Wall between them.
+// Returns kOutOfBounds, kSameRoom, kNotAdjacent, kAlreadyConnected, or
+// kExitInTheWay upon failure.
+template <size_t X, size_t Y>
+LabyrinthStatus FixedLabyrinth<X, Y>::TryConnectRooms(
+  const Coordinate rm_1,
+  const Coordinate rm_2 )
+{
+  if( !WithinBounds(rm_1) || !WithinBounds(rm_2) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( rm_1 == rm_2 )
+  {
+    return LabyrinthStatus::kSameRoom;
+  }
+
+  const Direction d = DirectionBetween( rm_1, rm_2 );
+  if( d == Direction::kNone )
+  {
+    return LabyrinthStatus::kNotAdjacent;
+  }
+  else if( !IsWall(rm_1, d) )
+  {
+    return LabyrinthStatus::kAlreadyConnected;
+  }
+  else if( exit_set_ &&
+           ( ( rm_1 == exit_room_ && d == exit_direction_ ) ||
+             ( rm_2 == exit_room_ &&
+               DirectionBetween(rm_2, rm_1) == exit_direction_ ) ) )
+  {
+    return LabyrinthStatus::kExitInTheWay;
+  }
+
+  BreakWall( rm_1, d );
+  return LabyrinthStatus::kOk;
+}
+
+// UNCHECKED:
+
+// This method returns the current Inhabitant of the Room.
+// Bounds are not checked.
+template <size_t X, size_t Y>
+Inhabitant FixedLabyrinth<X, Y>::GetInhabitantUnchecked(
+  const Coordinate rm ) const
+{
+  return rooms_[IndexOf(rm.x, rm.y)].GetInhabitant();
+}
+
+// This method returns the current Item in the given Room.
+// Bounds are not checked.
+template <size_t X, size_t Y>
+Item FixedLabyrinth<X, Y>::ItemAtUnchecked( const Coordinate rm ) const
+{
+  return rooms_[IndexOf(rm.x, rm.y)].GetItem();
+}
+
+// This method returns the type of RoomBorder in the given direction.
+// Bounds are not checked, and Direction d must not be kNone.
+template <size_t X, size_t Y>
+RoomBorder FixedLabyrinth<X, Y>::DirectionCheckUnchecked(
+  const Coordinate rm,
+  const Direction d ) const
+{
+  if( exit_set_ && d == exit_direction_ && rm == exit_room_ )
+  {
+    return RoomBorder::kExit;
+  }
+  else if( IsWall(rm, d) )
+  {
+    return RoomBorder::kWall;
+  }
+  return RoomBorder::kRoom;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the index of the Room at (x, y) in
+// rooms_.
+template <size_t X, size_t Y>
+constexpr size_t FixedLabyrinth<X, Y>::IndexOf( const size_t x,
+                                                const size_t y )
+{
+  return y * X + x;
+}
+
+// This private method returns true if the Room is within the bounds
+// of the Labyrinth, and false otherwise.
+template <size_t X, size_t Y>
+bool FixedLabyrinth<X, Y>::WithinBounds( const Coordinate rm )
+{
+  return rm.x < X && rm.y < Y;
+}
+
+// This private method returns the Direction from rm_1 to rm_2 if the
+// two Rooms are adjacent, or kNone otherwise.
+template <size_t X, size_t Y>
+Direction FixedLabyrinth<X, Y>::DirectionBetween( const Coordinate rm_1,
+                                                  const Coordinate rm_2 )
+{
+  if( rm_1.x == rm_2.x )
+  {
+    if( rm_2.y == rm_1.y + 1 )
+    {
+      return Direction::kSouth;
+    }
+    else if( rm_1.y == rm_2.y + 1 )
+    {
+      return Direction::kNorth;
+    }
+  }
+  else if( rm_1.y == rm_2.y )
+  {
+    if( rm_2.x == rm_1.x + 1 )
+    {
+      return Direction::kEast;
+    }
+    else if( rm_1.x == rm_2.x + 1 )
+    {
+      return Direction::kWest;
+    }
+  }
+  return Direction::kNone;
+}
+
+// This private method returns true if the Room has a Wall in the
+// given direction, which must not be kNone.
+// Bounds are not checked.
+template <size_t X, size_t Y>
+bool FixedLabyrinth<X, Y>::IsWall( const Coordinate rm,
+                                   const Direction d ) const
+{
+  const auto bit = []( const std::array<uint64_t, kWordsPerRow * Y>& b,
+                       const size_t x,
+                       const size_t y )
+  {
+    return ( b[y * kWordsPerRow + x / 64] >> (x % 64) ) & 1;
+  };
+
+  switch( d )
+  {
+    case Direction::kNorth:
+      return rm.y == 0 || bit( south_, rm.x, rm.y - 1 );
+    case Direction::kEast:
+      return bit( east_, rm.x, rm.y );
+    case Direction::kSouth:
+      return bit( south_, rm.x, rm.y );
+    default:
+      return rm.x == 0 || bit( east_, rm.x - 1, rm.y );
+  }
+}
+
+// This private method breaks the Wall of the Room in the given
+// direction, which must lead to another Room.
+template <size_t X, size_t Y>
+void FixedLabyrinth<X, Y>::BreakWall( const Coordinate rm,
+                                      const Direction d )
+{
+  // Each Wall is stored once, by the Room to its west or north
+  const Coordinate owner = d == Direction::kNorth ?
+                           Coordinate( rm.x, rm.y - 1 ) :
+                           d == Direction::kWest ?
+                           Coordinate( rm.x - 1, rm.y ) :
+                           rm;
+  std::array<uint64_t, kWordsPerRow * Y>& bitmap =
+    ( d == Direction::kEast || d == Direction::kWest ) ? east_ : south_;
+  bitmap[owner.y * kWordsPerRow + owner.x / 64] &=
+    ~( uint64_t(1) << (owner.x % 64) );
+}
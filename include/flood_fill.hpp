@@ -0,0 +1,113 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the FloodFill class, which finds every
+ * Room of a Labyrinth which can be reached from one or more source Rooms,
+ * 64 Rooms at a time.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_view.hpp"
+
+// A FloodFill holds the set of Rooms of a Labyrinth which can be reached
+// from a set of source Rooms through broken Walls. The exit does not lead
+// to a Room and is never crossed.
+//
+// The set is stored as a bitmap with the row layout of the Labyrinth's
+// WallGrid: bit (x % 64) of word (x / 64) of row y is set if the Room at
+// (x, y) can be reached, and padding bits are clear. The fill works on
+// whole words, so 64 Rooms of a row are spread into at once, masked by the
+// Walls of the WallGrid. The working memory is kept between fills, so a
+// FloodFill which is reused for Labyrinths of the same size or smaller
+// does not allocate memory.
+class FloodFill
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Default constructor
+      // No Rooms are held until one of the Fill methods is called.
+      FloodFill();
+
+    // FILL:
+
+      // This method finds every Room which can be reached from the given
+      // Room.
+      // An exception is thrown if:
+      //   The Room is outside the Labyrinth (domain_error)
+      //   There is not enough memory for the bitmap (bad_alloc)
+      void Fill( const LabyrinthView& l, const Coordinate source );
+
+      // This method finds every Room which can be reached from any of the
+      // given Rooms. A Room may be given more than once.
+      // An exception is thrown if:
+      //   No Room is given (invalid_argument)
+      //   A Room is outside the Labyrinth (domain_error)
+      //   There is not enough memory for the bitmap (bad_alloc)
+      void Fill( const LabyrinthView& l,
+                 const std::vector<Coordinate>& sources );
+
+    // RESULTS:
+
+      // This method returns true if the Room can be reached, and false
+      // otherwise.
+      // An exception is thrown if:
+      //   Nothing has been filled (logic_error)
+      //   The Room is outside the filled Labyrinth (domain_error)
+      bool IsReachable( const Coordinate rm ) const;
+
+      // This method returns the number of Rooms which can be reached,
+      // including the sources.
+      size_t ReachableCount() const;
+
+      // This method returns the first word of row y of the bitmap.
+      // Bounds are not checked; y must be less than YSize().
+      const uint64_t* Row( const size_t y ) const;
+
+      // This method returns the number of 64-bit words in each bitmap row.
+      size_t WordsPerRow() const;
+
+      // These methods return the size of the filled Labyrinth, or 0 if
+      // nothing has been filled.
+      size_t XSize() const;
+      size_t YSize() const;
+
+  private:
+
+    std::vector<uint64_t> reached_;
+    std::vector<uint8_t> queued_;   // One flag per word of the bitmap
+    std::vector<size_t> worklist_;  // Words which may spread further
+    size_t x_size_ = 0;
+    size_t y_size_ = 0;
+    size_t words_per_row_ = 0;
+
+    // This private method prepares the bitmap for a fill of the
+    // Labyrinth, with no Room reached.
+    // An exception is thrown if:
+    //   There is not enough memory for the bitmap (bad_alloc)
+    void Reset( const LabyrinthView& l );
+
+    // This private method marks a source Room as reached.
+    // Bounds are not checked; the Room must be within the Labyrinth.
+    void AddSource( const Coordinate rm );
+
+    // This private method spreads the reached Rooms through the Labyrinth
+    // until no more Rooms can be reached.
+    void Spread( const LabyrinthView& l );
+
+    // This private method returns the bits of the word g, spread east and
+    // west through the open bits of p: bit x of p is set if the Room of
+    // bit x opens east onto the Room of bit (x + 1).
+    static uint64_t SpreadWithinWord( uint64_t g, const uint64_t p );
+};
@@ -0,0 +1,191 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the GameSession class, which plays one
+ * Player through a Labyrinth by the rules of GameInstructions.md, without
+ * any input or output.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "room_properties.hpp"
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "room_overlay.hpp"
+
+// The state of a GameSession
+enum class SessionState
+{
+  kExploring,  // The Player may move
+  kEncounter,  // The Player faces eyes, and must shoot or hold fire
+  kWon,        // The Player left through the exit with the Treasure
+  kLost,       // The Player has lost both lives
+};
+
+// The result of an action of a GameSession. Actions which do not return
+// kOk change nothing.
+enum class SessionStatus
+{
+  kOk,
+  kInvalidDirection,  // Direction::kNone was given
+  kWall,              // A Wall is in the way
+  kNoTreasure,        // The exit was reached without the Treasure
+  kNotExploring,      // Move() was called during an encounter, or after
+                      // the game ended
+  kNoEncounter,       // Shoot() or HoldFire() was called without eyes
+  kNoBullets,         // Shoot() was called without a bullet
+};
+
+// The Player of a GameSession, as saved by GameSession::SavePlayer()
+struct PlayerState
+{
+  Coordinate position;
+  uint32_t bullets = 0;
+  uint32_t lives = 0;
+  bool has_treasure = false;
+  SessionState state = SessionState::kExploring;
+  size_t steps = 0;
+};
+
+// A GameSession holds the Player of one game: the Room, bullets, lives,
+// and whether the Treasure is held. It plays the game on the Labyrinth or
+// RoomOverlay it is given, which it changes as the game goes (Minotaurs
+// are killed, Mirrors crack, and Items are taken); the Labyrinth or
+// RoomOverlay must outlive the GameSession. Games which share a level each
+// play on a RoomOverlay of their own.
+//
+// The rules, from GameInstructions.md:
+//   The Player begins in the primary spawn with two lives (one extra)
+//   Moving into a Room with a live Minotaur or an intact Mirror begins an
+//     encounter, which ends with Shoot() or HoldFire()
+//   Shooting uses a bullet and kills the Minotaur or cracks the Mirror
+//   Holding fire at a Mirror does nothing; holding fire at a Minotaur
+//     loses a life and drops the Treasure in the Room, if it is held,
+//     after taking the bullet of the Room (a Room holds one Item)
+//   After an encounter is survived, or on entering a Room without eyes,
+//     the Player takes its bullet or Treasure
+//   A Player who loses a life but has another respawns in the secondary
+//     spawn with more bullets
+//   Leaving through the exit with the Treasure wins the game
+//
+// Actions never throw; they return a SessionStatus. On a RoomOverlay, an
+// action which changes a Room for the first time in the game may allocate
+// memory, and throws bad_alloc only if there is none left.
+class GameSession
+{
+  public:
+
+    // The lives of a new Player
+    static constexpr uint32_t kLives = 2;
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // The Player begins in the primary spawn of the Labyrinth with the
+      // given number of bullets, and is given as many again each time it
+      // respawns.
+      explicit GameSession( Labyrinth& l, const uint32_t bullets = 1 );
+
+      // Parameterized constructor
+      // As above, for a game of a shared level.
+      explicit GameSession( RoomOverlay& overlay, const uint32_t bullets = 1 );
+
+    // ACTIONS:
+
+      // This method moves the Player through a broken Wall to the next
+      // Room, or out through the exit with the Treasure.
+      // Returns kNotExploring, kInvalidDirection, kWall, or kNoTreasure
+      // upon failure.
+      SessionStatus Move( const Direction d );
+
+      // This method shoots the eyes in the Player's Room, using a bullet,
+      // and takes the Item of the Room.
+      // Returns kNoEncounter or kNoBullets upon failure.
+      SessionStatus Shoot();
+
+      // This method holds fire at the eyes in the Player's Room. The
+      // Player takes the Item of the Room if the eyes were a Mirror, and
+      // loses a life if they were a Minotaur.
+      // Returns kNoEncounter upon failure.
+      SessionStatus HoldFire();
+
+      // This method starts a new game in the same Labyrinth, as if the
+      // GameSession had just been constructed. The Labyrinth or
+      // RoomOverlay is not restored.
+      void Restart();
+
+    // STATE:
+
+      // This method returns the state of the game.
+      SessionState State() const;
+
+      // This method returns the Room of the Player.
+      Coordinate Position() const;
+
+      // This method returns the bullets of the Player.
+      uint32_t Bullets() const;
+
+      // This method returns the lives left, including the current one.
+      uint32_t Lives() const;
+
+      // This method returns true if the Player holds the Treasure, and
+      // false otherwise.
+      bool HasTreasure() const;
+
+      // This method returns the number of Moves which changed Room.
+      size_t Steps() const;
+
+    // SNAPSHOTS:
+
+      // This method returns the state of the Player.
+      PlayerState SavePlayer() const;
+
+      // This method restores the Player to a saved state. The state must
+      // have been saved from a game of the same level, so that the
+      // Player's Room is within the Labyrinth.
+      void RestorePlayer( const PlayerState& player );
+
+  private:
+
+    // Exactly one of these is set
+    Labyrinth* const labyrinth_;
+    RoomOverlay* const overlay_;
+
+    const uint32_t respawn_bullets_;
+    Coordinate position_;
+    uint32_t bullets_;
+    uint32_t lives_;
+    bool has_treasure_;
+    SessionState state_;
+    size_t steps_;
+
+    // These private methods read and change the Player's Room, and return
+    // the spawns, in the Labyrinth or the RoomOverlay.
+    RoomBorder BorderAt( const Direction d ) const;
+    Inhabitant InhabitantHere() const;
+    Item ItemHere() const;
+    void AttackHere();
+    void TakeItemHere();
+    void DropTreasureHere();
+    Coordinate Spawn1() const;
+    Coordinate Spawn2() const;
+
+    // This private method enters the Player's Room: an encounter begins
+    // if there are eyes, and the Item is taken otherwise.
+    void Enter();
+
+    // This private method takes the Item of the Player's Room, if any.
+    void TakeItem();
+
+    // This private method loses a life, dropping the Treasure, and
+    // respawns the Player or ends the game. A Room holds only one Item, so
+    // a Player with the Treasure takes the bullet of the Room before
+    // dropping the Treasure in it.
+    void Die();
+};
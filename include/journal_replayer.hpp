@@ -0,0 +1,102 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the JournalReplayer class, which rebuilds
+ * the game of a CommandJournal as it was after any number of commands.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "labyrinth.hpp"
+#include "game_session.hpp"
+#include "command_journal.hpp"
+#include "journaled_game.hpp"
+
+// A JournalReplayer replays the commands of a CommandJournal into a
+// JournaledGame which does not record. Seek() moves to any step (the
+// number of commands applied), forwards or backwards.
+//
+// A snapshot of the game is saved every snapshot_interval steps as the
+// replay first passes them, so a Seek() replays at most
+// snapshot_interval - 1 commands after restoring the nearest snapshot at
+// or before the step, instead of replaying from the start; a Seek() just
+// ahead of the current step replays forward without restoring anything.
+// Each snapshot holds one byte per Room and the Walls, so the interval
+// trades memory for seek time.
+//
+// The journal must outlive the JournalReplayer. It may grow while it is
+// being replayed, for example while a JournaledGame records into it.
+class JournalReplayer
+{
+  public:
+
+    // The default number of steps between snapshots
+    static constexpr size_t kSnapshotInterval = 1024;
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // The replay begins at step 0, before the first command.
+      // An exception is thrown if:
+      //   The snapshot interval is 0 (invalid_argument)
+      //   There is not enough memory for the game (bad_alloc)
+      explicit JournalReplayer( const CommandJournal& journal,
+                                const size_t snapshot_interval =
+                                  kSnapshotInterval );
+
+    // REPLAY:
+
+      // This method rebuilds the game as it was after the given number
+      // of commands.
+      // An exception is thrown if:
+      //   The step is beyond the number of commands (out_of_range)
+      //   A command is damaged or cannot be replayed (the exception of
+      //     CommandJournal::Decode() or JournaledGame::Apply()); the
+      //     replay is left at the step before the command
+      void Seek( const size_t step );
+
+      // This method returns the number of commands applied.
+      size_t Step() const;
+
+      // This method returns the Labyrinth of the game.
+      const Labyrinth& Level() const;
+
+      // This method returns the Player of the game.
+      const GameSession& Session() const;
+
+    // STATISTICS:
+
+      // This method returns the number of snapshots saved.
+      size_t SnapshotCount() const;
+
+      // This method returns the number of commands which have been
+      // applied since the JournalReplayer was constructed, including
+      // those replayed again after a snapshot was restored.
+      size_t CommandsReplayed() const;
+
+  private:
+
+    // A snapshot and the byte offset of the command after it
+    struct Checkpoint
+    {
+      GameSnapshot snapshot;
+      size_t offset;
+    };
+
+    const CommandJournal& journal_;
+    const size_t snapshot_interval_;
+    JournaledGame game_;
+
+    size_t step_ = 0;
+    size_t offset_ = 0;  // Of the next command
+    size_t commands_replayed_ = 0;
+
+    // checkpoints_[i] is the game after i * snapshot_interval_ commands
+    std::vector<Checkpoint> checkpoints_;
+};
@@ -0,0 +1,168 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the JournaledGame class, a Labyrinth and
+ * a GameSession whose changes are recorded in a CommandJournal.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "room_cell.hpp"
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "game_session.hpp"
+#include "command_journal.hpp"
+
+// The state of a JournaledGame, as saved by JournaledGame::Save(). The
+// Walls use the bitmap layout of a WallGrid, and the Rooms are in
+// row-major order, one byte each.
+struct GameSnapshot
+{
+  std::vector<uint64_t> east_walls;
+  std::vector<uint64_t> south_walls;
+  std::vector<RoomCell> cells;
+
+  Coordinate spawn_1;
+  Coordinate spawn_2;
+  Coordinate exit_room;
+  Direction exit_direction = Direction::kNone;  // kNone if the exit has
+                                                // not been set
+  PlayerState player;
+};
+
+// A JournaledGame holds a Labyrinth and a GameSession on it. Its methods
+// behave like the methods of the same name of the Labyrinth or the
+// GameSession, and each call which succeeds is appended to the journal:
+// calls which throw, and actions which do not return kOk, change nothing
+// and are not recorded. Replaying the journal into a new JournaledGame
+// of the same size, with Apply(), rebuilds the same game, since nothing
+// in a game is random.
+//
+// Recording is optional: a JournaledGame constructed with record set to
+// false keeps its journal empty, and is what a JournalReplayer replays
+// into.
+//
+// The Player is placed in the primary spawn when the JournaledGame is
+// constructed, before the setup commands; Restart() places the Player in
+// the spawn which the setup commands set.
+class JournaledGame
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // This constructor creates an empty Labyrinth of the given size,
+      // whose Player is given the given number of bullets.
+      // An exception is thrown if:
+      //   The Labyrinth() constructor would throw for the size
+      JournaledGame( const size_t x_size,
+                     const size_t y_size,
+                     const uint32_t bullets = 1,
+                     const bool record = true );
+
+      // Parameterized constructor
+      // This constructor copies the Labyrinth as it is now, recording
+      // the setup commands which rebuild it, and then calls Restart(),
+      // so that a level built by a MazeGenerator can be journaled.
+      // An exception is thrown if:
+      //   There is not enough memory for the copy (bad_alloc)
+      explicit JournaledGame( const Labyrinth& l,
+                              const uint32_t bullets = 1 );
+
+    // SETUP:
+    //
+    // An exception is thrown if the method of the same name of the
+    // Labyrinth would throw.
+
+      void ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 );
+      void SetSpawn1( const Coordinate rm );
+      void SetSpawn2( const Coordinate rm );
+      void SetExit( const Coordinate rm, const Direction d );
+      void SetInhabitant( const Coordinate rm, const Inhabitant inh );
+      void SetItem( const Coordinate rm, const Item itm );
+
+    // PLAY:
+    //
+    // An exception is thrown if the method of the same name of the
+    // Labyrinth would throw.
+
+      void AttackEnemy( const Coordinate rm );
+      void TakeItem( const Coordinate rm );
+      void DropTreasure( const Coordinate rm );
+
+    // ACTIONS:
+    //
+    // These methods return what the method of the same name of the
+    // GameSession returns.
+
+      SessionStatus Move( const Direction d );
+      SessionStatus Shoot();
+      SessionStatus HoldFire();
+      void Restart();
+
+    // REPLAY:
+
+      // This method calls the method of the command, with the parts of
+      // the entry which it uses.
+      // An exception is thrown if:
+      //   The method of the command throws
+      //   The command is an action which does not return kOk
+      //     (logic_error)
+      void Apply( const JournalEntry& entry );
+
+      // This method returns the state of the Labyrinth and the Player.
+      // An exception is thrown if:
+      //   There is not enough memory for the snapshot (bad_alloc)
+      GameSnapshot Save() const;
+
+      // This method rebuilds the Labyrinth and the Player from a snapshot
+      // of a game of the same size.
+      // An exception is thrown if:
+      //   The game is recording, since its journal would no longer
+      //     rebuild it (logic_error)
+      //   The snapshot is of a game of another size (invalid_argument)
+      //   There is not enough memory for the Labyrinth (bad_alloc)
+      void Restore( const GameSnapshot& snapshot );
+
+    // STATE:
+
+      // This method returns the Labyrinth of the game.
+      const Labyrinth& Level() const;
+
+      // This method returns the Player of the game.
+      const GameSession& Session() const;
+
+      // This method returns the journal of the game.
+      const CommandJournal& Journal() const;
+
+      // This method returns true if the game is recording, and false
+      // otherwise.
+      bool Recording() const;
+
+  private:
+
+    CommandJournal journal_;
+    const bool record_;
+
+    // The GameSession refers to the Labyrinth, so it is declared after
+    // it and destroyed first
+    std::unique_ptr<Labyrinth> labyrinth_;
+    std::unique_ptr<GameSession> session_;
+
+    // This private method appends the command to the journal if the game
+    // is recording.
+    void Record( const JournalEntry& entry );
+
+    // This private method records a command which uses only a Room.
+    void RecordRoom( const JournalCommand command, const Coordinate rm );
+};
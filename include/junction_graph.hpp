@@ -0,0 +1,204 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the JunctionGraph class, an index of a
+ * Labyrinth in which every corridor is contracted into one weighted edge
+ * between two junctions or dead ends.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+
+// A JunctionGraph indexes the Rooms of a Labyrinth for shortest-path
+// queries. Every Room which does not open onto exactly two Rooms (a
+// junction, dead end, or closed Room) is a node of the graph; the other
+// Rooms form corridors, and each corridor is one edge between the nodes
+// at its ends, weighted by the number of steps along it. A loop of
+// corridor Rooms with no node on it is given one node of its own. Every
+// corridor Room records its edge and its place along it, so queries may
+// begin and end anywhere and paths are given Room by Room.
+//
+// Since most Rooms of a maze are corridor Rooms, a query searches far
+// fewer nodes than a search through the Rooms. The exit does not lead to
+// a Room and is never crossed.
+//
+// The index refers to its Labyrinth, which must outlive it. After Walls
+// are broken with ConnectRooms(), Update() repairs only the edges through
+// the two Rooms, in place of a full Rebuild(). The JunctionGraph keeps the
+// state of its queries, so it serves one query at a time.
+class JunctionGraph
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // An exception is thrown if:
+      //   l is null (invalid_argument)
+      //   The Labyrinth has 2^32 or more Rooms (domain_error)
+      //   There is not enough memory for the index (bad_alloc)
+      explicit JunctionGraph( const Labyrinth* const l );
+
+    // INDEX:
+
+      // This method rebuilds the whole index from the Labyrinth.
+      // An exception is thrown if:
+      //   There is not enough memory for the index (bad_alloc)
+      void Rebuild();
+
+      // This method updates the index after the Wall between the two
+      // Rooms has been broken with Labyrinth::ConnectRooms(). Only the
+      // edges through the two Rooms are rebuilt.
+      // An exception is thrown if:
+      //   One or both Rooms are outside the Labyrinth (domain_error)
+      //   There is not enough memory for the index (bad_alloc)
+      void Update( const Coordinate rm_1, const Coordinate rm_2 );
+
+      // This method returns the number of nodes of the graph.
+      size_t NodeCount() const;
+
+      // This method returns the number of edges of the graph.
+      size_t EdgeCount() const;
+
+    // QUERIES:
+
+      // This method returns a shortest path from one Room to another,
+      // beginning with from and ending with to, or an empty path if to
+      // cannot be reached from from. The path is valid until the next
+      // query.
+      // An exception is thrown if:
+      //   A Room is outside the Labyrinth (domain_error)
+      //   There is not enough memory for the search (bad_alloc)
+      const std::vector<Coordinate>& Path( const Coordinate from,
+                                           const Coordinate to );
+
+      // This method returns the number of nodes expanded by the last
+      // query.
+      size_t ExpandedCount() const;
+
+  private:
+
+    // Marks a Room, node, edge, or distance which does not exist
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    // A node; edge[d] is the edge leaving the Room in Direction d (in the
+    // order north, east, south, west), or kNone, and next[d] and weight[d]
+    // are the node at its other end and its weight, so that a search
+    // reads only the nodes
+    struct Node
+    {
+      uint32_t room;
+      uint32_t x;
+      uint32_t y;
+      uint32_t edge[4];
+      uint32_t next[4];
+      uint32_t weight[4];
+    };
+
+    // An edge; its corridor Rooms are rooms_[first] onwards, from the
+    // end at node[0] to the end at node[1]
+    struct Edge
+    {
+      uint32_t node[2];
+      uint32_t weight;  // Number of corridor Rooms + 1
+      uint32_t first;
+    };
+
+    // An entry of the open list
+    struct OpenNode
+    {
+      uint32_t f;     // Distance so far plus the Manhattan distance left
+      uint32_t g;     // Distance so far
+      uint32_t node;
+    };
+
+    const Labyrinth* const l_;
+    uint32_t x_size_ = 0;
+    uint32_t y_size_ = 0;
+
+    // The index
+    std::vector<uint32_t> node_of_room_;  // One per Room, or kNone
+    std::vector<uint32_t> edge_of_room_;  // One per Room, or kNone
+    std::vector<uint32_t> place_of_room_; // Place along the edge from 0
+    std::vector<Node> nodes_;
+    std::vector<Edge> edges_;
+    std::vector<uint32_t> rooms_;          // Corridor Rooms of the edges
+    std::vector<uint32_t> free_nodes_;
+    std::vector<uint32_t> free_edges_;
+    size_t node_count_ = 0;
+    size_t edge_count_ = 0;
+    size_t unused_rooms_ = 0;              // Rooms of removed edges
+
+    // The state of queries, reset after each one
+    std::vector<uint32_t> distance_;       // One per node, or kNone
+    std::vector<uint32_t> parent_edge_;    // One per node
+    std::vector<uint32_t> touched_;
+    std::vector<OpenNode> open_[33];       // Radix heap; see PushOpen()
+    uint32_t open_f_ = 0;                  // Least f in the open list
+    size_t open_size_ = 0;
+    std::vector<Coordinate> path_;
+    size_t expanded_count_ = 0;
+
+    // This private method returns the open Directions of the Room, as
+    // bit d for Direction d (in the order north, east, south, west).
+    unsigned OpenDirections( const uint32_t room ) const;
+
+    // This private method returns the Room in Direction d of the Room.
+    uint32_t Neighbour( const uint32_t room, const unsigned d ) const;
+
+    // This private method makes the Room a node with no edges, and
+    // returns the node.
+    uint32_t AddNode( const uint32_t room );
+
+    // This private method removes the node of the Room and every edge of
+    // the node, adding the other ends of the edges to the dirty nodes.
+    void RemoveNode( const uint32_t room, std::vector<uint32_t>& dirty );
+
+    // This private method removes the edge, adding its ends to the dirty
+    // nodes.
+    void RemoveEdge( const uint32_t edge, std::vector<uint32_t>& dirty );
+
+    // This private method follows the corridor leaving the node in
+    // Direction d up to the node at its other end, and adds its edge.
+    void TraceEdge( const uint32_t node, const unsigned d );
+
+    // This private method traces every open Direction of the node which
+    // has no edge yet.
+    void TraceNode( const uint32_t node );
+
+    // This private method gives the corridor loop through the Room, which
+    // has neither a node nor an edge, a node at the Room.
+    void AnchorLoop( const uint32_t room );
+
+    // This private method copies the Rooms of the live edges into a new
+    // rooms_, dropping the Rooms of removed edges.
+    void CompactRooms();
+
+    // This private method runs the search of Path() and fills path_.
+    void Search( const uint32_t from, const uint32_t to );
+
+    // This private method adds the entry to the open list, whose f must
+    // be at least the least f in it.
+    void PushOpen( const OpenNode entry );
+
+    // This private method moves the entries with the least f to the
+    // front of the open list, and returns false if it is empty.
+    bool FrontOpen();
+
+    // This private method appends the corridor Rooms of the edge to the
+    // path, walking away from the given node.
+    void AppendEdge( const uint32_t edge, const uint32_t from_node );
+
+    // This private method resets the distance of every touched node and
+    // empties the open list.
+    void Clear();
+};
@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-02-01
+ * Last edited: 2026-10-18
  *
  * This C++ header file contains the implementation of the Labyrinth class,
  * which uses the Room class to create a 2-d mapping for a game.
@@ -10,13 +10,22 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 #include "room_properties.hpp"
-#include "room.hpp"
+#include "room_cell.hpp"
 #include "coordinate.hpp"
+#include "wall_grid.hpp"
+#include "labyrinth_status.hpp"
+#include "labyrinth_layout.hpp"
+#include "labyrinth_population.hpp"
+#include "random_generator.hpp"
 
-// Rooms are indexed first with the y-coordinate, then with the x-coordinate.
+// The contents of the Rooms are stored in a single contiguous row-major
+// array of RoomCells; the Room at (x, y) is found at index
+// (y * x_size + x). Each Wall between two Rooms is stored once, in a
+// WallGrid, and the exit is stored separately.
 class Labyrinth
 {
   public:
@@ -27,19 +36,40 @@ class Labyrinth
     // CONSTRUCTOR/DESTRUCTOR:
 
       // Parameterized constructor
+      // There is no fixed maximum size; a Labyrinth may hold as many Rooms
+      // as fit in memory.
       // An exception is thrown if:
       //   A size of 0 is given (domain_error)
-      //   An x or y size greater than the maximum is given (domain_error)
+      //   The number of Rooms (x_size * y_size) overflows a size_t
+      //     (domain_error)
+      //   There is not enough memory for the Rooms (bad_alloc)
       Labyrinth( const size_t x_size, const size_t y_size );
 
+      // Parameterized constructor
+      // This constructor builds a complete Labyrinth from a layout in a
+      // single pass over the Walls and Rooms, in place of one
+      // ConnectRooms(), SetInhabitant(), or SetItem() call per Room.
+      // The spawns and exit are set afterwards as usual.
+      // An exception is thrown if:
+      //   The constructor above would throw for the layout's sizes
+      //   A Wall bitmap has the wrong number of words (invalid_argument)
+      //   A Wall on the outside of the Labyrinth is missing
+      //     (invalid_argument)
+      //   The inhabitants or items are neither empty nor one per Room
+      //     (invalid_argument)
+      //   An Inhabitant or Item is not a valid enumerator (invalid_argument)
+      //   More than one Room holds the Treasure (logic_error)
+      explicit Labyrinth( const LabyrinthLayout& layout );
+
     // SETUP:
 
-      // This method connects two Rooms by breaking their walls.
+      // This method connects two Rooms by breaking the Wall between them.
       // An exception is thrown if:
       //   One or both Rooms are outside the Labyrinth (domain_error)
       //   The Rooms are not adjacent (logic_error)
       //   The Rooms are the same (logic_error)
       //   The Rooms are already connected (logic_error)
+      //   The Wall between the Rooms is the exit (logic_error)
       void ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 );
 
       // This method sets the primary (initial) spawn Room.
@@ -82,6 +112,20 @@ class Labyrinth
       //     in another room (logic_error)
       void SetItem( Coordinate rm, Item itm );
 
+      // This method scatters the Inhabitants and Items of the population
+      // across random Rooms, in two sequential passes over the Rooms
+      // instead of one SetInhabitant() or SetItem() call per Room. Rooms
+      // are sampled without replacement (selection sampling), so no Room
+      // is ever tried twice and no memory is needed besides the Rooms.
+      // The Labyrinth is not modified if an exception is thrown.
+      // An exception is thrown if:
+      //   There are fewer empty Rooms outside the exclusion zones than
+      //     Inhabitants or Items to place (logic_error)
+      //   The population has a Treasure but the Treasure has already been
+      //     placed (logic_error)
+      void Populate( const LabyrinthPopulation& population,
+                     RandomGenerator& rng );
+
     // PLAY:
 
       // This method returns the current Inhabitant of the Room.
@@ -124,28 +168,146 @@ class Labyrinth
       RoomBorder DirectionCheck( const Coordinate rm,
                                  const Direction d ) const;
 
+    // SIZE:
+
+      // This method returns the number of Rooms along the x-axis.
+      size_t XSize() const;
+
+      // This method returns the number of Rooms along the y-axis.
+      size_t YSize() const;
+
+    // SPECIAL ROOMS AND WALLS:
+
+      // These methods return the spawn Rooms of the Players.
+      Coordinate Spawn1() const;
+      Coordinate Spawn2() const;
+
+      // This method returns true if the exit has been set, and false
+      // otherwise.
+      bool HasExit() const;
+
+      // This method returns the Room which has the exit.
+      // An exception is thrown if:
+      //   The exit has not been set (logic_error)
+      Coordinate ExitRoom() const;
+
+      // This method returns the direction of the exit from its Room.
+      // An exception is thrown if:
+      //   The exit has not been set (logic_error)
+      Direction ExitDirection() const;
+
+      // This method returns the Walls of the Labyrinth, for algorithms
+      // which scan the Walls a bitmap word at a time. The exit is not
+      // part of the WallGrid; its Wall is still set there.
+      const WallGrid& Walls() const;
+
+      // This method returns the contents of the Rooms in row-major order
+      // (the Room at (x, y) is at index y * XSize() + x), for algorithms
+      // which scan every Room.
+      const RoomCell* Cells() const;
+
+    // NON-THROWING:
+    //
+    // These methods behave like the methods of the same name without the
+    // Try prefix, but return a LabyrinthStatus instead of throwing. The
+    // Labyrinth is not modified upon failure.
+
+      // Returns kOutOfBounds, kSameRoom, kNotAdjacent, kAlreadyConnected,
+      // or kExitInTheWay upon failure.
+      LabyrinthStatus TryConnectRooms( const Coordinate rm_1,
+                                       const Coordinate rm_2 );
+
+      // Returns kOutOfBounds, kInvalidDirection, kNotAWall, or
+      // kExitAlreadySet upon failure.
+      LabyrinthStatus TrySetExit( const Coordinate rm, const Direction d );
+
+      // Returns kOutOfBounds, kNullInhabitant, or kOccupied upon failure.
+      LabyrinthStatus TrySetInhabitant( const Coordinate rm,
+                                        const Inhabitant inh );
+
+      // Returns kOutOfBounds, kNullItem, kOccupied, or kTreasureAlreadySet
+      // upon failure.
+      LabyrinthStatus TrySetItem( const Coordinate rm, const Item itm );
+
+      // Returns kOutOfBounds upon failure.
+      LabyrinthResult<Inhabitant>
+        TryGetInhabitant( const Coordinate rm ) const;
+
+      // Returns kOutOfBounds or kNoEnemy upon failure.
+      LabyrinthStatus TryAttackEnemy( const Coordinate rm );
+
+      // Returns kOutOfBounds upon failure.
+      LabyrinthResult<Item> TryItemAt( const Coordinate rm ) const;
+
+      // Returns kOutOfBounds or kNoItem upon failure.
+      LabyrinthStatus TryTakeItem( const Coordinate rm );
+
+      // Returns kOutOfBounds or kTreasureAlreadySet upon failure.
+      LabyrinthStatus TryDropTreasure( const Coordinate rm );
+
+      // Returns kOutOfBounds or kInvalidDirection upon failure.
+      LabyrinthResult<RoomBorder>
+        TryDirectionCheck( const Coordinate rm, const Direction d ) const;
+
+    // UNCHECKED:
+    //
+    // These methods skip the bounds check for Coordinates which are already
+    // known to be within the Labyrinth (e.g. while looping over XSize() by
+    // YSize()). Giving a Room outside the Labyrinth is undefined behaviour.
+
+      Inhabitant GetInhabitantUnchecked( const Coordinate rm ) const;
+
+      Item ItemAtUnchecked( const Coordinate rm ) const;
+
+      // Direction d must not be kNone.
+      RoomBorder DirectionCheckUnchecked( const Coordinate rm,
+                                          const Direction d ) const;
+
+      // Returns kNoEnemy upon failure.
+      LabyrinthStatus AttackEnemyUnchecked( const Coordinate rm );
+
+      // Returns kNoItem upon failure.
+      LabyrinthStatus TakeItemUnchecked( const Coordinate rm );
+
   private:
 
-    std::unique_ptr< std::unique_ptr<Room[]>[] > rooms_;
+    std::unique_ptr<RoomCell[]> rooms_;
     const size_t x_size_;
     const size_t y_size_;
-    const size_t MAX_X_SIZE_ = 20;
-    const size_t MAX_Y_SIZE_ = 20;
+    const size_t room_count_;
+    WallGrid walls_;
 
     // Special rooms:
     //   Should be set before the game begins
     //   Spawns will default to (0, 0) otherwise
     Coordinate spawn_1_;
     Coordinate spawn_2_;
+    Coordinate exit_room_;
+    Direction exit_direction_ = Direction::kNone;
     bool exit_set_ = false;
     bool treasure_set_ = false;  // Is also false when the treasure is held
                                  // by a Player
 
-    // This private method returns a reference to the Room at the given
-    // coordinate.
+    // This private method returns true if the Room is within an exclusion
+    // zone of the population, and false otherwise.
+    bool IsExcluded( const Coordinate rm,
+                     const LabyrinthPopulation& population ) const;
+
+    // This private method returns the number of Rooms in a Labyrinth of
+    // the given size.
     // An exception is thrown if:
-    //   The Room is outside the Labyrinth (domain_error)
-    Room& RoomAt( const Coordinate rm ) const;
+    //   A size of 0 is given (domain_error)
+    //   The number of Rooms overflows a size_t (domain_error)
+    static size_t RoomCount( const size_t x_size, const size_t y_size );
+
+    // This private method returns a reference to the contents of the Room
+    // at the given coordinate.
+    // Bounds are not checked; the Coordinate must be within the Labyrinth.
+    RoomCell& CellAt( const Coordinate rm ) const;
+
+    // This private method returns the index of the given Room in rooms_.
+    // Bounds are not checked; the Coordinate must be within the Labyrinth.
+    size_t IndexOf( const Coordinate rm ) const;
 
     // This private method returns true if the Room is within the bounds of
     // the Labyrinth, and false otherwise.
@@ -158,4 +320,11 @@ class Labyrinth
     //   The same Room is given twice (logic_error)
     bool IsAdjacent( const Coordinate rm_1, const Coordinate rm_2 ) const;
 
+    // This private method returns the Direction from rm_1 to rm_2 if the
+    // two Rooms are adjacent, or kNone otherwise (including if they are
+    // the same).
+    // Bounds are not checked.
+    static Direction DirectionBetween( const Coordinate rm_1,
+                                       const Coordinate rm_2 );
+
 };
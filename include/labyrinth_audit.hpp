@@ -0,0 +1,119 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthAudit class, which checks the
+ * structural invariants of a Labyrinth, or of a grid of Rooms, on a pool
+ * of threads.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "coordinate.hpp"
+#include "room.hpp"
+#include "labyrinth.hpp"
+
+// The invariants which an audit checks
+enum class AuditCheck
+{
+  kAsymmetricWall,     // The Room and its neighbour to the east or south
+                       // disagree on the Wall between them
+  kMissingOuterWall,   // The Room opens onto the outside of the grid
+                       // other than through the exit
+  kInteriorExit,       // The exit leads to another Room
+  kExtraExit,          // An exit after the first, in row-major order
+  kExtraTreasure,      // A Treasure after the first, in row-major order
+  kInvalidInhabitant,  // The Inhabitant is not a valid enumerator
+  kPaddingCleared,     // A padding bit of a Wall bitmap row is cleared;
+                       // the Room is (0, y) of the row
+};
+
+// One broken invariant. The direction is the Wall or exit concerned, or
+// kNone if the violation is not about a Wall.
+struct AuditViolation
+{
+  Coordinate room;
+  AuditCheck check;
+  Direction direction;
+};
+
+// A LabyrinthAudit checks every invariant which the Labyrinth and Room
+// interfaces are meant to guarantee, so that mazes which were loaded or
+// built by other code can be checked before they are played:
+//   Each Wall between two Rooms is either broken or intact on both sides
+//   Every Wall on the outside of the grid is intact, except the exit
+//   There is at most one exit, and it is on the outside of the grid
+//   There is at most one Treasure
+//   Every Inhabitant is a valid enumerator
+//
+// A Labyrinth stores each Wall once in a WallGrid and its exit separately,
+// so its Walls cannot disagree and it cannot hold two exits; its audit
+// checks the Wall bitmaps themselves instead (outer Walls and padding bits
+// set), along with the exit, Treasure, and Inhabitants. A grid of packed
+// Rooms stores each Wall twice, once in each Room, and is checked in full.
+//
+// The rows are split into one band per thread, and each thread collects
+// the violations of its band; the violations are then sorted by Room, so
+// the result does not depend on the number of threads. Bands are never
+// smaller than kMinRoomsPerThread Rooms, so small grids use fewer threads.
+class LabyrinthAudit
+{
+  public:
+
+    static constexpr size_t kMinRoomsPerThread = size_t( 1 ) << 16;
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // A thread count of 0 uses one thread per hardware thread.
+      explicit LabyrinthAudit( const size_t thread_count = 0 );
+
+    // AUDITING:
+
+      // This method checks the Labyrinth and returns its violations, sorted
+      // by Room (row-major) and then by check. The violations are valid
+      // until the next audit.
+      // An exception is thrown if:
+      //   There is not enough memory for the violations (bad_alloc)
+      //   A thread cannot be started (system_error)
+      const std::vector<AuditViolation>& Audit( const Labyrinth& l );
+
+      // This method checks a grid of x_size by y_size packed Rooms, stored
+      // row-major (index y * x_size + x), and returns its violations as
+      // above.
+      // An exception is thrown if:
+      //   The Rooms are null (invalid_argument)
+      //   A size of 0 is given (domain_error)
+      //   The number of Rooms overflows a size_t (domain_error)
+      //   There is not enough memory for the violations (bad_alloc)
+      //   A thread cannot be started (system_error)
+      const std::vector<AuditViolation>& Audit( const Room* const rooms,
+                                                const size_t x_size,
+                                                const size_t y_size );
+
+    // This method returns the number of threads which an audit may use.
+    size_t ThreadCount() const;
+
+  private:
+
+    const size_t thread_count_;
+    std::vector<AuditViolation> violations_;
+
+    // This private method splits y_size rows of x_size Rooms into bands,
+    // calls check( y_start, y_end, violations ) once per band on the
+    // threads, and gathers and sorts the violations into violations_.
+    // Each band's Treasures and exits are reported as kExtraTreasure and
+    // kExtraExit by check(); all but the first of them in row-major order
+    // are kept.
+    template <typename Check>
+    void RunBands( const size_t x_size,
+                   const size_t y_size,
+                   const Check& check );
+};
@@ -0,0 +1,38 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the implementation of a LabyrinthLayout
+ * struct, a complete description of a Labyrinth's Walls and contents which
+ * can be loaded in a single pass.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "room_properties.hpp"
+
+// The Walls use the bitmap layout of a WallGrid: each row holds
+// ((x_size + 63) / 64) 64-bit words, and bit (x % 64) of word (x / 64) of
+// row y is set if the Room at (x, y) has a Wall to the east (east_walls)
+// or to the south (south_walls). Padding bits beyond x_size are ignored.
+//
+// inhabitants and items hold one entry per Room in row-major order
+// (index y * x_size + x), or are left empty for a Labyrinth without
+// Inhabitants or Items.
+struct LabyrinthLayout
+{
+  size_t x_size = 0;
+  size_t y_size = 0;
+
+  std::vector<uint64_t> east_walls;
+  std::vector<uint64_t> south_walls;
+
+  std::vector<Inhabitant> inhabitants;
+  std::vector<Item> items;
+};
@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-02-01
+ * Last edited: 2026-10-18
  *
  * This C++ header file contains classes related to creating a LabyrinthMap
  * which creates, updates, and displays a map of a given Labyrinth.
@@ -12,6 +12,7 @@
 
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <memory>
 
 #include "coordinate.hpp"
@@ -205,6 +206,7 @@ class LabyrinthMap
     // An exception is thrown if:
     //   l is null (invalid_argument)
     //   A size of 0 is given (domain_error)
+    //   A size is too large for the Map to be indexed (domain_error)
     LabyrinthMap( const Labyrinth* const l,
                   const size_t x_size,
                   const size_t y_size );
@@ -227,6 +229,11 @@ class LabyrinthMap
     const size_t map_x_size_;
     const size_t map_y_size_;
 
+    // Largest x or y size for which the Map size (size * 2 + 1) still fits
+    // in a size_t.
+    static constexpr size_t kMaxMapRooms =
+      ( std::numeric_limits<size_t>::max() - 1 ) / 2;
+
     // This private method returns true if the Coordinate is within the bounds
     // of the Map, and false otherwise.
     bool WithinBoundsOfMap( const Coordinate c ) const;
@@ -0,0 +1,34 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the implementation of a LabyrinthPopulation
+ * struct, which describes the Inhabitants and Items to scatter across a
+ * Labyrinth at random.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+// Each Inhabitant is placed in a different Room which has no Inhabitant,
+// and each Item in a different Room which has no Item; a Room may receive
+// both an Inhabitant and an Item.
+//
+// Exclusion zones keep the area around the spawns and the exit empty:
+// a Room is excluded if it is at most exclusion_radius Rooms away from an
+// excluded Room along both the x-axis and the y-axis (a square zone). With
+// a radius of 0, only the excluded Rooms themselves are left empty.
+struct LabyrinthPopulation
+{
+  size_t minotaurs = 0;
+  size_t mirrors = 0;
+  size_t bullets = 0;
+  bool treasure = false;
+
+  size_t exclusion_radius = 0;
+  bool exclude_spawns = false;
+  bool exclude_exit = false;  // Has no effect if the exit is not set
+};
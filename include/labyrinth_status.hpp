@@ -0,0 +1,53 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the status codes and result type returned
+ * by the non-throwing methods of the Labyrinth class.
+ *
+ */
+
+#pragma once
+
+// Each status other than kOk corresponds to an exception thrown by the
+// equivalent throwing method of the Labyrinth.
+enum class LabyrinthStatus
+{
+  kOk,
+
+  // domain_error
+  kOutOfBounds,        // A Room is outside the Labyrinth
+
+  // invalid_argument
+  kInvalidDirection,   // Direction::kNone was given
+  kNullInhabitant,     // Inhabitant::kNone was given
+  kNullItem,           // Item::kNone was given
+  kNotAWall,           // The exit was set on a border with another Room
+  kNoEnemy,            // There is no live Minotaur or intact Mirror
+
+  // logic_error
+  kNotAdjacent,        // The Rooms are not adjacent
+  kSameRoom,           // The same Room was given twice
+  kAlreadyConnected,   // The Rooms are already connected
+  kExitInTheWay,       // The Wall between the Rooms is the exit
+  kExitAlreadySet,     // The exit has already been set
+  kOccupied,           // The Inhabitant or Item has already been set
+  kTreasureAlreadySet, // The Treasure is already in a Room
+  kNoItem,             // There is no Item to take
+};
+
+// This struct holds the value of a non-throwing query, which is only
+// meaningful if status is LabyrinthStatus::kOk.
+template <typename T>
+struct LabyrinthResult
+{
+  LabyrinthStatus status;
+  T value;
+
+  // This method returns true if the query succeeded.
+  bool Ok() const
+  {
+    return status == LabyrinthStatus::kOk;
+  }
+};
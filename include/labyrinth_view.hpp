@@ -0,0 +1,168 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LabyrinthView class, the read-only
+ * interface which the search and validation algorithms share between a
+ * Labyrinth and a FixedLabyrinth.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "room_properties.hpp"
+#include "room_cell.hpp"
+#include "coordinate.hpp"
+#include "wall_grid.hpp"
+#include "labyrinth.hpp"
+
+// A LabyrinthView refers to the Walls, Rooms, and special Rooms of a
+// Labyrinth without owning them; it is only valid while the Labyrinth it
+// refers to exists and keeps its size.
+//
+// The Walls use the bitmap layout of a WallGrid, with the rows of each
+// bitmap stored one after another, so that EastRow(0) + y * WordsPerRow()
+// is row y. The Rooms are stored row-major (index y * x_size + x).
+//
+// Both a Labyrinth and a FixedLabyrinth convert implicitly to a view, so
+// an algorithm which takes a const LabyrinthView& accepts either one.
+class LabyrinthView
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Conversion constructor
+      // This constructor refers to the Walls and Rooms of the Labyrinth.
+      LabyrinthView( const Labyrinth& l ) :
+        x_size_(l.XSize()),
+        y_size_(l.YSize()),
+        words_per_row_(l.Walls().WordsPerRow()),
+        east_(l.Walls().EastRow(0)),
+        south_(l.Walls().SouthRow(0)),
+        rooms_(l.Cells()),
+        spawn_1_(l.Spawn1()),
+        spawn_2_(l.Spawn2()),
+        exit_room_(l.HasExit() ? l.ExitRoom() : Coordinate(0, 0)),
+        exit_set_(l.HasExit())
+      {
+      }
+
+      // Parameterized constructor
+      // This constructor refers to Walls and Rooms stored elsewhere in the
+      // layout described above, with WallGrid::WordsPerRow( x_size ) words
+      // per bitmap row. Nothing is checked.
+      LabyrinthView( const size_t x_size,
+                     const size_t y_size,
+                     const uint64_t* const east,
+                     const uint64_t* const south,
+                     const RoomCell* const rooms,
+                     const Coordinate spawn_1,
+                     const Coordinate spawn_2,
+                     const bool exit_set,
+                     const Coordinate exit_room ) :
+        x_size_(x_size),
+        y_size_(y_size),
+        words_per_row_(WallGrid::WordsPerRow(x_size)),
+        east_(east),
+        south_(south),
+        rooms_(rooms),
+        spawn_1_(spawn_1),
+        spawn_2_(spawn_2),
+        exit_room_(exit_room),
+        exit_set_(exit_set)
+      {
+      }
+
+    // SIZE:
+
+      // These methods return the number of Rooms along each axis.
+      size_t XSize() const
+      {
+        return x_size_;
+      }
+
+      size_t YSize() const
+      {
+        return y_size_;
+      }
+
+    // SPECIAL ROOMS AND WALLS:
+
+      // These methods return the spawn Rooms of the Players.
+      Coordinate Spawn1() const
+      {
+        return spawn_1_;
+      }
+
+      Coordinate Spawn2() const
+      {
+        return spawn_2_;
+      }
+
+      // This method returns true if the exit has been set, and false
+      // otherwise.
+      bool HasExit() const
+      {
+        return exit_set_;
+      }
+
+      // This method returns the Room which has the exit.
+      // An exception is thrown if:
+      //   The exit has not been set (logic_error)
+      Coordinate ExitRoom() const
+      {
+        if( !exit_set_ )
+        {
+          throw std::logic_error( "Error: ExitRoom() was called, but the "\
+            "exit has not been set.\n" );
+        }
+        return exit_room_;
+      }
+
+      // This method returns the number of 64-bit words in each bitmap row.
+      size_t WordsPerRow() const
+      {
+        return words_per_row_;
+      }
+
+      // These methods return the first word of row y of the east and south
+      // Wall bitmaps, respectively. The exit's Wall is still set there.
+      // Bounds are not checked; y must be less than the y size.
+      const uint64_t* EastRow( const size_t y ) const
+      {
+        return east_ + y * words_per_row_;
+      }
+
+      const uint64_t* SouthRow( const size_t y ) const
+      {
+        return south_ + y * words_per_row_;
+      }
+
+    // UNCHECKED:
+
+      // This method returns the current Item in the given Room.
+      // Bounds are not checked.
+      Item ItemAtUnchecked( const Coordinate rm ) const
+      {
+        return rooms_[rm.y * x_size_ + rm.x].GetItem();
+      }
+
+  private:
+
+    size_t x_size_;
+    size_t y_size_;
+    size_t words_per_row_;
+    const uint64_t* east_;
+    const uint64_t* south_;
+    const RoomCell* rooms_;
+    Coordinate spawn_1_;
+    Coordinate spawn_2_;
+    Coordinate exit_room_;
+    bool exit_set_;
+};
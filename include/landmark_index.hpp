@@ -0,0 +1,94 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LandmarkIndex class, which holds the
+ * distances of every Room of a Labyrinth from a few landmark Rooms, for
+ * guiding shortest-path searches.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_view.hpp"
+
+// A LandmarkIndex holds the distance of every Room of a Labyrinth from
+// each of a few landmark Rooms. By the triangle inequality, a path from
+// Room a to Room b is at least |d(L, a) - d(L, b)| Rooms long for every
+// landmark L, which in a maze is a far better estimate than the Manhattan
+// distance; PathFinder::Path() takes a LandmarkIndex to guide its search
+// with it (ALT search: A*, landmarks, and the triangle inequality).
+//
+// The landmarks are chosen one at a time as the Room farthest from all
+// those already chosen, beginning with the Room farthest from the middle
+// of the Labyrinth, so that they lie on the edges of the Labyrinth and of
+// each part which cannot be reached from the others. Building the index
+// costs one breadth-first search of the Labyrinth per landmark, plus one.
+//
+// The distances take LandmarkCount() 32-bit numbers per Room, kept
+// together for each Room so that a search reads one cache line per Room.
+// The index describes the Labyrinth as it was built: it must be built
+// again after Walls are broken, or searches may not find shortest paths.
+class LandmarkIndex
+{
+  public:
+
+    // The greatest number of landmarks
+    static constexpr size_t kMaxLandmarks = 16;
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Default constructor
+      // No landmarks are held until Build() is called.
+      LandmarkIndex();
+
+    // INDEX:
+
+      // This method chooses the given number of landmarks and finds the
+      // distance of every Room from each.
+      // An exception is thrown if:
+      //   The count is 0 or greater than kMaxLandmarks (domain_error)
+      //   The Labyrinth has 2^32 or more Rooms (domain_error)
+      //   There is not enough memory for the distances (bad_alloc)
+      void Build( const LabyrinthView& l, const size_t count );
+
+      // This method returns the number of landmarks, or 0 if nothing has
+      // been built.
+      size_t LandmarkCount() const;
+
+      // This method returns the Room of the given landmark.
+      // An exception is thrown if:
+      //   There is no landmark with the given number (domain_error)
+      Coordinate Landmark( const size_t i ) const;
+
+      // This method returns the distances of every Room from each
+      // landmark, or nullptr if nothing has been built. The distance of
+      // the Room at index (y * x_size + x) from landmark k is found at
+      // index (y * x_size + x) * LandmarkCount() + k, and is
+      // DistanceField::kUnreachable if the Room cannot be reached from
+      // the landmark. The array is valid until the next Build().
+      const uint32_t* Distances() const;
+
+      // This method returns the number of bytes of memory held by the
+      // index.
+      size_t MemoryUsage() const;
+
+      // These methods return the size of the indexed Labyrinth, or 0 if
+      // nothing has been built.
+      size_t XSize() const;
+      size_t YSize() const;
+
+  private:
+
+    std::vector<uint32_t> distances_;
+    std::vector<Coordinate> landmarks_;
+    size_t x_size_ = 0;
+    size_t y_size_ = 0;
+};
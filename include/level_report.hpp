@@ -0,0 +1,52 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LevelReport struct, which describes
+ * the connected regions of a Labyrinth and whether its special Rooms can
+ * reach one another.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "coordinate.hpp"
+
+// The Rooms which a playable Labyrinth must join together
+enum class SpecialRoom
+{
+  kSpawn1,
+  kSpawn2,
+  kTreasure,  // The Room which holds the Treasure
+  kExit,      // The Room with the exit
+};
+
+// A region is a set of Rooms which can all reach one another through
+// broken Walls, and no other Room.
+struct LevelRegion
+{
+  Coordinate room;  // One Room of the region
+  size_t size;      // Number of Rooms
+};
+
+// A LevelReport is playable if the Treasure and the exit are both in
+// Rooms, and every special Room can be reached from the primary spawn.
+struct LevelReport
+{
+  std::vector<LevelRegion> regions;      // Largest first
+  size_t isolated_rooms = 0;             // Regions of a single Room
+
+  std::vector<SpecialRoom> missing;      // Special Rooms which are not set
+  std::vector<SpecialRoom> unreachable;  // Special Rooms which cannot be
+                                         // reached from the primary spawn
+
+  // This method returns true if the Labyrinth is playable.
+  bool Playable() const
+  {
+    return missing.empty() && unreachable.empty();
+  }
+};
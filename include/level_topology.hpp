@@ -0,0 +1,130 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LevelTopology class, the read-only
+ * part of a level which any number of games can share.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "room_properties.hpp"
+#include "room_cell.hpp"
+#include "coordinate.hpp"
+#include "wall_grid.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_view.hpp"
+
+// A LevelTopology is a copy of a Labyrinth which never changes: its Walls,
+// exit, and spawns, and the Inhabitants and Items which every game of the
+// level starts with. Games which share a level hold it through a
+// std::shared_ptr<const LevelTopology>, and keep what they change in a
+// RoomOverlay of their own, so the Walls are stored once however many
+// games are played.
+//
+// A LevelTopology converts to a LabyrinthView, so the search and
+// validation algorithms accept it.
+class LevelTopology
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // This constructor copies the Labyrinth as it is now.
+      // An exception is thrown if:
+      //   There is not enough memory for the copy (bad_alloc)
+      explicit LevelTopology( const Labyrinth& l );
+
+    // SIZE:
+
+      // These methods return the number of Rooms along each axis.
+      size_t XSize() const;
+      size_t YSize() const;
+
+    // SPECIAL ROOMS AND WALLS:
+
+      // These methods return the spawn Rooms of the Players.
+      Coordinate Spawn1() const;
+      Coordinate Spawn2() const;
+
+      // This method returns true if the exit has been set, and false
+      // otherwise.
+      bool HasExit() const;
+
+      // This method returns the Room which has the exit.
+      // An exception is thrown if:
+      //   The exit has not been set (logic_error)
+      Coordinate ExitRoom() const;
+
+      // This method returns true if a Room starts with the Treasure, and
+      // false otherwise.
+      bool HasTreasure() const;
+
+      // This method returns the type of RoomBorder in the given direction.
+      // An exception is thrown if:
+      //   The Room is outside the level (domain_error)
+      //   Direction d is kNone (invalid_argument)
+      RoomBorder DirectionCheck( const Coordinate rm,
+                                 const Direction d ) const;
+
+      // This method returns a view of the level for the search and
+      // validation algorithms, with the Inhabitants and Items which
+      // games start with.
+      operator LabyrinthView() const;
+
+    // UNCHECKED:
+    //
+    // These methods skip the bounds check, like those of the Labyrinth.
+    // The Inhabitants and Items are those which games start with.
+
+      Inhabitant GetInhabitantUnchecked( const Coordinate rm ) const;
+
+      Item ItemAtUnchecked( const Coordinate rm ) const;
+
+      // Direction d must not be kNone.
+      RoomBorder DirectionCheckUnchecked( const Coordinate rm,
+                                          const Direction d ) const;
+
+      // This method returns the index of the Room in row-major order.
+      size_t IndexOf( const Coordinate rm ) const;
+
+      // This method returns the starting contents of the Room at the
+      // given row-major index.
+      RoomCell CellAt( const size_t index ) const;
+
+  private:
+
+    const size_t x_size_;
+    const size_t y_size_;
+    WallGrid walls_;
+    std::unique_ptr<RoomCell[]> rooms_;
+
+    Coordinate spawn_1_;
+    Coordinate spawn_2_;
+    Coordinate exit_room_;
+    Direction exit_direction_ = Direction::kNone;
+    bool exit_set_ = false;
+    bool treasure_set_ = false;
+};
+
+// The methods below are called on every read of a RoomOverlay, so they
+// are defined here to be inlined.
+
+// This method returns the index of the Room in row-major order.
+inline size_t LevelTopology::IndexOf( const Coordinate rm ) const
+{
+  return rm.y * x_size_ + rm.x;
+}
+
+// This method returns the starting contents of the Room at the
+// given row-major index.
+inline RoomCell LevelTopology::CellAt( const size_t index ) const
+{
+  return rooms_[index];
+}
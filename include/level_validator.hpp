@@ -0,0 +1,77 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the LevelValidator class, which finds the
+ * connected regions of a Labyrinth with a union-find and checks that it
+ * is playable.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_view.hpp"
+#include "level_report.hpp"
+
+// A LevelValidator finds the regions of a Labyrinth (the sets of Rooms
+// joined by broken Walls) by merging the two Rooms of every broken Wall
+// in a union-find, and reports whether the spawns, the Room of the
+// Treasure, and the Room of the exit all lie in one region. The exit
+// does not lead to a Room and joins nothing.
+//
+// The union-find merges the smaller set into the larger and halves paths
+// as it follows them, so it takes near-linear time; broken Walls are
+// found a bitmap word of the WallGrid at a time. The LevelValidator keeps
+// its arrays and report between Labyrinths, so that validating each level
+// of a batch of the same size does not allocate memory.
+class LevelValidator
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Default constructor
+      LevelValidator();
+
+    // VALIDATION:
+
+      // This method finds the regions of the Labyrinth and checks its
+      // special Rooms. The report is valid until the next validation.
+      // An exception is thrown if:
+      //   The Labyrinth has 2^32 or more Rooms (domain_error)
+      //   There is not enough memory for the regions (bad_alloc)
+      const LevelReport& Validate( const LabyrinthView& l );
+
+      // This method returns true if the two Rooms were in the same region
+      // of the last validated Labyrinth, and false otherwise.
+      // An exception is thrown if:
+      //   Nothing has been validated (logic_error)
+      //   A Room is outside the validated Labyrinth (domain_error)
+      bool Connected( const Coordinate rm_1, const Coordinate rm_2 ) const;
+
+  private:
+
+    std::vector<uint32_t> parent_;  // One per Room; a root is its own parent
+    std::vector<uint32_t> size_;    // One per Room; valid for roots
+    LevelReport report_;
+    size_t x_size_ = 0;
+    size_t y_size_ = 0;
+
+    // This private method returns the root of the set of the Room,
+    // halving the path to it.
+    uint32_t Find( uint32_t i );
+
+    // This private method returns the root of the set of the Room,
+    // leaving the sets unchanged.
+    uint32_t FindConst( uint32_t i ) const;
+
+    // This private method merges the sets of the two Rooms.
+    void Merge( const uint32_t i, const uint32_t j );
+};
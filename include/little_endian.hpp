@@ -0,0 +1,80 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the little-endian words and headers shared
+ * by the binary formats of the maze streams and the command journals. It
+ * is used by their implementations, and is not part of the interface of
+ * either.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+// The length of the magic which begins each binary format, identifying
+// the format and its version
+constexpr size_t kMagicLength = 8;
+
+// This function stores a 64-bit word as 8 little-endian bytes.
+inline void EncodeWord( const uint64_t word, char* const bytes )
+{
+  for( size_t i = 0; i < 8; ++i )
+  {
+    bytes[i] = static_cast<char>( (word >> (i * 8)) & 0xFF );
+  }
+}
+
+// This function returns the 64-bit word stored as 8 little-endian bytes.
+inline uint64_t DecodeWord( const char* const bytes )
+{
+  uint64_t word = 0;
+  for( size_t i = 0; i < 8; ++i )
+  {
+    word |= uint64_t( static_cast<unsigned char>(bytes[i]) ) << (i * 8);
+  }
+  return word;
+}
+
+// This function writes a header of the magic followed by the words.
+// Returns false if the stream cannot be written, and true otherwise.
+template <size_t kWordCount>
+bool WriteHeader( std::ostream& out,
+                  const char (&magic)[kMagicLength + 1],
+                  const uint64_t (&words)[kWordCount] )
+{
+  char header[kMagicLength + kWordCount * 8];
+  std::memcpy( header, magic, kMagicLength );
+  for( size_t i = 0; i < kWordCount; ++i )
+  {
+    EncodeWord( words[i], header + kMagicLength + i * 8 );
+  }
+  return static_cast<bool>( out.write(header, sizeof(header)) );
+}
+
+// This function reads a header of the magic followed by the words.
+// Returns false if the stream ends first or does not begin with the
+// magic, and true otherwise.
+template <size_t kWordCount>
+bool ReadHeader( std::istream& in,
+                 const char (&magic)[kMagicLength + 1],
+                 uint64_t (&words)[kWordCount] )
+{
+  char header[kMagicLength + kWordCount * 8];
+  if( !in.read(header, sizeof(header)) ||
+      std::memcmp(header, magic, kMagicLength) != 0 )
+  {
+    return false;
+  }
+  for( size_t i = 0; i < kWordCount; ++i )
+  {
+    words[i] = DecodeWord( header + kMagicLength + i * 8 );
+  }
+  return true;
+}
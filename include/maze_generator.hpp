@@ -0,0 +1,106 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the MazeGenerator class, which carves a
+ * random maze into a Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "random_generator.hpp"
+
+enum class MazeAlgorithm
+{
+  kRecursiveBacktracker,
+  kKruskal,
+  kPrim,
+  kWilson,
+};
+
+// A MazeGenerator carves a perfect maze (one in which every Room can be
+// reached from every other Room by exactly one path) into a Labyrinth by
+// breaking Walls with ConnectRooms().
+//
+// Rooms are handled by their row-major index (y * x_size + x) within the
+// region being generated, so that the working state of every algorithm is
+// a handful of flat arrays:
+//   Recursive backtracker: 1 bit per Room, plus an explicit stack of up to
+//     one index per Room
+//   Kruskal:               every interior Wall (about 2 indices per Room)
+//     plus a union-find forest (1 index and 1 byte per Room)
+//   Prim:                  1 byte per Room, plus a frontier of up to one
+//     index per Room
+//   Wilson:                1 byte per Room
+//
+// Two generators with the same algorithm and seed produce the same
+// sequence of mazes.
+class MazeGenerator
+{
+  public:
+
+    // Parameterized constructor
+    MazeGenerator( const MazeAlgorithm algorithm, const uint64_t seed );
+
+    // Parameterized constructor
+    // The generator continues the given random stream.
+    MazeGenerator( const MazeAlgorithm algorithm,
+                   const RandomGenerator& rng );
+
+    // This method carves a maze into the Labyrinth.
+    // The Labyrinth should have every interior Wall intact (as it is when
+    // constructed) and no exit; Walls which cannot be broken are skipped,
+    // in which case the maze will not be perfect.
+    // An exception is thrown if:
+    //   The algorithm is not a valid MazeAlgorithm (invalid_argument)
+    //   There is not enough memory for the working state (bad_alloc)
+    void Generate( Labyrinth& l );
+
+    // This method carves a maze into the x_size by y_size region of the
+    // Labyrinth whose top left Room is top_left, breaking only the Walls
+    // between Rooms of the region.
+    // The requirements of Generate() apply to the region.
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    //   The region is not entirely within the Labyrinth (domain_error)
+    //   The algorithm is not a valid MazeAlgorithm (invalid_argument)
+    //   There is not enough memory for the working state (bad_alloc)
+    void GenerateRegion( Labyrinth& l,
+                         const Coordinate top_left,
+                         const size_t x_size,
+                         const size_t y_size );
+
+  private:
+
+    const MazeAlgorithm algorithm_;
+    RandomGenerator rng_;
+
+    // The region being generated; Rooms are indexed within it
+    Coordinate origin_;
+    size_t x_size_ = 0;
+    size_t y_size_ = 0;
+
+    // These private methods carve a maze with each algorithm.
+    void RecursiveBacktracker( Labyrinth& l );
+    void Kruskal( Labyrinth& l );
+    void Prim( Labyrinth& l );
+    void Wilson( Labyrinth& l );
+
+    // This private method connects the two adjacent Rooms of the region
+    // with the given indices.
+    void Connect( Labyrinth& l, const size_t rm_1, const size_t rm_2 ) const;
+
+    // This private method stores the indices of the Rooms adjacent to the
+    // Room with index rm in neighbours, and returns how many there are.
+    static size_t Neighbours( const size_t rm,
+                              const size_t x_size,
+                              const size_t y_size,
+                              size_t (&neighbours)[4] );
+};
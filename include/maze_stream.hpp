@@ -0,0 +1,119 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the MazeStreamWriter and MazeStreamReader
+ * classes, which write and read the Walls of a Labyrinth one row at a time
+ * in a streaming binary format.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "labyrinth_layout.hpp"
+
+// The streaming format consists of a header followed by the rows of the
+// Labyrinth from y = 0 downwards, so that a maze can be written and read
+// without ever holding more than one row in memory:
+//   Header:  the 8 bytes "LABYROW1", then x_size and y_size
+//   Each row: the east Wall words of the row, then the south Wall words
+// Every number is a 64-bit little-endian unsigned integer, and each row
+// uses the bitmap layout of a WallGrid (WallGrid::WordsPerRow(x_size)
+// words per bitmap).
+
+// A MazeStreamWriter writes the header upon construction and one row per
+// call to WriteRow().
+class MazeStreamWriter
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    //   The header cannot be written (runtime_error)
+    MazeStreamWriter( std::ostream& out,
+                      const size_t x_size,
+                      const size_t y_size );
+
+    // This method writes the next row, given as WordsPerRow() east Wall
+    // words and WordsPerRow() south Wall words.
+    // An exception is thrown if:
+    //   Every row has already been written (logic_error)
+    //   The row cannot be written (runtime_error)
+    void WriteRow( const uint64_t* const east, const uint64_t* const south );
+
+    // These methods return the size of the Labyrinth being written.
+    size_t XSize() const;
+    size_t YSize() const;
+
+    // This method returns the number of 64-bit words in each bitmap row.
+    size_t WordsPerRow() const;
+
+    // This method returns the number of rows written so far.
+    size_t RowsWritten() const;
+
+  private:
+
+    std::ostream& out_;
+    const size_t x_size_;
+    const size_t y_size_;
+    const size_t words_per_row_;
+    size_t rows_written_ = 0;
+
+    // Holds one encoded row
+    std::vector<char> buffer_;
+};
+
+// A MazeStreamReader reads the header upon construction and one row per
+// call to ReadRow().
+class MazeStreamReader
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   The header is missing or invalid (runtime_error)
+    //   The number of Rooms (x size * y size) in the header overflows a
+    //     size_t (domain_error)
+    explicit MazeStreamReader( std::istream& in );
+
+    // This method reads the next row into WordsPerRow() east Wall words
+    // and WordsPerRow() south Wall words, and returns true, or returns
+    // false if every row has already been read.
+    // An exception is thrown if:
+    //   The stream ends in the middle of the rows (runtime_error)
+    bool ReadRow( uint64_t* const east, uint64_t* const south );
+
+    // This method reads every row into a LabyrinthLayout without
+    // Inhabitants or Items, which can be used to construct a Labyrinth.
+    // An exception is thrown if:
+    //   A row has already been read (logic_error)
+    //   The stream ends in the middle of the rows (runtime_error)
+    //   There is not enough memory for the layout (bad_alloc)
+    LabyrinthLayout ReadLayout();
+
+    // These methods return the size of the Labyrinth in the stream.
+    size_t XSize() const;
+    size_t YSize() const;
+
+    // This method returns the number of 64-bit words in each bitmap row.
+    size_t WordsPerRow() const;
+
+  private:
+
+    std::istream& in_;
+    size_t x_size_ = 0;
+    size_t y_size_ = 0;
+    size_t words_per_row_ = 0;
+    size_t rows_read_ = 0;
+
+    // Holds one encoded row
+    std::vector<char> buffer_;
+};
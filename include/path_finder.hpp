@@ -0,0 +1,129 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the PathFinder class, which finds
+ * shortest paths between Rooms of a Labyrinth with A* search.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+#include "labyrinth.hpp"
+#include "labyrinth_view.hpp"
+#include "landmark_index.hpp"
+#include "room_layout.hpp"
+
+// A PathFinder finds a shortest path between two Rooms of a Labyrinth
+// through broken Walls, with A* search guided by the Manhattan distance.
+// The exit does not lead to a Room and is never crossed. With a
+// LandmarkIndex, the search is guided by the landmark distances as well,
+// which in a maze expands far fewer Rooms.
+//
+// A PathFinder is the workspace of its searches: it keeps the open list,
+// the cost of reaching each Room, and the Room each was reached from
+// between searches, and after each search resets only the Rooms it
+// touched. A caller which keeps one PathFinder per thread (e.g. one per
+// bot) therefore does not allocate memory once the PathFinder has grown
+// to the size of the Labyrinth and the longest path, and a short search
+// costs the same in any size of Labyrinth. The per-Room arrays may be kept
+// in Morton order, which keeps a search within fewer cache lines and pages
+// in large Labyrinths (see MortonLayout).
+class PathFinder
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // The order is the order of the per-Room arrays of the workspace.
+      explicit PathFinder( const RoomOrder order = RoomOrder::kRowMajor );
+
+    // SEARCH:
+
+      // This method returns a shortest path from one Room to another,
+      // beginning with from and ending with to, or an empty path if to
+      // cannot be reached from from. The path is valid until the next
+      // search.
+      // An exception is thrown if:
+      //   A Room is outside the Labyrinth (domain_error)
+      //   The Labyrinth has 2^32 or more Rooms, or needs as many in
+      //     Morton order (domain_error)
+      //   There is not enough memory for the search (bad_alloc)
+      const std::vector<Coordinate>& Path( const LabyrinthView& l,
+                                           const Coordinate from,
+                                           const Coordinate to );
+
+      // This method returns a shortest path from one Room to another as
+      // above, guided by the landmarks of the index, which must have
+      // been built from the Labyrinth with its current Walls.
+      // An exception is thrown if:
+      //   A Room is outside the Labyrinth (domain_error)
+      //   The index was not built from a Labyrinth of the same size
+      //     (invalid_argument)
+      //   The Labyrinth has 2^32 or more Rooms, or needs as many in
+      //     Morton order (domain_error)
+      //   There is not enough memory for the search (bad_alloc)
+      const std::vector<Coordinate>& Path( const LabyrinthView& l,
+                                           const LandmarkIndex& landmarks,
+                                           const Coordinate from,
+                                           const Coordinate to );
+
+      // This method returns the number of Rooms expanded by the last
+      // search.
+      size_t ExpandedCount() const;
+
+  private:
+
+    // An entry of the open list
+    struct OpenRoom
+    {
+      uint32_t g;      // Cost so far
+      uint32_t index;  // Index of the Room, in the order of the workspace
+    };
+
+    // The cost of a Room which has not been reached
+    static constexpr uint32_t kUnreached = UINT32_MAX;
+
+    const RoomOrder order_;
+    std::vector<uint32_t> cost_;      // One per Room; kUnreached between
+                                      // searches
+    std::vector<uint32_t> parent_;    // One per Room; valid if reached
+    std::vector<uint32_t> touched_;   // Rooms whose cost has been set
+    std::vector<OpenRoom> open_;      // Rooms with the least f
+    std::vector<OpenRoom> open_next_; // Rooms with f 2 more than that
+    std::vector<Coordinate> path_;
+    size_t expanded_count_ = 0;
+
+    // This private method checks the Rooms, runs the search guided by
+    // the landmarks (if not null), and returns the path.
+    const std::vector<Coordinate>& Find( const LabyrinthView& l,
+                                         const LandmarkIndex* const landmarks,
+                                         const Coordinate from,
+                                         const Coordinate to );
+
+    // This private method runs the search and fills path_.
+    void Search( const LabyrinthView& l,
+                 const LandmarkIndex* const landmarks,
+                 const Coordinate from,
+                 const Coordinate to );
+
+    // This private method runs the search with the given layout of the
+    // per-Room arrays.
+    template <typename Layout>
+    void Search( const LabyrinthView& l,
+                 const LandmarkIndex* const landmarks,
+                 const Coordinate from,
+                 const Coordinate to,
+                 const Layout& layout );
+
+    // This private method resets the cost of every touched Room and
+    // empties the open list.
+    void Clear();
+};
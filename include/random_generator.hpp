@@ -0,0 +1,152 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the RandomGenerator class, the seedable
+ * random number generator shared by maze generation, placement, and
+ * respawning.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// A RandomGenerator is a xoshiro256** generator: 32 bytes of state, a few
+// instructions per number, and a period of 2^256 - 1. Its state is
+// expanded from a single 64-bit seed with SplitMix64, so the same seed
+// always gives the same numbers on every platform.
+//
+// Independent streams are derived from one root generator with Stream()
+// (the same index always gives the same stream) or Split(), so each
+// thread of a parallel job can own a generator instead of sharing one.
+//
+// A RandomGenerator meets the requirements of a uniform random bit
+// generator, so it can also be given to the standard library (e.g.
+// std::shuffle).
+class RandomGenerator
+{
+  public:
+
+    using result_type = uint64_t;
+
+    // Parameterized constructor
+    explicit RandomGenerator( const uint64_t seed );
+
+    // This method returns a generator for the stream with the given index,
+    // derived from the current state of this generator, which is not
+    // changed. Streams with different indices are independent.
+    RandomGenerator Stream( const uint64_t index ) const;
+
+    // This method returns a new, independent generator and advances this
+    // one.
+    RandomGenerator Split();
+
+    // This method advances the generator by 2^128 numbers, which gives
+    // 2^128 non-overlapping sequences of 2^128 numbers each.
+    void Jump();
+
+    // This method returns the next random 64-bit number.
+    uint64_t Next();
+
+    // This method returns a random number from 0 to n - 1, without bias.
+    // n must not be 0.
+    uint64_t Below( const uint64_t n );
+
+    // This method returns true or false with equal probability.
+    bool Bit();
+
+    // This method returns a random number in [0, 1).
+    double Real();
+
+    // UNIFORM RANDOM BIT GENERATOR:
+
+      uint64_t operator()();
+      static constexpr uint64_t min();
+      static constexpr uint64_t max();
+
+  private:
+
+    uint64_t state_[4];
+
+    // This private method returns the next number of a SplitMix64
+    // sequence, advancing x.
+    static uint64_t SplitMix64( uint64_t& x );
+
+    // This private method rotates the bits of x left by k.
+    static uint64_t RotateLeft( const uint64_t x, const int k );
+};
+
+// The methods below are called once or more per Room by the generators,
+// so they are defined here to be inlined.
+
+// This method returns the next random 64-bit number.
+inline uint64_t RandomGenerator::Next()
+{
+  const uint64_t result = RotateLeft( state_[1] * 5, 7 ) * 9;
+  const uint64_t t = state_[1] << 17;
+  state_[2] ^= state_[0];
+  state_[3] ^= state_[1];
+  state_[1] ^= state_[2];
+  state_[0] ^= state_[3];
+  state_[2] ^= t;
+  state_[3] = RotateLeft( state_[3], 45 );
+  return result;
+}
+
+// This method returns a random number from 0 to n - 1, without bias.
+// n must not be 0.
+//
+// The random number is multiplied by n, and the high word of the 128-bit
+// product is the result (Lemire's method), so no division is needed
+// unless the low word falls below 2^64 % n, in which case numbers are
+// rejected so that every result is equally likely; for small n a
+// rejection almost never happens.
+inline uint64_t RandomGenerator::Below( const uint64_t n )
+{
+  unsigned __int128 m = static_cast<unsigned __int128>( Next() ) * n;
+  if( static_cast<uint64_t>(m) < n )
+  {
+    const uint64_t threshold = ( 0 - n ) % n;
+    while( static_cast<uint64_t>(m) < threshold )
+    {
+      m = static_cast<unsigned __int128>( Next() ) * n;
+    }
+  }
+  return static_cast<uint64_t>( m >> 64 );
+}
+
+// This method returns true or false with equal probability.
+inline bool RandomGenerator::Bit()
+{
+  return Next() >> 63;
+}
+
+// This method returns a random number in [0, 1).
+inline double RandomGenerator::Real()
+{
+  return ( Next() >> 11 ) * ( 1.0 / 9007199254740992.0 );
+}
+
+inline uint64_t RandomGenerator::operator()()
+{
+  return Next();
+}
+
+constexpr uint64_t RandomGenerator::min()
+{
+  return 0;
+}
+
+constexpr uint64_t RandomGenerator::max()
+{
+  return ~uint64_t(0);
+}
+
+// This private method rotates the bits of x left by k.
+inline uint64_t RandomGenerator::RotateLeft( const uint64_t x, const int k )
+{
+  return ( x << k ) | ( x >> (64 - k) );
+}
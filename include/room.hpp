@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-01-25
+ * Last edited: 2026-10-18
  *
  * This C++ header file contains implementations of a Room class, which is a
  * template to create a Labyrinth.
@@ -10,8 +10,13 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "room_properties.hpp"
 
+// A Room is packed into a single 16-bit word, so that large Labyrinths
+// stay small enough to be scanned from cache. The methods below decode and
+// encode the word; the packing is not visible through the interface.
 class Room
 {
   public:
@@ -63,12 +68,20 @@ class Room
     RoomBorder DirectionCheck( const Direction d ) const;
 
   private:
+    // Layout of bits_:
+    //   Bits 0-2:  Inhabitant
+    //   Bits 3-4:  Item
+    //   Bits 5-7:  Direction of the exit (kNone if there is no exit)
+    //   Bits 8-11: Walls to the north, east, south, and west (set if the
+    //              Wall exists)
     // The exit direction does not count as a wall.
-    Inhabitant dark_thing_ = Inhabitant::kNone;
-    Item object_ = Item::kNone;
-    Direction exit_  = Direction::kNone;
-    bool wall_north_ = true;
-    bool wall_east_  = true;
-    bool wall_south_ = true;
-    bool wall_west_  = true;
+    uint16_t bits_;
+
+    // This private method returns the bit of bits_ which stores the Wall
+    // in the given direction, or 0 if d is kNone.
+    static uint16_t WallBit( const Direction d );
+
+    // This private method returns the Direction of the exit, or kNone if
+    // the Room has no exit.
+    Direction Exit() const;
 };
@@ -0,0 +1,65 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the implementation of a RoomCell struct,
+ * the one-byte state of a single Room stored by the Labyrinth class.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "room_properties.hpp"
+
+// A RoomCell holds the contents of a Room in a Labyrinth:
+//   Bits 0-2: Inhabitant
+//   Bits 3-4: Item
+// This matches the low byte of a packed Room. The Walls of a Labyrinth are
+// stored separately by a WallGrid, and the exit by the Labyrinth itself.
+struct RoomCell
+{
+  uint8_t bits;
+
+  // Default constructor
+  // This constructor sets an empty Room.
+  RoomCell()
+  {
+    bits = 0;
+  }
+
+  // This method returns the current inhabitant of the Room.
+  Inhabitant GetInhabitant() const
+  {
+    return static_cast<Inhabitant>( bits & kInhabitantMask );
+  }
+
+  // This method sets the current inhabitant of the Room.
+  void SetInhabitant( const Inhabitant inh )
+  {
+    bits = static_cast<uint8_t>( (bits & ~kInhabitantMask) |
+                                 static_cast<uint8_t>(inh) );
+  }
+
+  // This method returns the current item in the Room.
+  Item GetItem() const
+  {
+    return static_cast<Item>( (bits & kItemMask) >> kItemShift );
+  }
+
+  // This method sets the current item in the Room.
+  void SetItem( const Item itm )
+  {
+    bits = static_cast<uint8_t>( (bits & ~kItemMask) |
+                                 (static_cast<uint8_t>(itm) << kItemShift) );
+  }
+
+  static constexpr uint8_t kInhabitantMask = 0x07;
+  static constexpr uint8_t kItemShift      = 3;
+  static constexpr uint8_t kItemMask       = 0x03 << kItemShift;
+};
+
+static_assert( sizeof(RoomCell) == 1,
+               "RoomCell should fit in a single byte." );
@@ -0,0 +1,218 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the RowMajorLayout and MortonLayout
+ * classes, which map the Rooms of a grid to the indices of an array.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "packed_coordinate.hpp"
+
+// The order in which an array holds one entry per Room
+enum class RoomOrder
+{
+  kRowMajor,  // Row by row; the Room at (x, y) is at y * x_size + x
+  kMorton,    // Z-order; see MortonLayout
+};
+
+// Both layouts have the same methods, so that a search can be written once
+// as a template over its layout:
+//   Capacity()            The length of an array with an entry per Room
+//   Index( x, y )         The index of the Room at (x, y)
+//   At( i )               The Room at index i
+//   East( i ), West( i ), South( i ), North( i )
+//                         The index of the neighbour of the Room at index
+//                         i; the neighbour must be within the grid
+// Bounds are never checked.
+
+// A RowMajorLayout places the Rooms row by row, as the Labyrinth does. The
+// Rooms to the north and south of a Room are a whole row away from it.
+class RowMajorLayout
+{
+  public:
+
+    // Parameterized constructor
+    RowMajorLayout( const size_t x_size, const size_t y_size ) :
+      x_size_(x_size),
+      y_size_(y_size)
+    {
+    }
+
+    size_t Capacity() const
+    {
+      return x_size_ * y_size_;
+    }
+
+    size_t Index( const uint32_t x, const uint32_t y ) const
+    {
+      return y * x_size_ + x;
+    }
+
+    PackedCoordinate At( const size_t i ) const
+    {
+      const size_t y = i / x_size_;
+      return PackedCoordinate( static_cast<uint32_t>(i - y * x_size_),
+                               static_cast<uint32_t>(y) );
+    }
+
+    size_t East( const size_t i ) const
+    {
+      return i + 1;
+    }
+
+    size_t West( const size_t i ) const
+    {
+      return i - 1;
+    }
+
+    size_t South( const size_t i ) const
+    {
+      return i + x_size_;
+    }
+
+    size_t North( const size_t i ) const
+    {
+      return i - x_size_;
+    }
+
+  private:
+
+    size_t x_size_;
+    size_t y_size_;
+};
+
+// A MortonLayout places the Rooms in Z-order: the bits of x and y are
+// interleaved, so every aligned 2^k by 2^k square of Rooms is contiguous
+// and most neighbours in any direction share a cache line or page. The
+// grid is padded to a power of 2 along each axis; where one axis is
+// longer, its extra high bits are placed above the interleaved bits, so
+// the padded grid is a row of Morton squares and holds fewer than four
+// times the Rooms. Padding entries belong to no Room.
+//
+// The bits of each axis are kept in a mask, and a neighbour is found by
+// adding or subtracting 1 within the mask of its axis, without splitting
+// the index into x and y.
+class MortonLayout
+{
+  public:
+
+    // Parameterized constructor
+    // An exception is thrown if:
+    //   The padded grid has 2^63 or more Rooms (domain_error)
+    MortonLayout( const size_t x_size, const size_t y_size )
+    {
+      const size_t x_bits = BitsFor( x_size );
+      const size_t y_bits = BitsFor( y_size );
+      if( x_bits + y_bits >= 63 )
+      {
+        throw std::domain_error( "Error: MortonLayout() was given a size "\
+          "whose padded grid has 2^63 or more Rooms.\n" );
+      }
+
+      // Each axis has k interleaved bits; the longer one has more above
+      shared_bits_ = x_bits < y_bits ? x_bits : y_bits;
+      const uint64_t shared = ( uint64_t(1) << shared_bits_ ) - 1;
+      const uint64_t high_x = ( uint64_t(1) << (x_bits - shared_bits_) ) - 1;
+      const uint64_t high_y = ( uint64_t(1) << (y_bits - shared_bits_) ) - 1;
+      x_mask_ = Spread( shared ) | ( high_x << (2 * shared_bits_) );
+      y_mask_ = ( Spread(shared) << 1 ) | ( high_y << (2 * shared_bits_) );
+      x_longer_ = x_bits > y_bits;
+      capacity_ = size_t( 1 ) << ( x_bits + y_bits );
+    }
+
+    size_t Capacity() const
+    {
+      return capacity_;
+    }
+
+    size_t Index( const uint32_t x, const uint32_t y ) const
+    {
+      const uint64_t shared = ( uint64_t(1) << shared_bits_ ) - 1;
+      const uint64_t high = ( x >> shared_bits_ ) | ( y >> shared_bits_ );
+      return Spread( x & shared ) | ( Spread(y & shared) << 1 ) |
+             ( high << (2 * shared_bits_) );
+    }
+
+    PackedCoordinate At( const size_t i ) const
+    {
+      const uint64_t shared = ( uint64_t(1) << (2 * shared_bits_) ) - 1;
+      const uint64_t high = ( i >> (2 * shared_bits_) ) << shared_bits_;
+      const uint64_t x = Compact( i & shared ) | ( x_longer_ ? high : 0 );
+      const uint64_t y = Compact( (i & shared) >> 1 ) |
+                         ( x_longer_ ? 0 : high );
+      return PackedCoordinate( static_cast<uint32_t>(x),
+                               static_cast<uint32_t>(y) );
+    }
+
+    size_t East( const size_t i ) const
+    {
+      return ( ((i | ~x_mask_) + 1) & x_mask_ ) | ( i & y_mask_ );
+    }
+
+    size_t West( const size_t i ) const
+    {
+      return ( ((i & x_mask_) - 1) & x_mask_ ) | ( i & y_mask_ );
+    }
+
+    size_t South( const size_t i ) const
+    {
+      return ( ((i | ~y_mask_) + 1) & y_mask_ ) | ( i & x_mask_ );
+    }
+
+    size_t North( const size_t i ) const
+    {
+      return ( ((i & y_mask_) - 1) & y_mask_ ) | ( i & x_mask_ );
+    }
+
+  private:
+
+    uint64_t x_mask_;
+    uint64_t y_mask_;
+    size_t shared_bits_;
+    size_t capacity_;
+    bool x_longer_;
+
+    // This private method returns the number of bits needed for the
+    // coordinates of an axis of the given size.
+    static size_t BitsFor( const size_t size )
+    {
+      size_t bits = 0;
+      while( bits < 64 && (uint64_t(1) << bits) < size )
+      {
+        ++bits;
+      }
+      return bits;
+    }
+
+    // This private method moves bit n of the low 32 bits to bit 2n.
+    static uint64_t Spread( uint64_t v )
+    {
+      v &= 0x00000000FFFFFFFFull;
+      v = ( v | (v << 16) ) & 0x0000FFFF0000FFFFull;
+      v = ( v | (v << 8) ) & 0x00FF00FF00FF00FFull;
+      v = ( v | (v << 4) ) & 0x0F0F0F0F0F0F0F0Full;
+      v = ( v | (v << 2) ) & 0x3333333333333333ull;
+      v = ( v | (v << 1) ) & 0x5555555555555555ull;
+      return v;
+    }
+
+    // This private method moves bit 2n to bit n, undoing Spread().
+    static uint64_t Compact( uint64_t v )
+    {
+      v &= 0x5555555555555555ull;
+      v = ( v | (v >> 1) ) & 0x3333333333333333ull;
+      v = ( v | (v >> 2) ) & 0x0F0F0F0F0F0F0F0Full;
+      v = ( v | (v >> 4) ) & 0x00FF00FF00FF00FFull;
+      v = ( v | (v >> 8) ) & 0x0000FFFF0000FFFFull;
+      v = ( v | (v >> 16) ) & 0x00000000FFFFFFFFull;
+      return v;
+    }
+};
@@ -0,0 +1,134 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the RoomOverlay class, which holds the
+ * Rooms that one game has changed on top of a shared LevelTopology.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "room_properties.hpp"
+#include "room_cell.hpp"
+#include "coordinate.hpp"
+#include "labyrinth_status.hpp"
+#include "level_topology.hpp"
+
+// A RoomOverlay is the state of one game of a shared level. A Room is
+// read from the LevelTopology until the game changes it (by attacking its
+// Inhabitant, or taking or dropping an Item); the Room is then copied
+// into the overlay, which is read first from then on. The memory of a
+// RoomOverlay is therefore proportional to the number of Rooms its game
+// has changed, not to the size of the level.
+//
+// The changed Rooms are kept in a vector sorted by their row-major index
+// and found by binary search: a game changes few Rooms, and a short
+// sorted vector is smaller and faster to search than a hash table. Most
+// reads are of Rooms which have not changed, so a 64-bit summary of the
+// changed indices (bit index % 64) skips the search for them.
+//
+// The play methods match the non-throwing and unchecked methods of the
+// Labyrinth, so that a GameSession can play on either.
+class RoomOverlay
+{
+  public:
+
+    // CONSTRUCTOR/DESTRUCTOR:
+
+      // Parameterized constructor
+      // The overlay begins with no changed Rooms.
+      // An exception is thrown if:
+      //   The topology is null (invalid_argument)
+      explicit RoomOverlay( std::shared_ptr<const LevelTopology> topology );
+
+    // PLAY:
+
+      // This method returns the current Inhabitant of the Room.
+      // An exception is thrown if:
+      //   The Room is outside the level (domain_error)
+      Inhabitant GetInhabitant( const Coordinate rm ) const;
+
+      // This method returns the current Item in the given Room, but does
+      // not change it.
+      // An exception is thrown if:
+      //   The Room is outside the level (domain_error)
+      Item ItemAt( const Coordinate rm ) const;
+
+      // This method drops the Treasure in the given Room.
+      // Returns kOutOfBounds or kTreasureAlreadySet upon failure.
+      LabyrinthStatus TryDropTreasure( const Coordinate rm );
+
+      // This method discards every change, so that the overlay can be
+      // reused for a new game of the same level without allocating.
+      void Clear();
+
+    // STATE:
+
+      // This method returns the shared level.
+      const LevelTopology& Topology() const;
+
+      // This method returns the number of Rooms which have been changed.
+      size_t ChangedRoomCount() const;
+
+      // This method returns the number of bytes held by the overlay,
+      // including the storage of its changed Rooms.
+      size_t ByteSize() const;
+
+    // UNCHECKED:
+    //
+    // These methods skip the bounds check, like those of the Labyrinth.
+
+      Inhabitant GetInhabitantUnchecked( const Coordinate rm ) const;
+
+      Item ItemAtUnchecked( const Coordinate rm ) const;
+
+      // Direction d must not be kNone.
+      RoomBorder DirectionCheckUnchecked( const Coordinate rm,
+                                          const Direction d ) const;
+
+      // Returns kNoEnemy upon failure.
+      LabyrinthStatus AttackEnemyUnchecked( const Coordinate rm );
+
+      // Returns kNoItem upon failure.
+      LabyrinthStatus TakeItemUnchecked( const Coordinate rm );
+
+  private:
+
+    // A Room which the game has changed
+    struct ChangedRoom
+    {
+      size_t index;  // Row-major index of the Room
+      RoomCell cell;
+    };
+
+    std::shared_ptr<const LevelTopology> topology_;
+    std::vector<ChangedRoom> changed_;  // Sorted by index
+    uint64_t changed_bits_ = 0;         // Bit index % 64 of each index
+    bool treasure_set_;  // Is also false when the Treasure is held
+
+    // This private method returns true if the Room is within the level,
+    // and false otherwise.
+    bool WithinBounds( const Coordinate rm ) const;
+
+    // This private method returns the current contents of the Room.
+    // Bounds are not checked.
+    RoomCell CellAt( const Coordinate rm ) const;
+
+    // This private method returns the contents of the Room in the
+    // overlay, copying the Room into it first if it has not changed yet.
+    // Bounds are not checked.
+    // An exception is thrown if:
+    //   There is not enough memory for the Room (bad_alloc)
+    RoomCell& WritableCellAt( const Coordinate rm );
+
+    // This private method returns the bit of changed_bits_ for the Room at
+    // the given row-major index.
+    static uint64_t ChangedBit( const size_t index );
+};
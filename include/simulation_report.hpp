@@ -0,0 +1,63 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the SimulationReport struct, which
+ * summarizes a batch of games played by a BatchSimulator.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "coordinate.hpp"
+
+// The number of times Players died in one Room
+struct RoomDeaths
+{
+  Coordinate room;
+  uint64_t deaths;
+};
+
+// A SimulationReport counts the outcomes of a batch of games. A game is
+// abandoned if it reaches the action limit, or if the Player has no Room
+// to move to, before it is won or lost.
+struct SimulationReport
+{
+  size_t games = 0;
+  size_t won = 0;
+  size_t lost = 0;
+  size_t abandoned = 0;
+
+  uint64_t actions = 0;       // Moves, shots, and holds of fire
+  uint64_t bullets_used = 0;  // Shots fired
+  uint64_t deaths = 0;        // Lives lost, including the last ones
+
+  std::vector<RoomDeaths> death_rooms;  // Most deaths first, then
+                                        // row-major
+
+  size_t thread_count = 0;
+  double seconds = 0;
+
+  // This method returns the fraction of games which were won.
+  double WinRate() const
+  {
+    return games == 0 ? 0 : static_cast<double>(won) / games;
+  }
+
+  // This method returns the average number of bullets fired per game.
+  double AverageBulletsUsed() const
+  {
+    return games == 0 ? 0 : static_cast<double>(bullets_used) / games;
+  }
+
+  // This method returns the number of games played per second.
+  double GamesPerSecond() const
+  {
+    return seconds == 0 ? 0 : games / seconds;
+  }
+};
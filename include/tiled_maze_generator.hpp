@@ -0,0 +1,82 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the TiledMazeGenerator class, which
+ * generates a maze in tiles on several threads and stitches the tiles
+ * together.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "labyrinth.hpp"
+#include "maze_generator.hpp"
+#include "random_generator.hpp"
+
+// A TiledMazeGenerator splits a Labyrinth into tiles, carves a perfect
+// maze into each tile with a MazeGenerator on a pool of threads, and then
+// joins the tiles into one perfect maze: a union-find forest over the
+// tiles accepts tile boundaries in a random order, and one random Wall is
+// broken along each accepted boundary.
+//
+// Every tile is generated from its own random stream, derived from the
+// generator's seed and the tile's position, and the tiles are joined on
+// the calling thread, so the maze depends only on the seed and never on
+// the number of threads or the order in which tiles finish.
+//
+// Tiles which are side by side share no Wall words of the Labyrinth
+// because the tile x size is a multiple of 64, so the threads may break
+// Walls concurrently.
+class TiledMazeGenerator
+{
+  public:
+
+    // Parameterized constructor
+    // A thread count of 0 uses one thread per hardware thread.
+    // An exception is thrown if:
+    //   A tile size of 0 is given (domain_error)
+    //   The tile x size is not a multiple of 64 (invalid_argument)
+    TiledMazeGenerator( const MazeAlgorithm algorithm,
+                        const size_t tile_x_size,
+                        const size_t tile_y_size,
+                        const uint64_t seed,
+                        const size_t thread_count = 0 );
+
+    // This method carves a maze into the Labyrinth.
+    // The Labyrinth should have every interior Wall intact (as it is when
+    // constructed) and no exit; Walls which cannot be broken are skipped,
+    // in which case the maze will not be perfect.
+    // An exception is thrown if:
+    //   The algorithm is not a valid MazeAlgorithm (invalid_argument)
+    //   There is not enough memory for the working state (bad_alloc)
+    //   A thread cannot be started (system_error)
+    void Generate( Labyrinth& l );
+
+    // This method returns the number of threads used by Generate().
+    size_t ThreadCount() const;
+
+  private:
+
+    const MazeAlgorithm algorithm_;
+    const size_t tile_x_size_;
+    const size_t tile_y_size_;
+    const size_t thread_count_;
+    RandomGenerator rng_;
+
+    // This private method carves a maze into one tile of the Labyrinth,
+    // whose top left Room is (x_start, y_start).
+    void GenerateTile( Labyrinth& l,
+                       const size_t x_start,
+                       const size_t y_start,
+                       const RandomGenerator& rng ) const;
+
+    // This private method joins the tiles of the Labyrinth with one
+    // broken Wall along each boundary of a random spanning tree of the
+    // tiles.
+    void StitchTiles( Labyrinth& l );
+};
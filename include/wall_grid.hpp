@@ -0,0 +1,99 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the WallGrid class, which stores every
+ * Wall of a Labyrinth exactly once as two bitmaps.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "room_properties.hpp"
+#include "coordinate.hpp"
+
+// A WallGrid stores the Walls between the Rooms of an x_size by y_size grid.
+//
+// The east bitmap has one bit per Room, set if there is a Wall to the east
+// of the Room; the south bitmap likewise for the Wall to the south. The
+// west and north Walls of a Room are the east and south Walls of its
+// neighbours, and the Walls on the outside of the grid always exist.
+//
+// Each row of a bitmap is padded to whole 64-bit words so that rows can be
+// tested a word at a time; bit (x % 64) of word (x / 64) of row y belongs
+// to the Room at (x, y). Padding bits are always set.
+class WallGrid
+{
+  public:
+
+    // Parameterized constructor
+    // Every Wall of the grid exists initially.
+    // An exception is thrown if:
+    //   A size of 0 is given (domain_error)
+    WallGrid( const size_t x_size, const size_t y_size );
+
+    // This method returns true if the Room has a Wall in the given
+    // direction, and false if it opens onto another Room.
+    // Bounds are not checked; the Room must be within the grid.
+    // An exception is thrown if:
+    //   Direction d is kNone (invalid_argument)
+    bool IsWall( const Coordinate rm, const Direction d ) const;
+
+    // This method sets whether the Wall of the Room in the given direction
+    // exists. The neighbouring Room shares the same Wall.
+    // Bounds are not checked; the Room must be within the grid.
+    // An exception is thrown if:
+    //   Direction d is kNone (invalid_argument)
+    //   The Wall is on the outside of the grid and exists is false
+    //     (logic_error)
+    void SetWall( const Coordinate rm, const Direction d, const bool exists );
+
+    // This method replaces every Wall of the grid with the given bitmaps,
+    // which must use the row layout of the grid (WordsPerRow() words per
+    // row, y_size rows). Padding bits are ignored.
+    // An exception is thrown if:
+    //   A Wall on the outside of the grid is missing (invalid_argument)
+    void Assign( const uint64_t* const east, const uint64_t* const south );
+
+    // This method returns the number of 64-bit words in each bitmap row.
+    size_t WordsPerRow() const;
+
+    // This method returns the number of 64-bit words in each bitmap row of
+    // a grid with the given x size.
+    static size_t WordsPerRow( const size_t x_size );
+
+    // These methods return the first word of row y of the east and south
+    // bitmaps, respectively.
+    // Bounds are not checked; y must be less than the y size.
+    const uint64_t* EastRow( const size_t y ) const;
+    const uint64_t* SouthRow( const size_t y ) const;
+
+  private:
+
+    const size_t x_size_;
+    const size_t y_size_;
+    const size_t words_per_row_;
+
+    std::unique_ptr<uint64_t[]> east_;
+    std::unique_ptr<uint64_t[]> south_;
+
+    // This private method returns the mask of the padding bits in the last
+    // word of each row.
+    uint64_t PaddingMask() const;
+
+    // This private method sets or clears bit x of row y of the bitmap.
+    void SetBit( uint64_t* const bitmap,
+                 const size_t x,
+                 const size_t y,
+                 const bool value );
+
+    // This private method returns bit x of row y of the bitmap.
+    bool GetBit( const uint64_t* const bitmap,
+                 const size_t x,
+                 const size_t y ) const;
+};
@@ -0,0 +1,494 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the BatchSimulator class,
+ * which plays many headless games of one level on several threads and
+ * reports how they went.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/level_topology.hpp"
+#include "../include/room_overlay.hpp"
+#include "../include/game_session.hpp"
+#include "../include/simulation_report.hpp"
+#include "../include/batch_simulator.hpp"
+
+constexpr size_t BatchSimulator::kChunkGames;
+
+namespace
+{
+
+// The directions in clockwise order
+const Direction kClockwise[] = { Direction::kNorth, Direction::kEast,
+                                 Direction::kSouth, Direction::kWest };
+
+// This local function returns the direction which is the given number
+// of quarter turns clockwise from Direction d, which must not be kNone.
+Direction Turn( const Direction d, const unsigned quarters );
+
+// This local function returns the Room next to the given Room in
+// Direction d, which must not be kNone.
+Coordinate Neighbour( const Coordinate rm, const Direction d );
+
+// These local functions pack a range of games into 64 bits, and return
+// its ends.
+uint64_t PackGames( const uint64_t begin, const uint64_t end );
+uint64_t GamesBegin( const uint64_t games );
+uint64_t GamesEnd( const uint64_t games );
+
+// This local function returns the direction which is the given number
+// of quarter turns clockwise from Direction d, which must not be kNone.
+Direction Turn( const Direction d, const unsigned quarters )
+{
+  const unsigned index = static_cast<unsigned>(d) - 1;
+  return kClockwise[( index + quarters ) & 3];
+}
+
+// This local function returns the Room next to the given Room in
+// Direction d, which must not be kNone.
+Coordinate Neighbour( const Coordinate rm, const Direction d )
+{
+  switch( d )
+  {
+    case Direction::kNorth:
+      return Coordinate( rm.x, rm.y - 1 );
+
+    case Direction::kEast:
+      return Coordinate( rm.x + 1, rm.y );
+
+    case Direction::kSouth:
+      return Coordinate( rm.x, rm.y + 1 );
+
+    default:
+      return Coordinate( rm.x - 1, rm.y );
+  }
+}
+
+// These local functions pack a range of games into 64 bits, and return
+// its ends.
+uint64_t PackGames( const uint64_t begin, const uint64_t end )
+{
+  return begin | ( end << 32 );
+}
+
+uint64_t GamesBegin( const uint64_t games )
+{
+  return games & UINT32_MAX;
+}
+
+uint64_t GamesEnd( const uint64_t games )
+{
+  return games >> 32;
+}
+
+}  // Anonymous namespace
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Parameterized constructor
+// A thread count of 0 uses one thread per hardware thread.
+BatchSimulator::BatchSimulator( const PlayerPolicy policy,
+                                const uint64_t seed,
+                                const size_t thread_count ) :
+  policy_(policy),
+  thread_count_(thread_count != 0 ?
+                thread_count :
+                std::max( 1u, std::thread::hardware_concurrency() )),
+  rng_(seed)
+{
+}
+
+// SIMULATION:
+
+// This method plays game_count games of the Labyrinth as it is now,
+// each with the given number of bullets and at most max_actions
+// actions, and returns the report. The report is valid until the
+// next simulation.
+// An exception is thrown if:
+//   The policy is not a valid PlayerPolicy (invalid_argument)
+//   game_count is 2^32 or more (domain_error)
+//   The policy is kShortestPath and the Labyrinth has no exit or
+//     no Treasure (logic_error)
+//   There is not enough memory for the level, the deaths counted
+//     per Room by each thread, or the report (bad_alloc)
+//   A thread cannot be started (system_error)
+const SimulationReport& BatchSimulator::Run( const Labyrinth& l,
+                                             const size_t game_count,
+                                             const uint32_t bullets,
+                                             const size_t max_actions )
+{
+  switch( policy_ )
+  {
+    case PlayerPolicy::kRandomWalk:
+    case PlayerPolicy::kWallFollower:
+    case PlayerPolicy::kShortestPath:
+      break;
+
+    default:
+      throw std::invalid_argument( "Error: Run() was called with an "\
+        "invalid PlayerPolicy.\n" );
+  }
+  if( game_count > UINT32_MAX )
+  {
+    throw std::domain_error( "Error: Run() was given 2^32 or more "\
+      "games.\n" );
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto topology = std::make_shared<const LevelTopology>( l );
+  DistanceField to_treasure;
+  DistanceField to_exit;
+  Guide guide = { nullptr, nullptr };
+  if( policy_ == PlayerPolicy::kShortestPath )
+  {
+    to_treasure.ComputeFromTreasure( *topology );
+    to_exit.ComputeFromExit( *topology );
+    guide.to_treasure = to_treasure.Distances();
+    guide.to_exit = to_exit.Distances();
+  }
+  const RandomGenerator game_streams = rng_.Split();
+
+  // Each thread starts with an equal share of the games
+  const size_t chunks = ( game_count + kChunkGames - 1 ) / kChunkGames;
+  const size_t threads =
+    std::max( size_t(1), std::min( thread_count_, chunks ) );
+  std::unique_ptr<GameShare[]> shares( new GameShare[threads] );
+  for( size_t t = 0; t < threads; ++t )
+  {
+    shares[t].games = PackGames( game_count * t / threads,
+                                 game_count * ( t + 1 ) / threads );
+  }
+  std::vector<SimulationReport> tallies( threads );
+  const size_t rooms = l.XSize() * l.YSize();
+  std::vector<std::vector<uint64_t>> death_counts(
+    threads, std::vector<uint64_t>( rooms, 0 ) );
+
+  // The first exception thrown stops every thread and is rethrown here
+  std::atomic<bool> failed( false );
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  const auto work = [&]( const size_t thread )
+  {
+    try
+    {
+      RoomOverlay overlay( topology );
+      DistanceField scratch;
+      uint64_t begin = 0;
+      uint64_t end = 0;
+      while( !failed &&
+             TakeGames( shares.get(), thread, threads, begin, end ) )
+      {
+        for( uint64_t game = begin; game < end; ++game )
+        {
+          PlayGame( overlay, guide, scratch, game_streams.Stream( game ),
+                    bullets, max_actions,
+                    tallies[thread], death_counts[thread] );
+        }
+      }
+    }
+    catch( ... )
+    {
+      std::lock_guard<std::mutex> lock( error_mutex );
+      if( !error )
+      {
+        error = std::current_exception();
+      }
+      failed = true;
+    }
+  };
+
+  // The calling thread takes the first share
+  std::vector<std::thread> pool;
+  try
+  {
+    for( size_t t = 1; t < threads; ++t )
+    {
+      pool.emplace_back( work, t );
+    }
+  }
+  catch( ... )
+  {
+    failed = true;
+    for( std::thread& t : pool )
+    {
+      t.join();
+    }
+    throw;
+  }
+  work( 0 );
+  for( std::thread& t : pool )
+  {
+    t.join();
+  }
+  if( error )
+  {
+    std::rethrow_exception( error );
+  }
+
+  report_ = SimulationReport();
+  for( size_t t = 0; t < threads; ++t )
+  {
+    const SimulationReport& tally = tallies[t];
+    report_.games += tally.games;
+    report_.won += tally.won;
+    report_.lost += tally.lost;
+    report_.abandoned += tally.abandoned;
+    report_.actions += tally.actions;
+    report_.bullets_used += tally.bullets_used;
+    report_.deaths += tally.deaths;
+  }
+
+  // The deaths counted by each thread are summed into the first's
+  std::vector<uint64_t>& deaths = death_counts[0];
+  for( size_t t = 1; t < threads; ++t )
+  {
+    for( size_t i = 0; i < rooms; ++i )
+    {
+      deaths[i] += death_counts[t][i];
+    }
+  }
+
+  // Only the Rooms with deaths are listed and sorted, in row-major order
+  // before the stable sort
+  for( size_t i = 0; i < rooms; ++i )
+  {
+    if( deaths[i] != 0 )
+    {
+      report_.death_rooms.push_back(
+        { Coordinate( i % l.XSize(), i / l.XSize() ), deaths[i] } );
+    }
+  }
+  std::stable_sort( report_.death_rooms.begin(), report_.death_rooms.end(),
+    []( const RoomDeaths& a, const RoomDeaths& b )
+    {
+      return a.deaths > b.deaths;
+    } );
+
+  report_.thread_count = threads;
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  report_.seconds = std::chrono::duration<double>(elapsed).count();
+  return report_;
+}
+
+// This method returns the number of threads used by Run().
+size_t BatchSimulator::ThreadCount() const
+{
+  return thread_count_;
+}
+
+// PRIVATE METHODS:
+
+// This private method takes the next games for the given thread into
+// [begin, end): from its own share if any are left, and otherwise
+// from another thread's.
+// Returns false if every share is empty.
+bool BatchSimulator::TakeGames( GameShare* const shares,
+                                const size_t thread,
+                                const size_t thread_count,
+                                uint64_t& begin,
+                                uint64_t& end )
+{
+  // Other threads only shrink a share, so a failed compare-and-swap
+  // reloads it and tries again
+  std::atomic<uint64_t>& own = shares[thread].games;
+  uint64_t games = own.load();
+  while( GamesBegin(games) < GamesEnd(games) )
+  {
+    begin = GamesBegin( games );
+    end = std::min( begin + kChunkGames, GamesEnd(games) );
+    if( own.compare_exchange_weak(games, PackGames(end, GamesEnd(games))) )
+    {
+      return true;
+    }
+  }
+
+  // The second half of another share is stolen, and becomes this
+  // thread's share; no other thread changes an empty share
+  for( size_t i = 1; i < thread_count; ++i )
+  {
+    std::atomic<uint64_t>& victim =
+      shares[( thread + i ) % thread_count].games;
+    uint64_t stolen = victim.load();
+    while( GamesBegin(stolen) < GamesEnd(stolen) )
+    {
+      const uint64_t middle = GamesBegin( stolen ) +
+        ( GamesEnd(stolen) - GamesBegin(stolen) ) / 2;
+      if( victim.compare_exchange_weak(
+            stolen, PackGames(GamesBegin(stolen), middle)) )
+      {
+        begin = middle;
+        end = std::min( begin + kChunkGames, GamesEnd(stolen) );
+        own = PackGames( end, GamesEnd(stolen) );
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// This private method plays one game on the overlay and counts it in
+// the tally. The deaths in each Room are counted in death_counts, in
+// row-major order. scratch is used by kShortestPath after the Treasure
+// is dropped.
+void BatchSimulator::PlayGame( RoomOverlay& overlay,
+                               const Guide& guide,
+                               DistanceField& scratch,
+                               RandomGenerator rng,
+                               const uint32_t bullets,
+                               const size_t max_actions,
+                               SimulationReport& tally,
+                               std::vector<uint64_t>& death_counts ) const
+{
+  const LevelTopology& topology = overlay.Topology();
+  overlay.Clear();
+  GameSession s( overlay, bullets );
+  const uint32_t* to_treasure = guide.to_treasure;
+  Direction facing = Direction::kNorth;
+
+  size_t actions = 0;
+  for( ; actions < max_actions; ++actions )
+  {
+    if( s.State() == SessionState::kEncounter )
+    {
+      if( s.Bullets() > 0 )
+      {
+        s.Shoot();
+        ++tally.bullets_used;
+        continue;
+      }
+
+      const Coordinate rm = s.Position();
+      const uint32_t lives = s.Lives();
+      const bool had_treasure = s.HasTreasure();
+      s.HoldFire();
+      if( s.Lives() < lives )
+      {
+        ++tally.deaths;
+        ++death_counts[topology.IndexOf(rm)];
+        // A Player who dies with the Treasure always drops it in the
+        // Room of the death (GameSession::Die() empties the Room first)
+        if( had_treasure && policy_ == PlayerPolicy::kShortestPath &&
+            s.State() != SessionState::kLost )
+        {
+          scratch.Compute( topology, rm );
+          to_treasure = scratch.Distances();
+        }
+      }
+    }
+    else if( s.State() == SessionState::kExploring )
+    {
+      facing = ChooseMove( s, topology, to_treasure, guide.to_exit,
+                           facing, rng );
+      if( facing == Direction::kNone )
+      {
+        break;
+      }
+      s.Move( facing );
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  ++tally.games;
+  tally.actions += actions;
+  switch( s.State() )
+  {
+    case SessionState::kWon:
+      ++tally.won;
+      break;
+
+    case SessionState::kLost:
+      ++tally.lost;
+      break;
+
+    default:
+      ++tally.abandoned;
+      break;
+  }
+}
+
+// This private method returns the direction of the next Move of the
+// game by the policy, or kNone if there is no open direction. facing
+// is the direction of the last Move, and to_treasure guides
+// kShortestPath to the Treasure.
+Direction BatchSimulator::ChooseMove( const GameSession& s,
+                                      const LevelTopology& topology,
+                                      const uint32_t* const to_treasure,
+                                      const uint32_t* const to_exit,
+                                      const Direction facing,
+                                      RandomGenerator& rng ) const
+{
+  const Coordinate rm = s.Position();
+  const bool exit_open = s.HasTreasure();
+  Direction open[4];
+  unsigned open_count = 0;
+  for( const Direction d : kClockwise )
+  {
+    const RoomBorder border = topology.DirectionCheckUnchecked( rm, d );
+    if( border == RoomBorder::kRoom ||
+        ( border == RoomBorder::kExit && exit_open ) )
+    {
+      open[open_count++] = d;
+    }
+  }
+  if( open_count == 0 )
+  {
+    return Direction::kNone;
+  }
+
+  if( policy_ == PlayerPolicy::kWallFollower )
+  {
+    // Right, ahead, left, then back
+    const unsigned quarters[] = { 1, 0, 3, 2 };
+    for( const unsigned q : quarters )
+    {
+      const Direction d = Turn( facing, q );
+      if( std::find(open, open + open_count, d) != open + open_count )
+      {
+        return d;
+      }
+    }
+  }
+  else if( policy_ == PlayerPolicy::kShortestPath )
+  {
+    // Downhill in the distance field of the current goal
+    const uint32_t* const field = exit_open ? to_exit : to_treasure;
+    const uint32_t here = field[topology.IndexOf( rm )];
+    for( unsigned i = 0; i < open_count; ++i )
+    {
+      if( topology.DirectionCheckUnchecked(rm, open[i]) == RoomBorder::kExit )
+      {
+        return open[i];
+      }
+      const Coordinate next = Neighbour( rm, open[i] );
+      if( field[topology.IndexOf( next )] < here )
+      {
+        return open[i];
+      }
+    }
+    // The goal cannot be reached, so the Player wanders
+  }
+
+  return open[rng.Below( open_count )];
+}
@@ -0,0 +1,367 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the CommandJournal class,
+ * an append-only record of the commands which changed a game, in a
+ * compact binary format.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/command_journal.hpp"
+#include "../include/little_endian.hpp"
+
+namespace
+{
+
+// Identifies the journal format and its version
+constexpr char kMagic[] = "LABYJRN1";
+
+// The largest valid JournalCommand
+constexpr unsigned kLastCommand =
+  static_cast<unsigned>( JournalCommand::kRestart );
+
+// This local function returns true if the command uses a Room, and false
+// otherwise.
+bool UsesRoom( const JournalCommand command );
+
+// This local function returns the largest valid value of the Direction,
+// Inhabitant, or Item which the command uses, or 0 if it uses none.
+unsigned LastValue( const JournalCommand command );
+
+// This local function returns the Direction, Inhabitant, or Item which
+// the command of the entry uses, or 0 if it uses none.
+unsigned ValueOf( const JournalEntry& entry );
+
+// This local function appends a number as an unsigned LEB128 number.
+void AppendNumber( std::vector<uint8_t>& bytes, size_t number );
+
+// This local function returns true if the command uses a Room, and false
+// otherwise.
+bool UsesRoom( const JournalCommand command )
+{
+  switch( command )
+  {
+    case JournalCommand::kMove:
+    case JournalCommand::kShoot:
+    case JournalCommand::kHoldFire:
+    case JournalCommand::kRestart:
+      return false;
+
+    default:
+      return true;
+  }
+}
+
+// This local function returns the largest valid value of the Direction,
+// Inhabitant, or Item which the command uses, or 0 if it uses none.
+unsigned LastValue( const JournalCommand command )
+{
+  switch( command )
+  {
+    case JournalCommand::kConnectRooms:
+    case JournalCommand::kSetExit:
+    case JournalCommand::kMove:
+      return static_cast<unsigned>( Direction::kWest );
+
+    case JournalCommand::kSetInhabitant:
+      return static_cast<unsigned>( Inhabitant::kMirrorCracked );
+
+    case JournalCommand::kSetItem:
+      return static_cast<unsigned>( Item::kTreasureGone );
+
+    default:
+      return 0;
+  }
+}
+
+// This local function returns the Direction, Inhabitant, or Item which
+// the command of the entry uses, or 0 if it uses none.
+unsigned ValueOf( const JournalEntry& entry )
+{
+  switch( entry.command )
+  {
+    case JournalCommand::kConnectRooms:
+    case JournalCommand::kSetExit:
+    case JournalCommand::kMove:
+      return static_cast<unsigned>( entry.direction );
+
+    case JournalCommand::kSetInhabitant:
+      return static_cast<unsigned>( entry.inhabitant );
+
+    case JournalCommand::kSetItem:
+      return static_cast<unsigned>( entry.item );
+
+    default:
+      return 0;
+  }
+}
+
+// This local function appends a number as an unsigned LEB128 number.
+void AppendNumber( std::vector<uint8_t>& bytes, size_t number )
+{
+  while( number >= 0x80 )
+  {
+    bytes.push_back( static_cast<uint8_t>( (number & 0x7F) | 0x80 ) );
+    number >>= 7;
+  }
+  bytes.push_back( static_cast<uint8_t>(number) );
+}
+
+}  // Anonymous namespace
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Parameterized constructor
+// This constructor creates an empty journal of a game of a
+// Labyrinth of the given size, whose Player is given the given
+// number of bullets.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+CommandJournal::CommandJournal( const size_t x_size,
+                                const size_t y_size,
+                                const uint32_t bullets ) :
+  x_size_(x_size),
+  y_size_(y_size),
+  bullets_(bullets)
+{
+  if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: CommandJournal() was given an "\
+      "empty size.\n" );
+  }
+}
+
+// Parameterized constructor
+// This constructor reads a journal from a stream, to its end.
+// An exception is thrown if:
+//   The header is missing or invalid (runtime_error)
+//   A command is damaged, or the stream ends in the middle of one
+//     (runtime_error)
+//   There is not enough memory for the commands (bad_alloc)
+CommandJournal::CommandJournal( std::istream& in )
+{
+  uint64_t words[3];
+  if( !ReadHeader(in, kMagic, words) )
+  {
+    throw std::runtime_error( "Error: CommandJournal() was given a "\
+      "stream which is not a journal.\n" );
+  }
+
+  x_size_ = words[0];
+  y_size_ = words[1];
+  const uint64_t bullets = words[2];
+  if( x_size_ == 0 || y_size_ == 0 || bullets > UINT32_MAX )
+  {
+    throw std::runtime_error( "Error: CommandJournal() was given a "\
+      "journal with an invalid header.\n" );
+  }
+  bullets_ = static_cast<uint32_t>( bullets );
+
+  bytes_.assign( std::istreambuf_iterator<char>(in),
+                 std::istreambuf_iterator<char>() );
+
+  // Every command is decoded once, so that a damaged journal is found
+  // before it is replayed
+  for( size_t offset = 0; offset < bytes_.size(); ++size_ )
+  {
+    Decode( offset );
+  }
+}
+
+// COMMANDS:
+
+// This method appends a command to the journal.
+// An exception is thrown if:
+//   The command is not a valid JournalCommand, or its Direction,
+//     Inhabitant, or Item is not a valid enumerator
+//     (invalid_argument)
+//   The Room is outside the Labyrinth (domain_error)
+//   There is not enough memory for the command (bad_alloc)
+void CommandJournal::Append( const JournalEntry& entry )
+{
+  const unsigned command = static_cast<unsigned>( entry.command );
+  if( command > kLastCommand )
+  {
+    throw std::invalid_argument( "Error: Append() was given an invalid "\
+      "JournalCommand.\n" );
+  }
+  const unsigned value = ValueOf( entry );
+  if( value > LastValue(entry.command) )
+  {
+    throw std::invalid_argument( "Error: Append() was given an invalid "\
+      "Direction, Inhabitant, or Item.\n" );
+  }
+
+  const bool uses_room = UsesRoom( entry.command );
+  if( uses_room && ( entry.room.x >= x_size_ || entry.room.y >= y_size_ ) )
+  {
+    throw std::domain_error( "Error: Append() was given a Room outside "\
+      "the Labyrinth.\n" );
+  }
+
+  bytes_.push_back( static_cast<uint8_t>( command | (value << 4) ) );
+  if( uses_room )
+  {
+    AppendNumber( bytes_, entry.room.x );
+    AppendNumber( bytes_, entry.room.y );
+  }
+  ++size_;
+}
+
+// This method returns the command which begins at the given byte
+// offset, and advances the offset to the next command. The first
+// command begins at offset 0.
+// An exception is thrown if:
+//   The offset is at or beyond the end of the commands
+//     (out_of_range)
+//   The command is damaged (runtime_error)
+JournalEntry CommandJournal::Decode( size_t& offset ) const
+{
+  if( offset >= bytes_.size() )
+  {
+    throw std::out_of_range( "Error: Decode() was given an offset beyond "\
+      "the end of the commands.\n" );
+  }
+
+  const unsigned command = bytes_[offset] & 0x0F;
+  const unsigned value = bytes_[offset] >> 4;
+  JournalEntry entry;
+  entry.command = static_cast<JournalCommand>( command );
+  if( command > kLastCommand || value > LastValue(entry.command) )
+  {
+    throw std::runtime_error( "Error: Decode() found a damaged "\
+      "command.\n" );
+  }
+  size_t next = offset + 1;
+
+  switch( entry.command )
+  {
+    case JournalCommand::kConnectRooms:
+    case JournalCommand::kSetExit:
+    case JournalCommand::kMove:
+      entry.direction = static_cast<Direction>( value );
+      break;
+
+    case JournalCommand::kSetInhabitant:
+      entry.inhabitant = static_cast<Inhabitant>( value );
+      break;
+
+    case JournalCommand::kSetItem:
+      entry.item = static_cast<Item>( value );
+      break;
+
+    default:
+      break;
+  }
+
+  if( UsesRoom(entry.command) )
+  {
+    size_t* const axes[] = { &entry.room.x, &entry.room.y };
+    for( size_t* const axis : axes )
+    {
+      size_t number = 0;
+      unsigned shift = 0;
+      uint8_t byte = 0x80;
+      while( byte & 0x80 )
+      {
+        if( next == bytes_.size() || shift >= 64 )
+        {
+          throw std::runtime_error( "Error: Decode() found a damaged "\
+            "command.\n" );
+        }
+        byte = bytes_[next++];
+        number |= size_t( byte & 0x7F ) << shift;
+        shift += 7;
+      }
+      *axis = number;
+    }
+    if( entry.room.x >= x_size_ || entry.room.y >= y_size_ )
+    {
+      throw std::runtime_error( "Error: Decode() found a command with a "\
+        "Room outside the Labyrinth.\n" );
+    }
+  }
+
+  offset = next;
+  return entry;
+}
+
+// This method returns the number of commands.
+size_t CommandJournal::Size() const
+{
+  return size_;
+}
+
+// This method returns the number of bytes of encoded commands.
+size_t CommandJournal::ByteSize() const
+{
+  return bytes_.size();
+}
+
+// GAME:
+
+// These methods return the size of the Labyrinth of the game.
+size_t CommandJournal::XSize() const
+{
+  return x_size_;
+}
+
+size_t CommandJournal::YSize() const
+{
+  return y_size_;
+}
+
+// This method returns the bullets which the Player is given.
+uint32_t CommandJournal::Bullets() const
+{
+  return bullets_;
+}
+
+// STREAMS:
+
+// This method writes the header and every command to a stream.
+// An exception is thrown if:
+//   The stream cannot be written (runtime_error)
+void CommandJournal::Write( std::ostream& out ) const
+{
+  const uint64_t words[] = { x_size_, y_size_, bullets_ };
+  if( !WriteHeader(out, kMagic, words) )
+  {
+    throw std::runtime_error( "Error: Write() could not write to the "\
+      "stream.\n" );
+  }
+  WriteFrom( out, 0 );
+}
+
+// This method writes the commands from the given byte offset to a
+// stream which already holds the journal up to that offset.
+// An exception is thrown if:
+//   The offset is beyond the end of the commands (out_of_range)
+//   The stream cannot be written (runtime_error)
+void CommandJournal::WriteFrom( std::ostream& out,
+                                const size_t offset ) const
+{
+  if( offset > bytes_.size() )
+  {
+    throw std::out_of_range( "Error: WriteFrom() was given an offset "\
+      "beyond the end of the commands.\n" );
+  }
+  if( !out.write( reinterpret_cast<const char*>(bytes_.data()) + offset,
+                  bytes_.size() - offset ) )
+  {
+    throw std::runtime_error( "Error: WriteFrom() could not write to the "\
+      "stream.\n" );
+  }
+}
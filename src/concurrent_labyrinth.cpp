@@ -0,0 +1,380 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the ConcurrentLabyrinth
+ * class, a copy of a Labyrinth whose Rooms and exit may be read and
+ * changed by several threads at once.
+ *
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/room_cell.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth_status.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/concurrent_labyrinth.hpp"
+
+static_assert( ATOMIC_CHAR_LOCK_FREE == 2,
+               "A Room should be updated without a lock." );
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Parameterized constructor
+// This constructor copies the Labyrinth as it is now.
+// An exception is thrown if:
+//   There is not enough memory for the copy (bad_alloc)
+ConcurrentLabyrinth::ConcurrentLabyrinth( const Labyrinth& l ) :
+  x_size_(l.XSize()),
+  y_size_(l.YSize()),
+  walls_(l.XSize(), l.YSize()),
+  spawn_1_(l.Spawn1()),
+  spawn_2_(l.Spawn2()),
+  exit_(0),
+  treasure_set_(false)
+{
+  walls_.Assign( l.Walls().EastRow(0), l.Walls().SouthRow(0) );
+
+  const size_t rooms = x_size_ * y_size_;
+  rooms_.reset( new std::atomic<uint8_t>[rooms] );
+  bool treasure_set = false;
+  for( size_t i = 0; i < rooms; ++i )
+  {
+    const RoomCell cell = l.Cells()[i];
+    rooms_[i].store( cell.bits, std::memory_order_relaxed );
+    treasure_set |= cell.GetItem() == Item::kTreasure;
+  }
+  treasure_set_.store( treasure_set, std::memory_order_relaxed );
+
+  if( l.HasExit() )
+  {
+    const Coordinate rm = l.ExitRoom();
+    exit_.store( ( ( rm.y * x_size_ + rm.x ) << 3 ) |
+                   static_cast<uint64_t>(l.ExitDirection()),
+                 std::memory_order_relaxed );
+  }
+}
+
+// SIZE:
+
+// These methods return the number of Rooms along each axis.
+size_t ConcurrentLabyrinth::XSize() const
+{
+  return x_size_;
+}
+
+size_t ConcurrentLabyrinth::YSize() const
+{
+  return y_size_;
+}
+
+// SPECIAL ROOMS AND WALLS:
+
+// These methods return the spawn Rooms of the Players.
+Coordinate ConcurrentLabyrinth::Spawn1() const
+{
+  return spawn_1_;
+}
+
+Coordinate ConcurrentLabyrinth::Spawn2() const
+{
+  return spawn_2_;
+}
+
+// This method returns true if the exit has been set, and false
+// otherwise.
+bool ConcurrentLabyrinth::HasExit() const
+{
+  return exit_.load( std::memory_order_acquire ) != 0;
+}
+
+// This method returns the Room which has the exit.
+// An exception is thrown if:
+//   The exit has not been set (logic_error)
+Coordinate ConcurrentLabyrinth::ExitRoom() const
+{
+  const uint64_t exit = exit_.load( std::memory_order_acquire );
+  if( exit == 0 )
+  {
+    throw std::logic_error( "Error: ExitRoom() was called, but the exit "\
+      "has not been set.\n" );
+  }
+  const size_t index = exit >> 3;
+  return Coordinate( index % x_size_, index / x_size_ );
+}
+
+// This method returns true if a Room holds the Treasure, and false
+// otherwise.
+bool ConcurrentLabyrinth::HasTreasure() const
+{
+  return treasure_set_.load( std::memory_order_acquire );
+}
+
+// PLAY:
+
+// This method returns the current Inhabitant of the Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+Inhabitant ConcurrentLabyrinth::GetInhabitant( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: GetInhabitant() was given an "\
+      "invalid Coordinate.\n" );
+  }
+  return GetInhabitantUnchecked( rm );
+}
+
+// This method returns the current Item in the given Room, but does
+// not change it.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+Item ConcurrentLabyrinth::ItemAt( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: ItemAt() was given an invalid "\
+      "Coordinate.\n" );
+  }
+  return ItemAtUnchecked( rm );
+}
+
+// NON-THROWING:
+
+// This method sets the exit of the Labyrinth on a Wall. If several
+// threads set the exit at once, exactly one succeeds.
+// Returns kOutOfBounds, kInvalidDirection, kNotAWall, or
+// kExitAlreadySet upon failure.
+LabyrinthStatus ConcurrentLabyrinth::TrySetExit( const Coordinate rm,
+                                                 const Direction d )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( d == Direction::kNone )
+  {
+    return LabyrinthStatus::kInvalidDirection;
+  }
+  else if( !walls_.IsWall(rm, d) )
+  {
+    return LabyrinthStatus::kNotAWall;
+  }
+
+  uint64_t unset = 0;
+  const uint64_t exit = ( ( rm.y * x_size_ + rm.x ) << 3 ) |
+                        static_cast<uint64_t>(d);
+  if( !exit_.compare_exchange_strong(unset, exit,
+                                     std::memory_order_acq_rel) )
+  {
+    return LabyrinthStatus::kExitAlreadySet;
+  }
+  return LabyrinthStatus::kOk;
+}
+
+// This method attacks the Inhabitant of the Room, and sets the
+// resultant Inhabitant. The value is the Inhabitant attacked.
+// Returns kOutOfBounds or kNoEnemy upon failure.
+LabyrinthResult<Inhabitant>
+ConcurrentLabyrinth::TryAttackEnemy( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    return { LabyrinthStatus::kOutOfBounds, Inhabitant::kNone };
+  }
+  return AttackEnemyUnchecked( rm );
+}
+
+// This method takes the Item from the Room. The value is the Item
+// taken.
+// Returns kOutOfBounds or kNoItem upon failure.
+LabyrinthResult<Item> ConcurrentLabyrinth::TryTakeItem( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    return { LabyrinthStatus::kOutOfBounds, Item::kNone };
+  }
+  return TakeItemUnchecked( rm );
+}
+
+// This method drops the Treasure in the given Room, replacing any
+// Item there, as Labyrinth::TryDropTreasure() does.
+// Returns kOutOfBounds or kTreasureAlreadySet upon failure.
+LabyrinthStatus ConcurrentLabyrinth::TryDropTreasure( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+
+  // Claiming the flag first keeps a second Treasure out of every Room
+  bool set = false;
+  if( !treasure_set_.compare_exchange_strong(set, true,
+                                             std::memory_order_acq_rel) )
+  {
+    return LabyrinthStatus::kTreasureAlreadySet;
+  }
+
+  std::atomic<uint8_t>& cell = CellAt( rm );
+  RoomCell current;
+  current.bits = cell.load( std::memory_order_acquire );
+  RoomCell dropped;
+  do
+  {
+    dropped = current;
+    dropped.SetItem( Item::kTreasure );
+  } while( !cell.compare_exchange_weak(current.bits, dropped.bits,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire) );
+  return LabyrinthStatus::kOk;
+}
+
+// This method returns the type of RoomBorder in the given direction.
+// Returns kOutOfBounds or kInvalidDirection upon failure.
+LabyrinthResult<RoomBorder>
+ConcurrentLabyrinth::TryDirectionCheck( const Coordinate rm,
+                                        const Direction d ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    return { LabyrinthStatus::kOutOfBounds, RoomBorder::kWall };
+  }
+  else if( d == Direction::kNone )
+  {
+    return { LabyrinthStatus::kInvalidDirection, RoomBorder::kWall };
+  }
+  return { LabyrinthStatus::kOk, DirectionCheckUnchecked(rm, d) };
+}
+
+// UNCHECKED:
+
+Inhabitant ConcurrentLabyrinth::GetInhabitantUnchecked(
+  const Coordinate rm ) const
+{
+  RoomCell cell;
+  cell.bits = CellAt( rm ).load( std::memory_order_acquire );
+  return cell.GetInhabitant();
+}
+
+Item ConcurrentLabyrinth::ItemAtUnchecked( const Coordinate rm ) const
+{
+  RoomCell cell;
+  cell.bits = CellAt( rm ).load( std::memory_order_acquire );
+  return cell.GetItem();
+}
+
+// Direction d must not be kNone.
+RoomBorder ConcurrentLabyrinth::DirectionCheckUnchecked(
+  const Coordinate rm,
+  const Direction d ) const
+{
+  const uint64_t exit = ( ( rm.y * x_size_ + rm.x ) << 3 ) |
+                        static_cast<uint64_t>(d);
+  if( exit_.load(std::memory_order_acquire) == exit )
+  {
+    return RoomBorder::kExit;
+  }
+  else if( walls_.IsWall(rm, d) )
+  {
+    return RoomBorder::kWall;
+  }
+  return RoomBorder::kRoom;
+}
+
+// Returns kNoEnemy upon failure.
+LabyrinthResult<Inhabitant>
+ConcurrentLabyrinth::AttackEnemyUnchecked( const Coordinate rm )
+{
+  std::atomic<uint8_t>& cell = CellAt( rm );
+  RoomCell current;
+  current.bits = cell.load( std::memory_order_acquire );
+  while( true )
+  {
+    const Inhabitant inh = current.GetInhabitant();
+    RoomCell attacked = current;
+    switch( inh )
+    {
+      case Inhabitant::kMinotaur:
+        attacked.SetInhabitant( Inhabitant::kMinotaurDead );
+        break;
+
+      case Inhabitant::kMirror:
+        attacked.SetInhabitant( Inhabitant::kMirrorCracked );
+        break;
+
+      default:
+        return { LabyrinthStatus::kNoEnemy, inh };
+    }
+
+    // Upon failure the Room is reloaded, and the attack decided again
+    if( cell.compare_exchange_weak(current.bits, attacked.bits,
+                                   std::memory_order_acq_rel,
+                                   std::memory_order_acquire) )
+    {
+      return { LabyrinthStatus::kOk, inh };
+    }
+  }
+}
+
+// Returns kNoItem upon failure.
+LabyrinthResult<Item>
+ConcurrentLabyrinth::TakeItemUnchecked( const Coordinate rm )
+{
+  std::atomic<uint8_t>& cell = CellAt( rm );
+  RoomCell current;
+  current.bits = cell.load( std::memory_order_acquire );
+  while( true )
+  {
+    const Item itm = current.GetItem();
+    RoomCell taken = current;
+    switch( itm )
+    {
+      case Item::kBullet:
+        taken.SetItem( Item::kNone );
+        break;
+
+      case Item::kTreasure:
+        taken.SetItem( Item::kTreasureGone );
+        break;
+
+      default:
+        return { LabyrinthStatus::kNoItem, itm };
+    }
+
+    // Upon failure the Room is reloaded, and the take decided again
+    if( cell.compare_exchange_weak(current.bits, taken.bits,
+                                   std::memory_order_acq_rel,
+                                   std::memory_order_acquire) )
+    {
+      if( itm == Item::kTreasure )
+      {
+        treasure_set_.store( false, std::memory_order_release );
+      }
+      return { LabyrinthStatus::kOk, itm };
+    }
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method returns true if the Room is within the
+// Labyrinth, and false otherwise.
+bool ConcurrentLabyrinth::WithinBounds( const Coordinate rm ) const
+{
+  return rm.x < x_size_ && rm.y < y_size_;
+}
+
+// This private method returns the atomic byte of the Room.
+// Bounds are not checked.
+std::atomic<uint8_t>& ConcurrentLabyrinth::CellAt( const Coordinate rm ) const
+{
+  return rooms_[rm.y * x_size_ + rm.x];
+}
@@ -0,0 +1,333 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the DistanceField class,
+ * which finds the number of steps from one or more source Rooms to every
+ * Room of a Labyrinth.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/packed_coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_view.hpp"
+#include "../include/room_layout.hpp"
+#include "../include/distance_field.hpp"
+
+constexpr uint32_t DistanceField::kUnreachable;
+
+// Parameterized constructor
+// No distances are held until one of the Compute methods is called.
+DistanceField::DistanceField( const RoomOrder order ) :
+  order_(order)
+{
+}
+
+// SEARCH:
+
+// This method finds the distance of every Room from the given Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   The Labyrinth has 2^32 or more Rooms (domain_error)
+//   There is not enough memory for the distances (bad_alloc)
+void DistanceField::Compute( const LabyrinthView& l, const Coordinate source )
+{
+  Compute( l, std::vector<Coordinate>{ source } );
+}
+
+// This method finds the distance of every Room from the nearest of
+// the given Rooms. A Room may be given more than once.
+// An exception is thrown if:
+//   No Room is given (invalid_argument)
+//   A Room is outside the Labyrinth (domain_error)
+//   The Labyrinth has 2^32 or more Rooms (domain_error)
+//   There is not enough memory for the distances (bad_alloc)
+void DistanceField::Compute( const LabyrinthView& l,
+                             const std::vector<Coordinate>& sources )
+{
+  if( sources.empty() )
+  {
+    throw std::invalid_argument( "Error: Compute() was given no source "\
+      "Rooms.\n" );
+  }
+  for( const Coordinate rm : sources )
+  {
+    if( rm.x >= l.XSize() || rm.y >= l.YSize() )
+    {
+      throw std::domain_error( "Error: Compute() was given a Room which "\
+        "is outside the Labyrinth.\n" );
+    }
+  }
+
+  Reset( l );
+  for( const Coordinate rm : sources )
+  {
+    AddSource( rm );
+  }
+  Search( l );
+}
+
+// This method finds the distance of every Room from the Room which
+// has the exit.
+// An exception is thrown if:
+//   The exit has not been set (logic_error)
+//   The Labyrinth has 2^32 or more Rooms (domain_error)
+//   There is not enough memory for the distances (bad_alloc)
+void DistanceField::ComputeFromExit( const LabyrinthView& l )
+{
+  if( !l.HasExit() )
+  {
+    throw std::logic_error( "Error: ComputeFromExit() was given a "\
+      "Labyrinth without an exit.\n" );
+  }
+
+  Reset( l );
+  AddSource( l.ExitRoom() );
+  Search( l );
+}
+
+// This method finds the distance of every Room from the Room which
+// has the Treasure.
+// An exception is thrown if:
+//   No Room has the Treasure (logic_error)
+//   The Labyrinth has 2^32 or more Rooms (domain_error)
+//   There is not enough memory for the distances (bad_alloc)
+void DistanceField::ComputeFromTreasure( const LabyrinthView& l )
+{
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      const Coordinate rm(x, y);
+      if( l.ItemAtUnchecked(rm) == Item::kTreasure )
+      {
+        Reset( l );
+        AddSource( rm );
+        Search( l );
+        return;
+      }
+    }
+  }
+
+  throw std::logic_error( "Error: ComputeFromTreasure() was given a "\
+    "Labyrinth without the Treasure in a Room.\n" );
+}
+
+// RESULTS:
+
+// This method returns the distance of the Room from the nearest
+// source, or kUnreachable.
+// An exception is thrown if:
+//   Nothing has been computed (logic_error)
+//   The Room is outside the searched Labyrinth (domain_error)
+uint32_t DistanceField::DistanceTo( const Coordinate rm ) const
+{
+  if( x_size_ == 0 )
+  {
+    throw std::logic_error( "Error: DistanceTo() was called before any "\
+      "distances were computed.\n" );
+  }
+  else if( rm.x >= x_size_ || rm.y >= y_size_ )
+  {
+    throw std::domain_error( "Error: DistanceTo() was given a Room which "\
+      "is outside the Labyrinth.\n" );
+  }
+  return distances_[IndexOf( rm )];
+}
+
+// This method returns the array of distances, or nullptr if nothing
+// has been computed. The array is valid until the next search. In
+// row-major order it holds XSize() * YSize() numbers; in Morton
+// order it is indexed like MortonLayout( XSize(), YSize() ), and its
+// padding entries are kUnreachable.
+const uint32_t* DistanceField::Distances() const
+{
+  return x_size_ == 0 ? nullptr : distances_.data();
+}
+
+// This method returns the order of the distances.
+RoomOrder DistanceField::Order() const
+{
+  return order_;
+}
+
+// This method returns the greatest distance of a reachable Room.
+uint32_t DistanceField::MaxDistance() const
+{
+  return max_distance_;
+}
+
+// This method returns the number of Rooms which can be reached,
+// including the sources.
+size_t DistanceField::ReachableCount() const
+{
+  return reachable_count_;
+}
+
+// These methods return the size of the searched Labyrinth, or 0 if
+// nothing has been computed.
+size_t DistanceField::XSize() const
+{
+  return x_size_;
+}
+
+size_t DistanceField::YSize() const
+{
+  return y_size_;
+}
+
+// PRIVATE METHODS:
+
+// This private method prepares the distances for a search of the
+// Labyrinth, marking every Room as unreachable.
+// An exception is thrown if:
+//   The Labyrinth has 2^32 or more Rooms (domain_error)
+//   There is not enough memory for the distances (bad_alloc)
+void DistanceField::Reset( const LabyrinthView& l )
+{
+  // Labyrinth sizes have already been checked against overflow
+  const size_t rooms = l.XSize() * l.YSize();
+  if( rooms >= kUnreachable )
+  {
+    throw std::domain_error( "Error: DistanceField was given a Labyrinth "\
+      "with 2^32 or more Rooms.\n" );
+  }
+
+  // Nothing is held if memory runs out below
+  x_size_ = 0;
+  y_size_ = 0;
+
+  // Neither vector allocates if it has held as many Rooms before. The
+  // search may write one Room past the last Room it queues.
+  const size_t capacity = order_ == RoomOrder::kMorton ?
+    MortonLayout( l.XSize(), l.YSize() ).Capacity() : rooms;
+  distances_.assign( capacity, kUnreachable );
+  if( queue_.size() < rooms + 1 )
+  {
+    queue_.resize( rooms + 1 );
+  }
+  queue_end_ = 0;
+
+  x_size_ = l.XSize();
+  y_size_ = l.YSize();
+  max_distance_ = 0;
+  reachable_count_ = 0;
+}
+
+// This private method returns the index of the Room's distance.
+// Bounds are not checked; the Room must be within the Labyrinth.
+size_t DistanceField::IndexOf( const Coordinate rm ) const
+{
+  const PackedCoordinate c( rm );
+  if( order_ == RoomOrder::kMorton )
+  {
+    return MortonLayout( x_size_, y_size_ ).Index( c.x, c.y );
+  }
+  return RowMajorLayout( x_size_, y_size_ ).Index( c.x, c.y );
+}
+
+// This private method adds a source Room to the search queue.
+// Bounds are not checked; the Room must be within the Labyrinth.
+void DistanceField::AddSource( const Coordinate rm )
+{
+  const size_t i = IndexOf( rm );
+  if( distances_[i] != 0 )
+  {
+    distances_[i] = 0;
+    queue_[queue_end_++] = PackedCoordinate( rm );
+  }
+}
+
+// This private method runs the breadth-first search from the queued
+// sources, in the order of the distances.
+void DistanceField::Search( const LabyrinthView& l )
+{
+  if( order_ == RoomOrder::kMorton )
+  {
+    Search( l, MortonLayout(x_size_, y_size_) );
+  }
+  else
+  {
+    Search( l, RowMajorLayout(x_size_, y_size_) );
+  }
+}
+
+// This private method runs the breadth-first search with the given
+// layout of the distances.
+//
+// The Walls are read straight from the WallGrid bitmaps: the east and
+// south Walls of a Room are its own bits, and the west and north Walls
+// are the bits of its neighbours. Every Room enters the queue at most
+// once, so the queue never holds more than one entry per Room. The queue
+// holds the Rooms themselves, which are needed to read the Walls, and
+// the layout finds the index of each Room's distance.
+template <typename Layout>
+void DistanceField::Search( const LabyrinthView& l, const Layout& layout )
+{
+  // The rows of each bitmap follow one another
+  const uint64_t* const east = l.EastRow( 0 );
+  const uint64_t* const south = l.SouthRow( 0 );
+  const size_t words_per_row = l.WordsPerRow();
+
+  uint32_t* const distances = distances_.data();
+  PackedCoordinate* const queue = queue_.data();
+  size_t end = queue_end_;
+
+  // Returns bit x of row y of a bitmap, i.e. whether the Wall exists
+  const auto wall = [words_per_row]( const uint64_t* const bitmap,
+                                     const uint32_t x,
+                                     const uint32_t y )
+  {
+    return ( bitmap[y * words_per_row + x / 64] >> (x % 64) ) & 1;
+  };
+
+  for( size_t front = 0; front < end; ++front )
+  {
+    const uint32_t x = queue[front].x;
+    const uint32_t y = queue[front].y;
+    const size_t i = layout.Index( x, y );
+    const uint32_t next = distances[i] + 1;
+
+    // Open Walls, as 1 bits; the west and north Walls of the first column
+    // and row are on the outside
+    const uint32_t open_east = !wall( east, x, y );
+    const uint32_t open_south = !wall( south, x, y );
+    const uint32_t open_west = ( x != 0 ) & !wall( east, x - (x != 0), y );
+    const uint32_t open_north = ( y != 0 ) & !wall( south, x, y - (y != 0) );
+
+    // Visits neighbour n at (n_x, n_y) if the Wall to it is open and it
+    // has not been reached yet. Mazes make the Walls unpredictable, so
+    // this is done without branches: a closed Wall visits Room i itself,
+    // which has always been reached.
+    const auto visit = [distances, queue, &end, next, i]( const uint32_t open,
+                                                         const size_t n,
+                                                         const uint32_t n_x,
+                                                         const uint32_t n_y )
+    {
+      const size_t target = i ^ ( (i ^ n) & (0 - size_t(open)) );
+      const uint32_t unreached = ( distances[target] == kUnreachable );
+      distances[target] = unreached ? next : distances[target];
+      queue[end] = PackedCoordinate( n_x, n_y );
+      end += unreached;
+    };
+
+    visit( open_east, layout.East(i), x + open_east, y );
+    visit( open_south, layout.South(i), x, y + open_south );
+    visit( open_west, layout.West(i), x - open_west, y );
+    visit( open_north, layout.North(i), x, y - open_north );
+  }
+
+  queue_end_ = end;
+  reachable_count_ = end;
+  max_distance_ = end == 0 ? 0 :
+    distances[layout.Index( queue[end - 1].x, queue[end - 1].y )];
+}
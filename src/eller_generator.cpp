@@ -0,0 +1,202 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the EllerGenerator class,
+ * which generates a maze one row at a time with Eller's algorithm.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/wall_grid.hpp"
+#include "../include/maze_stream.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/eller_generator.hpp"
+
+// Parameterized constructor
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+EllerGenerator::EllerGenerator( const size_t x_size,
+                                const size_t y_size,
+                                const uint64_t seed ) :
+  x_size_(x_size),
+  y_size_(y_size),
+  rng_(seed)
+{
+  if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: EllerGenerator() was given an empty "\
+      "size.\n" );
+  }
+}
+
+// This method generates a maze, giving each row to the sink.
+// An exception is thrown if:
+//   There is not enough memory for one row (bad_alloc)
+//   The sink throws
+//
+// Each Room of the current row is labelled with the set of Rooms it is
+// connected to so far. Labels are numbers below x_size, merged within a
+// row through a union-find forest over the labels, and renumbered before
+// the next row so that the forest can be reset.
+void EllerGenerator::Generate( const RowSink& sink )
+{
+  const size_t words = WallGrid::WordsPerRow( x_size_ );
+  std::vector<uint64_t> east( words );
+  std::vector<uint64_t> south( words );
+
+  std::vector<size_t> label( x_size_ );
+  std::vector<size_t> parent( x_size_ );
+  std::vector<size_t> last_room( x_size_ );  // Last Room of each set
+  std::vector<uint8_t> opens_south( x_size_ );
+  std::vector<uint8_t> label_used( x_size_ );
+  std::iota( label.begin(), label.end(), size_t(0) );
+
+  // Finds the set of a label, halving the path along the way
+  const auto find = [&parent]( size_t l )
+  {
+    while( parent[l] != l )
+    {
+      parent[l] = parent[parent[l]];
+      l = parent[l];
+    }
+    return l;
+  };
+
+  // Clears bit x of a row, i.e. removes the Wall
+  const auto open = []( std::vector<uint64_t>& row, const size_t x )
+  {
+    row[x / 64] &= ~( uint64_t(1) << (x % 64) );
+  };
+
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    const bool last_row = ( y == y_size_ - 1 );
+    std::fill( east.begin(), east.end(), ~uint64_t(0) );
+    std::fill( south.begin(), south.end(), ~uint64_t(0) );
+    std::iota( parent.begin(), parent.end(), size_t(0) );
+
+    // Randomly join adjacent Rooms of different sets; the last row joins
+    // every one so that the whole maze is connected.
+    for( size_t x = 0; x + 1 < x_size_; ++x )
+    {
+      const size_t set_1 = find( label[x] );
+      const size_t set_2 = find( label[x + 1] );
+      if( set_1 != set_2 && ( last_row || RandomBit() ) )
+      {
+        parent[set_2] = set_1;
+        open( east, x );
+      }
+    }
+
+    if( !last_row )
+    {
+      // Randomly open Rooms to the south, then make sure that every set
+      // opens to the south at least once.
+      std::fill( opens_south.begin(), opens_south.end(), 0 );
+      for( size_t x = 0; x < x_size_; ++x )
+      {
+        label[x] = find( label[x] );
+        last_room[label[x]] = x;
+        if( RandomBit() )
+        {
+          open( south, x );
+          opens_south[label[x]] = 1;
+        }
+      }
+      for( size_t x = 0; x < x_size_; ++x )
+      {
+        if( !opens_south[label[x]] )
+        {
+          open( south, last_room[label[x]] );
+          opens_south[label[x]] = 1;
+        }
+      }
+
+      // Rooms below an opening keep their set; the rest each begin a new
+      // set with an unused label.
+      std::fill( label_used.begin(), label_used.end(), 0 );
+      for( size_t x = 0; x < x_size_; ++x )
+      {
+        if( !( (south[x / 64] >> (x % 64)) & 1 ) )
+        {
+          label_used[label[x]] = 1;
+        }
+      }
+      size_t next_label = 0;
+      for( size_t x = 0; x < x_size_; ++x )
+      {
+        if( (south[x / 64] >> (x % 64)) & 1 )
+        {
+          while( label_used[next_label] )
+          {
+            ++next_label;
+          }
+          label[x] = next_label;
+          label_used[next_label] = 1;
+        }
+      }
+    }
+
+    sink( y, east.data(), south.data() );
+  }
+}
+
+// This method generates a maze into a MazeStreamWriter of the same
+// size which has not been written to yet.
+// An exception is thrown if:
+//   The writer is for a different size or has been written to
+//     (invalid_argument)
+//   There is not enough memory for one row (bad_alloc)
+//   The writer throws
+void EllerGenerator::Generate( MazeStreamWriter& writer )
+{
+  if( writer.XSize() != x_size_ || writer.YSize() != y_size_ ||
+      writer.RowsWritten() != 0 )
+  {
+    throw std::invalid_argument( "Error: Generate() was given a writer "\
+      "which is not for a new maze of the same size.\n" );
+  }
+
+  Generate( [&writer]( const size_t y,
+                       const uint64_t* const east,
+                       const uint64_t* const south )
+  {
+    (void)(y);
+    writer.WriteRow( east, south );
+  } );
+}
+
+// These methods return the size of the generated mazes.
+size_t EllerGenerator::XSize() const
+{
+  return x_size_;
+}
+
+size_t EllerGenerator::YSize() const
+{
+  return y_size_;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns a random bit.
+bool EllerGenerator::RandomBit()
+{
+  if( bits_left_ == 0 )
+  {
+    bits_ = rng_.Next();
+    bits_left_ = 64;
+  }
+  const bool bit = bits_ & 1;
+  bits_ >>= 1;
+  --bits_left_;
+  return bit;
+}
@@ -0,0 +1,279 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the FloodFill class, which
+ * finds every Room of a Labyrinth which can be reached from one or more
+ * source Rooms, 64 Rooms at a time.
+ *
+ */
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_view.hpp"
+#include "../include/flood_fill.hpp"
+
+// Default constructor
+// No Rooms are held until one of the Fill methods is called.
+FloodFill::FloodFill()
+{
+}
+
+// FILL:
+
+// This method finds every Room which can be reached from the given
+// Room.
+// An exception is thrown if:
+//   The Room is outside the Labyrinth (domain_error)
+//   There is not enough memory for the bitmap (bad_alloc)
+void FloodFill::Fill( const LabyrinthView& l, const Coordinate source )
+{
+  Fill( l, std::vector<Coordinate>{ source } );
+}
+
+// This method finds every Room which can be reached from any of the
+// given Rooms. A Room may be given more than once.
+// An exception is thrown if:
+//   No Room is given (invalid_argument)
+//   A Room is outside the Labyrinth (domain_error)
+//   There is not enough memory for the bitmap (bad_alloc)
+void FloodFill::Fill( const LabyrinthView& l,
+                      const std::vector<Coordinate>& sources )
+{
+  if( sources.empty() )
+  {
+    throw std::invalid_argument( "Error: Fill() was given no source "\
+      "Rooms.\n" );
+  }
+  for( const Coordinate rm : sources )
+  {
+    if( rm.x >= l.XSize() || rm.y >= l.YSize() )
+    {
+      throw std::domain_error( "Error: Fill() was given a Room which is "\
+        "outside the Labyrinth.\n" );
+    }
+  }
+
+  Reset( l );
+  for( const Coordinate rm : sources )
+  {
+    AddSource( rm );
+  }
+  Spread( l );
+}
+
+// RESULTS:
+
+// This method returns true if the Room can be reached, and false
+// otherwise.
+// An exception is thrown if:
+//   Nothing has been filled (logic_error)
+//   The Room is outside the filled Labyrinth (domain_error)
+bool FloodFill::IsReachable( const Coordinate rm ) const
+{
+  if( x_size_ == 0 )
+  {
+    throw std::logic_error( "Error: IsReachable() was called before any "\
+      "Rooms were filled.\n" );
+  }
+  else if( rm.x >= x_size_ || rm.y >= y_size_ )
+  {
+    throw std::domain_error( "Error: IsReachable() was given a Room which "\
+      "is outside the Labyrinth.\n" );
+  }
+  return ( reached_[rm.y * words_per_row_ + rm.x / 64] >> (rm.x % 64) ) & 1;
+}
+
+// This method returns the number of Rooms which can be reached,
+// including the sources.
+size_t FloodFill::ReachableCount() const
+{
+  size_t count = 0;
+  for( const uint64_t word : reached_ )
+  {
+    count += std::bitset<64>( word ).count();
+  }
+  return count;
+}
+
+// This method returns the first word of row y of the bitmap.
+// Bounds are not checked; y must be less than YSize().
+const uint64_t* FloodFill::Row( const size_t y ) const
+{
+  return reached_.data() + y * words_per_row_;
+}
+
+// This method returns the number of 64-bit words in each bitmap row.
+size_t FloodFill::WordsPerRow() const
+{
+  return words_per_row_;
+}
+
+// These methods return the size of the filled Labyrinth, or 0 if
+// nothing has been filled.
+size_t FloodFill::XSize() const
+{
+  return x_size_;
+}
+
+size_t FloodFill::YSize() const
+{
+  return y_size_;
+}
+
+// PRIVATE METHODS:
+
+// This private method prepares the bitmap for a fill of the
+// Labyrinth, with no Room reached.
+// An exception is thrown if:
+//   There is not enough memory for the bitmap (bad_alloc)
+void FloodFill::Reset( const LabyrinthView& l )
+{
+  // Nothing is held if memory runs out below
+  x_size_ = 0;
+  y_size_ = 0;
+  words_per_row_ = 0;
+
+  // None of the vectors allocate if they have held as many words before
+  const size_t words_per_row = l.WordsPerRow();
+  const size_t words = words_per_row * l.YSize();
+  reached_.assign( words, 0 );
+  queued_.assign( words, 0 );
+  worklist_.clear();
+  worklist_.reserve( words );
+
+  x_size_ = l.XSize();
+  y_size_ = l.YSize();
+  words_per_row_ = words_per_row;
+}
+
+// This private method marks a source Room as reached.
+// Bounds are not checked; the Room must be within the Labyrinth.
+void FloodFill::AddSource( const Coordinate rm )
+{
+  const size_t u = rm.y * words_per_row_ + rm.x / 64;
+  reached_[u] |= uint64_t(1) << (rm.x % 64);
+  if( !queued_[u] )
+  {
+    queued_[u] = 1;
+    worklist_.push_back( u );
+  }
+}
+
+// This private method spreads the reached Rooms through the Labyrinth
+// until no more Rooms can be reached.
+//
+// The worklist holds the words whose Rooms may open onto Rooms which have
+// not been reached yet. Each word taken from it gathers the Rooms reached
+// through the open south Walls of the word above, the open north Walls of
+// the word below, and the Walls across the ends of the word, then spreads
+// them along the row within the word. A neighbouring word is added to the
+// worklist only if it gains a Room, so every word taken makes progress.
+void FloodFill::Spread( const LabyrinthView& l )
+{
+  // The rows of each bitmap follow one another
+  const uint64_t* const east = l.EastRow( 0 );
+  const uint64_t* const south = l.SouthRow( 0 );
+  const size_t wpr = words_per_row_;
+  const size_t words = wpr * y_size_;
+  uint64_t* const reached = reached_.data();
+  uint8_t* const queued = queued_.data();
+
+  // Adds word v to the worklist if it is not already there
+  const auto push = [this, queued]( const size_t v )
+  {
+    if( !queued[v] )
+    {
+      queued[v] = 1;
+      worklist_.push_back( v );
+    }
+  };
+
+  while( !worklist_.empty() )
+  {
+    const size_t u = worklist_.back();
+    worklist_.pop_back();
+    queued[u] = 0;
+
+    const size_t w = u % wpr;
+    const bool has_up = ( u >= wpr );
+    const bool has_down = ( u + wpr < words );
+    const bool has_left = ( w != 0 );
+    const bool has_right = ( w + 1 != wpr );
+
+    // Open Walls are clear bits of the WallGrid, so they are set here.
+    // Outer Walls and padding bits are never open.
+    const uint64_t open_east = ~east[u];
+    const uint64_t open_up = has_up ? ~south[u - wpr] : 0;
+    const uint64_t open_down = ~south[u];
+
+    uint64_t r = reached[u];
+    if( has_up )
+    {
+      r |= reached[u - wpr] & open_up;
+    }
+    if( has_down )
+    {
+      r |= reached[u + wpr] & open_down;
+    }
+    if( has_left )
+    {
+      r |= ( reached[u - 1] & ~east[u - 1] ) >> 63;
+    }
+    if( has_right )
+    {
+      r |= ( reached[u + 1] & (open_east >> 63) ) << 63;
+    }
+    r = SpreadWithinWord( r, open_east );
+    reached[u] = r;
+
+    if( has_up && ( r & open_up & ~reached[u - wpr] ) )
+    {
+      push( u - wpr );
+    }
+    if( has_down && ( r & open_down & ~reached[u + wpr] ) )
+    {
+      push( u + wpr );
+    }
+    if( has_left && ( r & (~east[u - 1] >> 63) & ~(reached[u - 1] >> 63) ) )
+    {
+      push( u - 1 );
+    }
+    if( has_right && ( ((r & open_east) >> 63) & ~reached[u + 1] ) )
+    {
+      push( u + 1 );
+    }
+  }
+}
+
+// This private method returns the bits of the word g, spread east and
+// west through the open bits of p: bit x of p is set if the Room of
+// bit x opens east onto the Room of bit (x + 1).
+//
+// This is a Kogge-Stone fill: after the step with shift k, a bit has
+// spread over every open run of fewer than 2k Walls, and bit x of the
+// mask is set if the k Walls east of bit x are all open.
+uint64_t FloodFill::SpreadWithinWord( uint64_t g, const uint64_t p )
+{
+  uint64_t east = p;
+  uint64_t west = p;
+  for( unsigned k = 1; k < 64; k *= 2 )
+  {
+    g |= ( g & east ) << k;
+    east &= east >> k;
+  }
+  for( unsigned k = 1; k < 64; k *= 2 )
+  {
+    g |= ( g >> k ) & west;
+    west &= west >> k;
+  }
+  return g;
+}
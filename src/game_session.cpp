@@ -0,0 +1,370 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the GameSession class,
+ * which plays one Player through a Labyrinth by the rules of
+ * GameInstructions.md, without any input or output.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/room_overlay.hpp"
+#include "../include/game_session.hpp"
+
+constexpr uint32_t GameSession::kLives;
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Parameterized constructor
+// The Player begins in the primary spawn of the Labyrinth with the
+// given number of bullets, and is given as many again each time it
+// respawns.
+GameSession::GameSession( Labyrinth& l, const uint32_t bullets ) :
+  labyrinth_(&l),
+  overlay_(nullptr),
+  respawn_bullets_(bullets)
+{
+  Restart();
+}
+
+// Parameterized constructor
+// As above, for a game of a shared level.
+GameSession::GameSession( RoomOverlay& overlay, const uint32_t bullets ) :
+  labyrinth_(nullptr),
+  overlay_(&overlay),
+  respawn_bullets_(bullets)
+{
+  Restart();
+}
+
+// ACTIONS:
+
+// This method moves the Player through a broken Wall to the next
+// Room, or out through the exit with the Treasure.
+// Returns kNotExploring, kInvalidDirection, kWall, or kNoTreasure
+// upon failure.
+SessionStatus GameSession::Move( const Direction d )
+{
+  if( state_ != SessionState::kExploring )
+  {
+    return SessionStatus::kNotExploring;
+  }
+
+  switch( d )
+  {
+    case Direction::kNorth:
+    case Direction::kEast:
+    case Direction::kSouth:
+    case Direction::kWest:
+      break;
+
+    default:
+      return SessionStatus::kInvalidDirection;
+  }
+
+  // The Player is always within the Labyrinth
+  switch( BorderAt(d) )
+  {
+    case RoomBorder::kWall:
+      return SessionStatus::kWall;
+
+    case RoomBorder::kExit:
+      if( !has_treasure_ )
+      {
+        return SessionStatus::kNoTreasure;
+      }
+      state_ = SessionState::kWon;
+      return SessionStatus::kOk;
+
+    case RoomBorder::kRoom:
+      break;
+  }
+
+  switch( d )
+  {
+    case Direction::kNorth:
+      --position_.y;
+      break;
+
+    case Direction::kEast:
+      ++position_.x;
+      break;
+
+    case Direction::kSouth:
+      ++position_.y;
+      break;
+
+    default:
+      --position_.x;
+      break;
+  }
+  ++steps_;
+  Enter();
+  return SessionStatus::kOk;
+}
+
+// This method shoots the eyes in the Player's Room, using a bullet,
+// and takes the Item of the Room.
+// Returns kNoEncounter or kNoBullets upon failure.
+SessionStatus GameSession::Shoot()
+{
+  if( state_ != SessionState::kEncounter )
+  {
+    return SessionStatus::kNoEncounter;
+  }
+  else if( bullets_ == 0 )
+  {
+    return SessionStatus::kNoBullets;
+  }
+
+  --bullets_;
+  AttackHere();
+  state_ = SessionState::kExploring;
+  TakeItem();
+  return SessionStatus::kOk;
+}
+
+// This method holds fire at the eyes in the Player's Room. The
+// Player takes the Item of the Room if the eyes were a Mirror, and
+// loses a life if they were a Minotaur.
+// Returns kNoEncounter upon failure.
+SessionStatus GameSession::HoldFire()
+{
+  if( state_ != SessionState::kEncounter )
+  {
+    return SessionStatus::kNoEncounter;
+  }
+
+  if( InhabitantHere() == Inhabitant::kMinotaur )
+  {
+    Die();
+  }
+  else
+  {
+    state_ = SessionState::kExploring;
+    TakeItem();
+  }
+  return SessionStatus::kOk;
+}
+
+// This method starts a new game in the same Labyrinth, as if the
+// GameSession had just been constructed. The Labyrinth or
+// RoomOverlay is not restored.
+void GameSession::Restart()
+{
+  position_ = Spawn1();
+  bullets_ = respawn_bullets_;
+  lives_ = kLives;
+  has_treasure_ = false;
+  state_ = SessionState::kExploring;
+  steps_ = 0;
+}
+
+// STATE:
+
+// This method returns the state of the game.
+SessionState GameSession::State() const
+{
+  return state_;
+}
+
+// This method returns the Room of the Player.
+Coordinate GameSession::Position() const
+{
+  return position_;
+}
+
+// This method returns the bullets of the Player.
+uint32_t GameSession::Bullets() const
+{
+  return bullets_;
+}
+
+// This method returns the lives left, including the current one.
+uint32_t GameSession::Lives() const
+{
+  return lives_;
+}
+
+// This method returns true if the Player holds the Treasure, and
+// false otherwise.
+bool GameSession::HasTreasure() const
+{
+  return has_treasure_;
+}
+
+// This method returns the number of Moves which changed Room.
+size_t GameSession::Steps() const
+{
+  return steps_;
+}
+
+// SNAPSHOTS:
+
+// This method returns the state of the Player.
+PlayerState GameSession::SavePlayer() const
+{
+  PlayerState player;
+  player.position = position_;
+  player.bullets = bullets_;
+  player.lives = lives_;
+  player.has_treasure = has_treasure_;
+  player.state = state_;
+  player.steps = steps_;
+  return player;
+}
+
+// This method restores the Player to a saved state. The state must
+// have been saved from a game of the same level, so that the
+// Player's Room is within the Labyrinth.
+void GameSession::RestorePlayer( const PlayerState& player )
+{
+  position_ = player.position;
+  bullets_ = player.bullets;
+  lives_ = player.lives;
+  has_treasure_ = player.has_treasure;
+  state_ = player.state;
+  steps_ = player.steps;
+}
+
+// PRIVATE METHODS:
+
+// These private methods read and change the Player's Room, and return
+// the spawns, in the Labyrinth or the RoomOverlay.
+RoomBorder GameSession::BorderAt( const Direction d ) const
+{
+  return overlay_ != nullptr ?
+    overlay_->DirectionCheckUnchecked( position_, d ) :
+    labyrinth_->DirectionCheckUnchecked( position_, d );
+}
+
+Inhabitant GameSession::InhabitantHere() const
+{
+  return overlay_ != nullptr ?
+    overlay_->GetInhabitantUnchecked( position_ ) :
+    labyrinth_->GetInhabitantUnchecked( position_ );
+}
+
+Item GameSession::ItemHere() const
+{
+  return overlay_ != nullptr ?
+    overlay_->ItemAtUnchecked( position_ ) :
+    labyrinth_->ItemAtUnchecked( position_ );
+}
+
+void GameSession::AttackHere()
+{
+  if( overlay_ != nullptr )
+  {
+    overlay_->AttackEnemyUnchecked( position_ );
+  }
+  else
+  {
+    labyrinth_->AttackEnemyUnchecked( position_ );
+  }
+}
+
+void GameSession::TakeItemHere()
+{
+  if( overlay_ != nullptr )
+  {
+    overlay_->TakeItemUnchecked( position_ );
+  }
+  else
+  {
+    labyrinth_->TakeItemUnchecked( position_ );
+  }
+}
+
+// The Treasure is not in any Room while it is held, so this succeeds;
+// the caller first empties the Room, which may hold only one Item
+void GameSession::DropTreasureHere()
+{
+  if( overlay_ != nullptr )
+  {
+    overlay_->TryDropTreasure( position_ );
+  }
+  else
+  {
+    labyrinth_->TryDropTreasure( position_ );
+  }
+}
+
+Coordinate GameSession::Spawn1() const
+{
+  return overlay_ != nullptr ? overlay_->Topology().Spawn1() :
+                               labyrinth_->Spawn1();
+}
+
+Coordinate GameSession::Spawn2() const
+{
+  return overlay_ != nullptr ? overlay_->Topology().Spawn2() :
+                               labyrinth_->Spawn2();
+}
+
+// This private method enters the Player's Room: an encounter begins
+// if there are eyes, and the Item is taken otherwise.
+void GameSession::Enter()
+{
+  switch( InhabitantHere() )
+  {
+    case Inhabitant::kMinotaur:
+    case Inhabitant::kMirror:
+      state_ = SessionState::kEncounter;
+      break;
+
+    default:
+      TakeItem();
+      break;
+  }
+}
+
+// This private method takes the Item of the Player's Room, if any.
+void GameSession::TakeItem()
+{
+  switch( ItemHere() )
+  {
+    case Item::kBullet:
+      ++bullets_;
+      break;
+
+    case Item::kTreasure:
+      has_treasure_ = true;
+      break;
+
+    default:
+      return;
+  }
+  TakeItemHere();
+}
+
+// This private method loses a life, dropping the Treasure, and
+// respawns the Player or ends the game. A Room holds only one Item, so
+// a Player with the Treasure takes the bullet of the Room before
+// dropping the Treasure in it.
+void GameSession::Die()
+{
+  if( has_treasure_ )
+  {
+    TakeItem();
+    DropTreasureHere();
+    has_treasure_ = false;
+  }
+
+  --lives_;
+  if( lives_ == 0 )
+  {
+    state_ = SessionState::kLost;
+    return;
+  }
+  position_ = Spawn2();
+  bullets_ += respawn_bullets_;
+  state_ = SessionState::kExploring;
+}
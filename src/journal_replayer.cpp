@@ -0,0 +1,122 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the JournalReplayer class,
+ * which rebuilds the game of a CommandJournal as it was after any number
+ * of commands.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/labyrinth.hpp"
+#include "../include/game_session.hpp"
+#include "../include/command_journal.hpp"
+#include "../include/journaled_game.hpp"
+#include "../include/journal_replayer.hpp"
+
+constexpr size_t JournalReplayer::kSnapshotInterval;
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Parameterized constructor
+// The replay begins at step 0, before the first command.
+// An exception is thrown if:
+//   The snapshot interval is 0 (invalid_argument)
+//   There is not enough memory for the game (bad_alloc)
+JournalReplayer::JournalReplayer( const CommandJournal& journal,
+                                  const size_t snapshot_interval ) :
+  journal_(journal),
+  snapshot_interval_(snapshot_interval),
+  game_(journal.XSize(), journal.YSize(), journal.Bullets(), false)
+{
+  if( snapshot_interval == 0 )
+  {
+    throw std::invalid_argument( "Error: JournalReplayer() was given a "\
+      "snapshot interval of 0.\n" );
+  }
+  checkpoints_.push_back( { game_.Save(), 0 } );
+}
+
+// REPLAY:
+
+// This method rebuilds the game as it was after the given number
+// of commands.
+// An exception is thrown if:
+//   The step is beyond the number of commands (out_of_range)
+//   A command is damaged or cannot be replayed (the exception of
+//     CommandJournal::Decode() or JournaledGame::Apply()); the
+//     replay is left at the step before the command
+void JournalReplayer::Seek( const size_t step )
+{
+  if( step > journal_.Size() )
+  {
+    throw std::out_of_range( "Error: Seek() was given a step beyond the "\
+      "number of commands.\n" );
+  }
+
+  // The nearest snapshot is restored only if replaying forward from the
+  // current step would take longer
+  const size_t nearest =
+    std::min( step / snapshot_interval_, checkpoints_.size() - 1 );
+  if( step < step_ || nearest * snapshot_interval_ > step_ )
+  {
+    game_.Restore( checkpoints_[nearest].snapshot );
+    step_ = nearest * snapshot_interval_;
+    offset_ = checkpoints_[nearest].offset;
+  }
+
+  while( step_ < step )
+  {
+    size_t next = offset_;
+    game_.Apply( journal_.Decode(next) );
+    offset_ = next;
+    ++step_;
+    ++commands_replayed_;
+
+    if( step_ % snapshot_interval_ == 0 &&
+        step_ / snapshot_interval_ == checkpoints_.size() )
+    {
+      checkpoints_.push_back( { game_.Save(), offset_ } );
+    }
+  }
+}
+
+// This method returns the number of commands applied.
+size_t JournalReplayer::Step() const
+{
+  return step_;
+}
+
+// This method returns the Labyrinth of the game.
+const Labyrinth& JournalReplayer::Level() const
+{
+  return game_.Level();
+}
+
+// This method returns the Player of the game.
+const GameSession& JournalReplayer::Session() const
+{
+  return game_.Session();
+}
+
+// STATISTICS:
+
+// This method returns the number of snapshots saved.
+size_t JournalReplayer::SnapshotCount() const
+{
+  return checkpoints_.size();
+}
+
+// This method returns the number of commands which have been
+// applied since the JournalReplayer was constructed, including
+// those replayed again after a snapshot was restored.
+size_t JournalReplayer::CommandsReplayed() const
+{
+  return commands_replayed_;
+}
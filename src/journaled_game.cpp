@@ -0,0 +1,471 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the JournaledGame class,
+ * a Labyrinth and a GameSession whose changes are recorded in a
+ * CommandJournal.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room_cell.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_layout.hpp"
+#include "../include/game_session.hpp"
+#include "../include/command_journal.hpp"
+#include "../include/journaled_game.hpp"
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Parameterized constructor
+// This constructor creates an empty Labyrinth of the given size,
+// whose Player is given the given number of bullets.
+// An exception is thrown if:
+//   The Labyrinth() constructor would throw for the size
+JournaledGame::JournaledGame( const size_t x_size,
+                              const size_t y_size,
+                              const uint32_t bullets,
+                              const bool record ) :
+  journal_(x_size, y_size, bullets),
+  record_(record),
+  labyrinth_(std::make_unique<Labyrinth>(x_size, y_size)),
+  session_(std::make_unique<GameSession>(*labyrinth_, bullets))
+{
+}
+
+// Parameterized constructor
+// This constructor copies the Labyrinth as it is now, recording
+// the setup commands which rebuild it, and then calls Restart(),
+// so that a level built by a MazeGenerator can be journaled.
+// An exception is thrown if:
+//   There is not enough memory for the copy (bad_alloc)
+JournaledGame::JournaledGame( const Labyrinth& l, const uint32_t bullets ) :
+  JournaledGame( l.XSize(), l.YSize(), bullets )
+{
+  // The exit is set after the Rooms are connected, as ConnectRooms()
+  // does not break the Wall of the exit
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      const Coordinate rm( x, y );
+      if( l.DirectionCheckUnchecked(rm, Direction::kEast) ==
+            RoomBorder::kRoom )
+      {
+        ConnectRooms( rm, Coordinate(x + 1, y) );
+      }
+      if( l.DirectionCheckUnchecked(rm, Direction::kSouth) ==
+            RoomBorder::kRoom )
+      {
+        ConnectRooms( rm, Coordinate(x, y + 1) );
+      }
+
+      const Inhabitant inh = l.GetInhabitantUnchecked( rm );
+      if( inh != Inhabitant::kNone )
+      {
+        SetInhabitant( rm, inh );
+      }
+      const Item itm = l.ItemAtUnchecked( rm );
+      if( itm != Item::kNone )
+      {
+        SetItem( rm, itm );
+      }
+    }
+  }
+
+  SetSpawn1( l.Spawn1() );
+  SetSpawn2( l.Spawn2() );
+  if( l.HasExit() )
+  {
+    SetExit( l.ExitRoom(), l.ExitDirection() );
+  }
+  Restart();
+}
+
+// SETUP:
+//
+// An exception is thrown if the method of the same name of the
+// Labyrinth would throw.
+
+void JournaledGame::ConnectRooms( const Coordinate rm_1,
+                                  const Coordinate rm_2 )
+{
+  labyrinth_->ConnectRooms( rm_1, rm_2 );
+
+  // The Rooms are adjacent, so rm_2 is recorded as a Direction from rm_1
+  JournalEntry entry;
+  entry.command = JournalCommand::kConnectRooms;
+  entry.room = rm_1;
+  if( rm_2.x == rm_1.x + 1 )
+  {
+    entry.direction = Direction::kEast;
+  }
+  else if( rm_2.x + 1 == rm_1.x )
+  {
+    entry.direction = Direction::kWest;
+  }
+  else if( rm_2.y == rm_1.y + 1 )
+  {
+    entry.direction = Direction::kSouth;
+  }
+  else
+  {
+    entry.direction = Direction::kNorth;
+  }
+  Record( entry );
+}
+
+void JournaledGame::SetSpawn1( const Coordinate rm )
+{
+  labyrinth_->SetSpawn1( rm );
+  RecordRoom( JournalCommand::kSetSpawn1, rm );
+}
+
+void JournaledGame::SetSpawn2( const Coordinate rm )
+{
+  labyrinth_->SetSpawn2( rm );
+  RecordRoom( JournalCommand::kSetSpawn2, rm );
+}
+
+void JournaledGame::SetExit( const Coordinate rm, const Direction d )
+{
+  labyrinth_->SetExit( rm, d );
+  JournalEntry entry;
+  entry.command = JournalCommand::kSetExit;
+  entry.room = rm;
+  entry.direction = d;
+  Record( entry );
+}
+
+void JournaledGame::SetInhabitant( const Coordinate rm,
+                                   const Inhabitant inh )
+{
+  labyrinth_->SetInhabitant( rm, inh );
+  JournalEntry entry;
+  entry.command = JournalCommand::kSetInhabitant;
+  entry.room = rm;
+  entry.inhabitant = inh;
+  Record( entry );
+}
+
+void JournaledGame::SetItem( const Coordinate rm, const Item itm )
+{
+  labyrinth_->SetItem( rm, itm );
+  JournalEntry entry;
+  entry.command = JournalCommand::kSetItem;
+  entry.room = rm;
+  entry.item = itm;
+  Record( entry );
+}
+
+// PLAY:
+//
+// An exception is thrown if the method of the same name of the
+// Labyrinth would throw.
+
+void JournaledGame::AttackEnemy( const Coordinate rm )
+{
+  labyrinth_->AttackEnemy( rm );
+  RecordRoom( JournalCommand::kAttackEnemy, rm );
+}
+
+void JournaledGame::TakeItem( const Coordinate rm )
+{
+  labyrinth_->TakeItem( rm );
+  RecordRoom( JournalCommand::kTakeItem, rm );
+}
+
+void JournaledGame::DropTreasure( const Coordinate rm )
+{
+  labyrinth_->DropTreasure( rm );
+  RecordRoom( JournalCommand::kDropTreasure, rm );
+}
+
+// ACTIONS:
+//
+// These methods return what the method of the same name of the
+// GameSession returns.
+
+SessionStatus JournaledGame::Move( const Direction d )
+{
+  const SessionStatus status = session_->Move( d );
+  if( status == SessionStatus::kOk )
+  {
+    JournalEntry entry;
+    entry.command = JournalCommand::kMove;
+    entry.direction = d;
+    Record( entry );
+  }
+  return status;
+}
+
+SessionStatus JournaledGame::Shoot()
+{
+  const SessionStatus status = session_->Shoot();
+  if( status == SessionStatus::kOk )
+  {
+    JournalEntry entry;
+    entry.command = JournalCommand::kShoot;
+    Record( entry );
+  }
+  return status;
+}
+
+SessionStatus JournaledGame::HoldFire()
+{
+  const SessionStatus status = session_->HoldFire();
+  if( status == SessionStatus::kOk )
+  {
+    JournalEntry entry;
+    entry.command = JournalCommand::kHoldFire;
+    Record( entry );
+  }
+  return status;
+}
+
+void JournaledGame::Restart()
+{
+  session_->Restart();
+  JournalEntry entry;
+  entry.command = JournalCommand::kRestart;
+  Record( entry );
+}
+
+// REPLAY:
+
+// This method calls the method of the command, with the parts of
+// the entry which it uses.
+// An exception is thrown if:
+//   The method of the command throws
+//   The command is an action which does not return kOk
+//     (logic_error)
+void JournaledGame::Apply( const JournalEntry& entry )
+{
+  const Coordinate rm = entry.room;
+  SessionStatus status = SessionStatus::kOk;
+  switch( entry.command )
+  {
+    case JournalCommand::kConnectRooms:
+    {
+      // A Room beyond the edge wraps around to a Coordinate outside the
+      // Labyrinth, which ConnectRooms() rejects
+      Coordinate rm_2 = rm;
+      switch( entry.direction )
+      {
+        case Direction::kNorth:
+          --rm_2.y;
+          break;
+
+        case Direction::kEast:
+          ++rm_2.x;
+          break;
+
+        case Direction::kSouth:
+          ++rm_2.y;
+          break;
+
+        case Direction::kWest:
+          --rm_2.x;
+          break;
+
+        default:
+          throw std::invalid_argument( "Error: Apply() was given a "\
+            "ConnectRooms command without a Direction.\n" );
+      }
+      ConnectRooms( rm, rm_2 );
+      break;
+    }
+
+    case JournalCommand::kSetSpawn1:
+      SetSpawn1( rm );
+      break;
+
+    case JournalCommand::kSetSpawn2:
+      SetSpawn2( rm );
+      break;
+
+    case JournalCommand::kSetExit:
+      SetExit( rm, entry.direction );
+      break;
+
+    case JournalCommand::kSetInhabitant:
+      SetInhabitant( rm, entry.inhabitant );
+      break;
+
+    case JournalCommand::kSetItem:
+      SetItem( rm, entry.item );
+      break;
+
+    case JournalCommand::kAttackEnemy:
+      AttackEnemy( rm );
+      break;
+
+    case JournalCommand::kTakeItem:
+      TakeItem( rm );
+      break;
+
+    case JournalCommand::kDropTreasure:
+      DropTreasure( rm );
+      break;
+
+    case JournalCommand::kMove:
+      status = Move( entry.direction );
+      break;
+
+    case JournalCommand::kShoot:
+      status = Shoot();
+      break;
+
+    case JournalCommand::kHoldFire:
+      status = HoldFire();
+      break;
+
+    case JournalCommand::kRestart:
+      Restart();
+      break;
+
+    default:
+      throw std::invalid_argument( "Error: Apply() was given an invalid "\
+        "JournalCommand.\n" );
+  }
+
+  if( status != SessionStatus::kOk )
+  {
+    throw std::logic_error( "Error: Apply() was given an action which "\
+      "the game does not allow.\n" );
+  }
+}
+
+// This method returns the state of the Labyrinth and the Player.
+// An exception is thrown if:
+//   There is not enough memory for the snapshot (bad_alloc)
+GameSnapshot JournaledGame::Save() const
+{
+  const Labyrinth& l = *labyrinth_;
+  const WallGrid& walls = l.Walls();
+  const size_t words = walls.WordsPerRow() * l.YSize();
+  const size_t rooms = l.XSize() * l.YSize();
+
+  GameSnapshot snapshot;
+  snapshot.east_walls.assign( walls.EastRow(0), walls.EastRow(0) + words );
+  snapshot.south_walls.assign( walls.SouthRow(0),
+                               walls.SouthRow(0) + words );
+  snapshot.cells.assign( l.Cells(), l.Cells() + rooms );
+  snapshot.spawn_1 = l.Spawn1();
+  snapshot.spawn_2 = l.Spawn2();
+  if( l.HasExit() )
+  {
+    snapshot.exit_room = l.ExitRoom();
+    snapshot.exit_direction = l.ExitDirection();
+  }
+  snapshot.player = session_->SavePlayer();
+  return snapshot;
+}
+
+// This method rebuilds the Labyrinth and the Player from a snapshot
+// of a game of the same size.
+// An exception is thrown if:
+//   The game is recording, since its journal would no longer
+//     rebuild it (logic_error)
+//   The snapshot is of a game of another size (invalid_argument)
+//   There is not enough memory for the Labyrinth (bad_alloc)
+void JournaledGame::Restore( const GameSnapshot& snapshot )
+{
+  if( record_ )
+  {
+    throw std::logic_error( "Error: Restore() was called on a game which "\
+      "is recording.\n" );
+  }
+  else if( snapshot.cells.size() != journal_.XSize() * journal_.YSize() )
+  {
+    throw std::invalid_argument( "Error: Restore() was given a snapshot "\
+      "of a game of another size.\n" );
+  }
+
+  LabyrinthLayout layout;
+  layout.x_size = journal_.XSize();
+  layout.y_size = journal_.YSize();
+  layout.east_walls = snapshot.east_walls;
+  layout.south_walls = snapshot.south_walls;
+  layout.inhabitants.reserve( snapshot.cells.size() );
+  layout.items.reserve( snapshot.cells.size() );
+  for( const RoomCell cell : snapshot.cells )
+  {
+    layout.inhabitants.push_back( cell.GetInhabitant() );
+    layout.items.push_back( cell.GetItem() );
+  }
+
+  // The new game is built aside, so that the game is unchanged if an
+  // exception is thrown
+  auto l = std::make_unique<Labyrinth>( layout );
+  l->SetSpawn1( snapshot.spawn_1 );
+  l->SetSpawn2( snapshot.spawn_2 );
+  if( snapshot.exit_direction != Direction::kNone )
+  {
+    l->SetExit( snapshot.exit_room, snapshot.exit_direction );
+  }
+  auto session = std::make_unique<GameSession>( *l, journal_.Bullets() );
+  session->RestorePlayer( snapshot.player );
+
+  session_ = std::move( session );
+  labyrinth_ = std::move( l );
+}
+
+// STATE:
+
+// This method returns the Labyrinth of the game.
+const Labyrinth& JournaledGame::Level() const
+{
+  return *labyrinth_;
+}
+
+// This method returns the Player of the game.
+const GameSession& JournaledGame::Session() const
+{
+  return *session_;
+}
+
+// This method returns the journal of the game.
+const CommandJournal& JournaledGame::Journal() const
+{
+  return journal_;
+}
+
+// This method returns true if the game is recording, and false
+// otherwise.
+bool JournaledGame::Recording() const
+{
+  return record_;
+}
+
+// PRIVATE METHODS:
+
+// This private method appends the command to the journal if the game
+// is recording.
+void JournaledGame::Record( const JournalEntry& entry )
+{
+  if( record_ )
+  {
+    journal_.Append( entry );
+  }
+}
+
+// This private method records a command which uses only a Room.
+void JournaledGame::RecordRoom( const JournalCommand command,
+                                const Coordinate rm )
+{
+  JournalEntry entry;
+  entry.command = command;
+  entry.room = rm;
+  Record( entry );
+}
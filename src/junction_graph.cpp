@@ -0,0 +1,770 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the JunctionGraph class, an
+ * index of a Labyrinth in which every corridor is contracted into one
+ * weighted edge between two junctions or dead ends.
+ *
+ */
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/junction_graph.hpp"
+
+constexpr uint32_t JunctionGraph::kNone;
+
+namespace
+{
+
+// This local function returns the Direction opposite to Direction d, in
+// the order north, east, south, west.
+unsigned Opposite( const unsigned d );
+
+// This local function returns the number of the bucket of a radix heap
+// for a key, given the least key in the heap.
+unsigned Bucket( const uint32_t key, const uint32_t least );
+
+// This local function returns the Direction opposite to Direction d, in
+// the order north, east, south, west.
+unsigned Opposite( const unsigned d )
+{
+  return ( d + 2 ) & 3;
+}
+
+// This local function returns the number of the bucket of a radix heap
+// for a key, given the least key in the heap.
+unsigned Bucket( const uint32_t key, const uint32_t least )
+{
+  // Bucket 0 holds the least key; bucket b holds the keys which first
+  // differ from it at bit b - 1
+  return key == least ? 0 : 32 - __builtin_clz( key ^ least );
+}
+
+}  // Anonymous namespace
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Parameterized constructor
+// An exception is thrown if:
+//   l is null (invalid_argument)
+//   The Labyrinth has 2^32 or more Rooms (domain_error)
+//   There is not enough memory for the index (bad_alloc)
+JunctionGraph::JunctionGraph( const Labyrinth* const l ) :
+  l_(l)
+{
+  if( l == nullptr )
+  {
+    throw std::invalid_argument( "Error: JunctionGraph() was given an "\
+      "invalid (null) pointer for the Labyrinth.\n" );
+  }
+  // Labyrinth sizes have already been checked against overflow
+  else if( l->XSize() * l->YSize() >= kNone )
+  {
+    throw std::domain_error( "Error: JunctionGraph() was given a Labyrinth "\
+      "with 2^32 or more Rooms.\n" );
+  }
+  x_size_ = static_cast<uint32_t>( l->XSize() );
+  y_size_ = static_cast<uint32_t>( l->YSize() );
+  Rebuild();
+}
+
+// INDEX:
+
+// This method rebuilds the whole index from the Labyrinth.
+// An exception is thrown if:
+//   There is not enough memory for the index (bad_alloc)
+void JunctionGraph::Rebuild()
+{
+  const size_t rooms = static_cast<size_t>( x_size_ ) * y_size_;
+  node_of_room_.assign( rooms, kNone );
+  edge_of_room_.assign( rooms, kNone );
+  place_of_room_.resize( rooms );
+  nodes_.clear();
+  edges_.clear();
+  rooms_.clear();
+  free_nodes_.clear();
+  free_edges_.clear();
+  node_count_ = 0;
+  edge_count_ = 0;
+  unused_rooms_ = 0;
+
+  for( uint32_t i = 0; i < rooms; ++i )
+  {
+    if( std::bitset<4>(OpenDirections(i)).count() != 2 )
+    {
+      AddNode( i );
+    }
+  }
+  for( uint32_t n = 0; n < nodes_.size(); ++n )
+  {
+    TraceNode( n );
+  }
+
+  // Every corridor Room left belongs to a loop with no node on it
+  for( uint32_t i = 0; i < rooms; ++i )
+  {
+    if( node_of_room_[i] == kNone && edge_of_room_[i] == kNone )
+    {
+      AnchorLoop( i );
+    }
+  }
+}
+
+// This method updates the index after the Wall between the two
+// Rooms has been broken with Labyrinth::ConnectRooms(). Only the
+// edges through the two Rooms are rebuilt.
+// An exception is thrown if:
+//   One or both Rooms are outside the Labyrinth (domain_error)
+//   There is not enough memory for the index (bad_alloc)
+//
+// Only the two Rooms have changed, so every edge which does not pass
+// through or end at one of them is still right. Those which do are
+// removed, the two Rooms become nodes or corridor Rooms according to
+// their new Walls, and the corridors are traced again from the nodes
+// which lost an edge. A node which stops being needed (e.g. the node of
+// a loop which is joined to the rest of the Labyrinth) is kept until the
+// next Rebuild(); it only lengthens queries by one node.
+void JunctionGraph::Update( const Coordinate rm_1, const Coordinate rm_2 )
+{
+  if( rm_1.x >= x_size_ || rm_1.y >= y_size_ ||
+      rm_2.x >= x_size_ || rm_2.y >= y_size_ )
+  {
+    throw std::domain_error( "Error: Update() was given a Room which is "\
+      "outside the Labyrinth.\n" );
+  }
+
+  const uint32_t changed[] =
+    { static_cast<uint32_t>( rm_1.y * x_size_ + rm_1.x ),
+      static_cast<uint32_t>( rm_2.y * x_size_ + rm_2.x ) };
+  std::vector<uint32_t> dirty;
+  for( const uint32_t i : changed )
+  {
+    if( node_of_room_[i] != kNone )
+    {
+      RemoveNode( i, dirty );
+    }
+    else if( edge_of_room_[i] != kNone )
+    {
+      RemoveEdge( edge_of_room_[i], dirty );
+    }
+  }
+  for( const uint32_t i : changed )
+  {
+    if( node_of_room_[i] == kNone &&
+        std::bitset<4>(OpenDirections(i)).count() != 2 )
+    {
+      dirty.push_back( AddNode(i) );
+    }
+  }
+  for( const uint32_t n : dirty )
+  {
+    if( nodes_[n].room != kNone )
+    {
+      TraceNode( n );
+    }
+  }
+  for( const uint32_t i : changed )
+  {
+    if( node_of_room_[i] == kNone && edge_of_room_[i] == kNone )
+    {
+      AnchorLoop( i );
+    }
+  }
+
+  if( unused_rooms_ > rooms_.size() / 2 )
+  {
+    CompactRooms();
+  }
+}
+
+// This method returns the number of nodes of the graph.
+size_t JunctionGraph::NodeCount() const
+{
+  return node_count_;
+}
+
+// This method returns the number of edges of the graph.
+size_t JunctionGraph::EdgeCount() const
+{
+  return edge_count_;
+}
+
+// QUERIES:
+
+// This method returns a shortest path from one Room to another,
+// beginning with from and ending with to, or an empty path if to
+// cannot be reached from from. The path is valid until the next
+// query.
+// An exception is thrown if:
+//   A Room is outside the Labyrinth (domain_error)
+//   There is not enough memory for the search (bad_alloc)
+const std::vector<Coordinate>& JunctionGraph::Path( const Coordinate from,
+                                                    const Coordinate to )
+{
+  if( from.x >= x_size_ || from.y >= y_size_ ||
+      to.x >= x_size_ || to.y >= y_size_ )
+  {
+    throw std::domain_error( "Error: Path() was given a Room which is "\
+      "outside the Labyrinth.\n" );
+  }
+
+  path_.clear();
+  expanded_count_ = 0;
+  try
+  {
+    Search( static_cast<uint32_t>( from.y * x_size_ + from.x ),
+            static_cast<uint32_t>( to.y * x_size_ + to.x ) );
+  }
+  catch( ... )
+  {
+    // Leaves every node unreached for the next query
+    Clear();
+    throw;
+  }
+  Clear();
+  return path_;
+}
+
+// This method returns the number of nodes expanded by the last
+// query.
+size_t JunctionGraph::ExpandedCount() const
+{
+  return expanded_count_;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the open Directions of the Room, as
+// bit d for Direction d (in the order north, east, south, west).
+unsigned JunctionGraph::OpenDirections( const uint32_t room ) const
+{
+  const WallGrid& walls = l_->Walls();
+  const uint32_t y = room / x_size_;
+  const uint32_t x = room - y * x_size_;
+  const size_t word = y * walls.WordsPerRow() + x / 64;
+  const unsigned bit = x % 64;
+  const uint64_t* const east = walls.EastRow( 0 );
+  const uint64_t* const south = walls.SouthRow( 0 );
+
+  // The Walls on the outside of the Labyrinth always exist
+  unsigned open = 0;
+  if( y > 0 && !((south[word - walls.WordsPerRow()] >> bit) & 1) )
+  {
+    open |= 1;
+  }
+  if( !((east[word] >> bit) & 1) )
+  {
+    open |= 2;
+  }
+  if( !((south[word] >> bit) & 1) )
+  {
+    open |= 4;
+  }
+  if( x > 0 && !((east[y * walls.WordsPerRow() + (x - 1) / 64] >>
+                  ((x - 1) % 64)) & 1) )
+  {
+    open |= 8;
+  }
+  return open;
+}
+
+// This private method returns the Room in Direction d of the Room.
+uint32_t JunctionGraph::Neighbour( const uint32_t room,
+                                   const unsigned d ) const
+{
+  switch( d )
+  {
+    case 0:
+      return room - x_size_;
+    case 1:
+      return room + 1;
+    case 2:
+      return room + x_size_;
+    default:
+      return room - 1;
+  }
+}
+
+// This private method makes the Room a node with no edges, and
+// returns the node.
+uint32_t JunctionGraph::AddNode( const uint32_t room )
+{
+  uint32_t n;
+  if( free_nodes_.empty() )
+  {
+    n = static_cast<uint32_t>( nodes_.size() );
+    nodes_.push_back( Node() );
+  }
+  else
+  {
+    n = free_nodes_.back();
+    free_nodes_.pop_back();
+  }
+  nodes_[n] = Node{ room, room % x_size_, room / x_size_,
+                    { kNone, kNone, kNone, kNone },
+                    { kNone, kNone, kNone, kNone },
+                    { 0, 0, 0, 0 } };
+  node_of_room_[room] = n;
+  ++node_count_;
+  return n;
+}
+
+// This private method removes the node of the Room and every edge of
+// the node, adding the other ends of the edges to the dirty nodes.
+void JunctionGraph::RemoveNode( const uint32_t room,
+                                std::vector<uint32_t>& dirty )
+{
+  const uint32_t n = node_of_room_[room];
+  for( unsigned d = 0; d < 4; ++d )
+  {
+    if( nodes_[n].edge[d] != kNone )
+    {
+      RemoveEdge( nodes_[n].edge[d], dirty );
+    }
+  }
+  nodes_[n].room = kNone;
+  node_of_room_[room] = kNone;
+  free_nodes_.push_back( n );
+  --node_count_;
+}
+
+// This private method removes the edge, adding its ends to the dirty
+// nodes.
+void JunctionGraph::RemoveEdge( const uint32_t edge,
+                                std::vector<uint32_t>& dirty )
+{
+  Edge& e = edges_[edge];
+  for( uint32_t i = 0; i + 1 < e.weight; ++i )
+  {
+    edge_of_room_[rooms_[e.first + i]] = kNone;
+  }
+  unused_rooms_ += e.weight - 1;
+
+  // Both slots of a loop from a node to itself are cleared
+  for( const uint32_t n : e.node )
+  {
+    for( unsigned d = 0; d < 4; ++d )
+    {
+      if( nodes_[n].edge[d] == edge )
+      {
+        nodes_[n].edge[d] = kNone;
+      }
+    }
+    dirty.push_back( n );
+  }
+  e.node[0] = kNone;
+  free_edges_.push_back( edge );
+  --edge_count_;
+}
+
+// This private method follows the corridor leaving the node in
+// Direction d up to the node at its other end, and adds its edge.
+void JunctionGraph::TraceEdge( const uint32_t node, const unsigned d )
+{
+  uint32_t edge;
+  if( free_edges_.empty() )
+  {
+    edge = static_cast<uint32_t>( edges_.size() );
+    edges_.push_back( Edge() );
+  }
+  else
+  {
+    edge = free_edges_.back();
+    free_edges_.pop_back();
+  }
+
+  // A corridor Room opens onto exactly two Rooms, so it is left through
+  // the one Direction it was not entered from
+  const uint32_t first = static_cast<uint32_t>( rooms_.size() );
+  uint32_t place = 0;
+  unsigned direction = d;
+  uint32_t room = Neighbour( nodes_[node].room, d );
+  while( node_of_room_[room] == kNone )
+  {
+    rooms_.push_back( room );
+    edge_of_room_[room] = edge;
+    place_of_room_[room] = place++;
+    const unsigned open =
+      OpenDirections( room ) & ~( 1u << Opposite(direction) );
+    direction = 0;
+    while( !((open >> direction) & 1) )
+    {
+      ++direction;
+    }
+    room = Neighbour( room, direction );
+  }
+
+  const uint32_t end = node_of_room_[room];
+  edges_[edge] = Edge{ { node, end }, place + 1, first };
+  Node& start = nodes_[node];
+  start.edge[d] = edge;
+  start.next[d] = end;
+  start.weight[d] = place + 1;
+  Node& finish = nodes_[end];
+  finish.edge[Opposite(direction)] = edge;
+  finish.next[Opposite(direction)] = node;
+  finish.weight[Opposite(direction)] = place + 1;
+  ++edge_count_;
+}
+
+// This private method traces every open Direction of the node which
+// has no edge yet.
+void JunctionGraph::TraceNode( const uint32_t node )
+{
+  const unsigned open = OpenDirections( nodes_[node].room );
+  for( unsigned d = 0; d < 4; ++d )
+  {
+    // A loop back to the node fills the slot it returns through
+    if( ((open >> d) & 1) && nodes_[node].edge[d] == kNone )
+    {
+      TraceEdge( node, d );
+    }
+  }
+}
+
+// This private method gives the corridor loop through the Room, which
+// has neither a node nor an edge, a node at the Room.
+void JunctionGraph::AnchorLoop( const uint32_t room )
+{
+  TraceNode( AddNode(room) );
+}
+
+// This private method copies the Rooms of the live edges into a new
+// rooms_, dropping the Rooms of removed edges.
+void JunctionGraph::CompactRooms()
+{
+  std::vector<uint32_t> compact;
+  compact.reserve( rooms_.size() - unused_rooms_ );
+  for( Edge& e : edges_ )
+  {
+    if( e.node[0] == kNone )
+    {
+      continue;
+    }
+    const uint32_t first = static_cast<uint32_t>( compact.size() );
+    compact.insert( compact.end(),
+                    rooms_.begin() + e.first,
+                    rooms_.begin() + e.first + e.weight - 1 );
+    e.first = first;
+  }
+  rooms_.swap( compact );
+  unused_rooms_ = 0;
+}
+
+// This private method runs the search of Path() and fills path_.
+//
+// A corridor Room is not a node, so a query from one starts at both ends
+// of its edge, each as far away as the Room is from that end; a query to
+// one ends at either end of its edge, plus the steps from that end. Two
+// Rooms of the same corridor may also be joined along it. The nodes are
+// then searched with A* search guided by the Manhattan distance to the
+// target Room, which no edge is shorter than, and the search stops once
+// no node left in the open list can lead to a shorter path than the
+// best found.
+void JunctionGraph::Search( const uint32_t from, const uint32_t to )
+{
+  if( from == to )
+  {
+    path_.push_back( Coordinate(from % x_size_, from / x_size_) );
+    return;
+  }
+  if( distance_.size() < nodes_.size() )
+  {
+    distance_.resize( nodes_.size(), kNone );
+    parent_edge_.resize( nodes_.size() );
+  }
+
+  // Returns the ends through which a query enters or leaves the Room,
+  // each as (node, steps from the Room to the node); a node is its own
+  // end
+  struct End
+  {
+    uint32_t node;
+    uint32_t steps;
+  };
+  const auto ends = [this]( const uint32_t room, End (&out)[2] )
+  {
+    if( node_of_room_[room] != kNone )
+    {
+      out[0] = End{ node_of_room_[room], 0 };
+      out[1] = End{ kNone, kNone };
+      return;
+    }
+    const Edge& e = edges_[edge_of_room_[room]];
+    const uint32_t place = place_of_room_[room];
+    out[0] = End{ e.node[0], place + 1 };
+    out[1] = End{ e.node[1], e.weight - place - 1 };
+  };
+  End sources[2];
+  End targets[2];
+  ends( from, sources );
+  ends( to, targets );
+
+  // Returns the Manhattan distance from the Room of the node to the
+  // target Room
+  const uint32_t to_x = to % x_size_;
+  const uint32_t to_y = to / x_size_;
+  const auto left = [this, to_x, to_y]( const uint32_t node )
+  {
+    const Node& n = nodes_[node];
+    return ( n.x > to_x ? n.x - to_x : to_x - n.x ) +
+           ( n.y > to_y ? n.y - to_y : to_y - n.y );
+  };
+
+  // Joining the two Rooms along their corridor, if they share one
+  uint32_t best = kNone;
+  uint32_t best_target = kNone;  // Index into targets, or kNone if direct
+  if( node_of_room_[from] == kNone && node_of_room_[to] == kNone &&
+      edge_of_room_[from] == edge_of_room_[to] )
+  {
+    const uint32_t a = place_of_room_[from];
+    const uint32_t b = place_of_room_[to];
+    best = a > b ? a - b : b - a;
+  }
+
+  for( const End s : sources )
+  {
+    if( s.node != kNone && s.steps < distance_[s.node] )
+    {
+      if( distance_[s.node] == kNone )
+      {
+        touched_.push_back( s.node );
+      }
+      distance_[s.node] = s.steps;
+      parent_edge_[s.node] = kNone;
+      PushOpen( OpenNode{ s.steps + left(s.node), s.steps, s.node } );
+    }
+  }
+
+  while( FrontOpen() && open_f_ < best )
+  {
+    const OpenNode top = open_[0].back();
+    open_[0].pop_back();
+    --open_size_;
+    const uint32_t g = top.g;
+    if( g != distance_[top.node] )
+    {
+      continue;
+    }
+
+    ++expanded_count_;
+    for( uint32_t t = 0; t < 2; ++t )
+    {
+      if( targets[t].node == top.node && g + targets[t].steps < best )
+      {
+        best = g + targets[t].steps;
+        best_target = t;
+      }
+    }
+    const Node& n = nodes_[top.node];
+    for( unsigned d = 0; d < 4; ++d )
+    {
+      if( n.edge[d] == kNone )
+      {
+        continue;
+      }
+      // A dead end other than a target leads nowhere, so it is not
+      // searched
+      const uint32_t next = n.next[d];
+      const Node& m = nodes_[next];
+      const bool dead_end =
+        ( m.edge[0] != kNone ) + ( m.edge[1] != kNone ) +
+        ( m.edge[2] != kNone ) + ( m.edge[3] != kNone ) == 1 &&
+        next != targets[0].node && next != targets[1].node;
+      const uint32_t distance = g + n.weight[d];
+      if( !dead_end && distance < distance_[next] )
+      {
+        if( distance_[next] == kNone )
+        {
+          touched_.push_back( next );
+        }
+        distance_[next] = distance;
+        parent_edge_[next] = n.edge[d];
+        PushOpen( OpenNode{ distance + left(next), distance, next } );
+      }
+    }
+  }
+
+  const auto push_room = [this]( const uint32_t room )
+  {
+    path_.push_back( Coordinate(room % x_size_, room / x_size_) );
+  };
+  if( best == kNone )
+  {
+    return;
+  }
+  else if( best_target == kNone )
+  {
+    const Edge& e = edges_[edge_of_room_[from]];
+    const uint32_t a = place_of_room_[from];
+    const uint32_t b = place_of_room_[to];
+    for( uint32_t k = 0; k <= best; ++k )
+    {
+      push_room( rooms_[e.first + (a < b ? a + k : a - k)] );
+    }
+    return;
+  }
+
+  // The nodes of the path, from the target end back to a source end
+  std::vector<uint32_t> edges;
+  const uint32_t last = targets[best_target].node;
+  uint32_t first = last;
+  while( parent_edge_[first] != kNone )
+  {
+    edges.push_back( parent_edge_[first] );
+    const Edge& e = edges_[parent_edge_[first]];
+    first = e.node[0] == first ? e.node[1] : e.node[0];
+  }
+
+  // From the Room to the first node along its corridor; with both ends
+  // at the same node, the shorter side (or side 0 on a tie) was taken
+  push_room( from );
+  if( node_of_room_[from] == kNone )
+  {
+    const Edge& e = edges_[edge_of_room_[from]];
+    const uint32_t place = place_of_room_[from];
+    if( e.node[0] == first &&
+        ( e.node[1] != first || sources[0].steps <= sources[1].steps ) )
+    {
+      for( uint32_t i = place; i-- > 0; )
+      {
+        push_room( rooms_[e.first + i] );
+      }
+    }
+    else
+    {
+      for( uint32_t i = place + 1; i + 1 < e.weight; ++i )
+      {
+        push_room( rooms_[e.first + i] );
+      }
+    }
+    push_room( nodes_[first].room );
+  }
+
+  uint32_t node = first;
+  for( size_t i = edges.size(); i-- > 0; )
+  {
+    AppendEdge( edges[i], node );
+    const Edge& e = edges_[edges[i]];
+    node = e.node[0] == node ? e.node[1] : e.node[0];
+    push_room( nodes_[node].room );
+  }
+
+  // From the last node along the corridor of the target Room
+  if( node_of_room_[to] == kNone )
+  {
+    const Edge& e = edges_[edge_of_room_[to]];
+    const uint32_t place = place_of_room_[to];
+    if( best_target == 0 )
+    {
+      for( uint32_t i = 0; i <= place; ++i )
+      {
+        push_room( rooms_[e.first + i] );
+      }
+    }
+    else
+    {
+      for( uint32_t i = e.weight - 1; i-- > place; )
+      {
+        push_room( rooms_[e.first + i] );
+      }
+    }
+  }
+}
+
+// This private method adds the entry to the open list, whose f must
+// be at least the least f in it.
+//
+// The heuristic is consistent, so f never falls along a search and the
+// open list is a radix heap: an entry is put in the bucket of the highest
+// bit in which its f differs from the least f, and a bucket is only
+// sorted out when every lower one is empty, into lower buckets. Each
+// entry is therefore moved at most 32 times, with no comparisons between
+// entries, and the entries with the least f are taken last in first out,
+// which follows a route without switching between equal ones.
+void JunctionGraph::PushOpen( const OpenNode entry )
+{
+  open_[Bucket(entry.f, open_f_)].push_back( entry );
+  ++open_size_;
+}
+
+// This private method moves the entries with the least f to the
+// front of the open list, and returns false if it is empty.
+bool JunctionGraph::FrontOpen()
+{
+  if( open_size_ == 0 )
+  {
+    return false;
+  }
+  else if( !open_[0].empty() )
+  {
+    return true;
+  }
+
+  unsigned b = 1;
+  while( open_[b].empty() )
+  {
+    ++b;
+  }
+  open_f_ = kNone;
+  for( const OpenNode& entry : open_[b] )
+  {
+    open_f_ = std::min( open_f_, entry.f );
+  }
+  for( const OpenNode& entry : open_[b] )
+  {
+    open_[Bucket(entry.f, open_f_)].push_back( entry );
+  }
+  open_[b].clear();
+  return true;
+}
+
+// This private method appends the corridor Rooms of the edge to the
+// path, walking away from the given node.
+void JunctionGraph::AppendEdge( const uint32_t edge, const uint32_t from_node )
+{
+  const Edge& e = edges_[edge];
+  if( e.node[0] == from_node )
+  {
+    for( uint32_t i = 0; i + 1 < e.weight; ++i )
+    {
+      path_.push_back( Coordinate(rooms_[e.first + i] % x_size_,
+                                  rooms_[e.first + i] / x_size_) );
+    }
+  }
+  else
+  {
+    for( uint32_t i = e.weight - 1; i-- > 0; )
+    {
+      path_.push_back( Coordinate(rooms_[e.first + i] % x_size_,
+                                  rooms_[e.first + i] / x_size_) );
+    }
+  }
+}
+
+// This private method resets the distance of every touched node and
+// empties the open list.
+void JunctionGraph::Clear()
+{
+  for( const uint32_t n : touched_ )
+  {
+    distance_[n] = kNone;
+  }
+  touched_.clear();
+  for( std::vector<OpenNode>& bucket : open_ )
+  {
+    bucket.clear();
+  }
+  open_f_ = 0;
+  open_size_ = 0;
+}
@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-02-01
+ * Last edited: 2026-10-18
  *
  * This C++ file contains the implementation of the Labyrinth class, which uses
  * the Room class to create a 2-d mapping for a game.
@@ -10,12 +10,18 @@
 
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 
 #include "../include/room_properties.hpp"
-#include "../include/room.hpp"
+#include "../include/room_cell.hpp"
 #include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth_status.hpp"
+#include "../include/labyrinth_layout.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/random_generator.hpp"
 #include "../include/labyrinth.hpp"
 
 // CONSTRUCTOR/DESTRUCTOR:
@@ -23,67 +29,104 @@
 // Parameterized constructor
 // An exception is thrown if:
 //   A size of 0 is given (domain_error)
-//   An x or y size greater than the maximum is given (domain_error)
+//   The number of Rooms (x_size * y_size) overflows a size_t (domain_error)
+//   There is not enough memory for the Rooms (bad_alloc)
 Labyrinth::Labyrinth( const size_t x_size, const size_t y_size ) :
-  x_size_(x_size), y_size_(y_size)
+  x_size_(x_size),
+  y_size_(y_size),
+  room_count_(RoomCount(x_size, y_size)),
+  walls_(x_size, y_size)
 {
-  if( x_size == 0 )
+  rooms_ = std::make_unique<RoomCell[]>( room_count_ );
+}
+
+// Parameterized constructor
+// This constructor builds a complete Labyrinth from a layout in a
+// single pass over the Walls and Rooms, in place of one
+// ConnectRooms(), SetInhabitant(), or SetItem() call per Room.
+// The spawns and exit are set afterwards as usual.
+// An exception is thrown if:
+//   The constructor above would throw for the layout's sizes
+//   A Wall bitmap has the wrong number of words (invalid_argument)
+//   A Wall on the outside of the Labyrinth is missing
+//     (invalid_argument)
+//   The inhabitants or items are neither empty nor one per Room
+//     (invalid_argument)
+//   An Inhabitant or Item is not a valid enumerator (invalid_argument)
+//   More than one Room holds the Treasure (logic_error)
+Labyrinth::Labyrinth( const LabyrinthLayout& layout ) :
+  Labyrinth( layout.x_size, layout.y_size )
+{
+  const size_t words = walls_.WordsPerRow() * y_size_;
+  if( layout.east_walls.size() != words ||
+      layout.south_walls.size() != words )
   {
-    if( y_size == 0 )
-    {
-      throw std::domain_error( "Error: Labyrinth() was given empty x and "\
-        "y sizes.\n" );
-    }
-    else
-    {
-      throw std::domain_error( "Error: Labyrinth() was given an empty "\
-        "x size.\n" );
-    }
+    throw std::invalid_argument( "Error: Labyrinth() was given a Wall "\
+      "bitmap with the wrong number of words.\n" );
   }
-  else if( y_size == 0 )
+  else if( !layout.inhabitants.empty() &&
+           layout.inhabitants.size() != room_count_ )
   {
-    throw std::domain_error( "Error: Labyrinth() was given an empty "\
-      "y size.\n" );
+    throw std::invalid_argument( "Error: Labyrinth() was given a number "\
+      "of Inhabitants which does not match the number of Rooms.\n" );
+  }
+  else if( !layout.items.empty() && layout.items.size() != room_count_ )
+  {
+    throw std::invalid_argument( "Error: Labyrinth() was given a number "\
+      "of Items which does not match the number of Rooms.\n" );
   }
 
-  if( x_size > MAX_X_SIZE_ )
+  walls_.Assign( layout.east_walls.data(), layout.south_walls.data() );
+
+  if( !layout.inhabitants.empty() )
   {
-    if( y_size > MAX_Y_SIZE_ )
-    {
-      throw std::domain_error( "Error: Labyrinth() was given x and y sizes "\
-        "greater than the maximum (20).\n" );
-    }
-    else
+    for( size_t i = 0; i < room_count_; ++i )
     {
-      throw std::domain_error( "Error: Labyrinth() was given an x size "\
-        "greater than the maximum (20).\n" );
+      const Inhabitant inh = layout.inhabitants[i];
+      if( static_cast<unsigned>(inh) >
+          static_cast<unsigned>(Inhabitant::kMirrorCracked) )
+      {
+        throw std::invalid_argument( "Error: Labyrinth() was given an "\
+          "invalid Inhabitant.\n" );
+      }
+      rooms_[i].SetInhabitant(inh);
     }
   }
-  else if( y_size > MAX_Y_SIZE_ )
-  {
-    throw std::domain_error( "Error: Labyrinth() was given a y size "\
-      "greater than the maximum (20).\n" );
-  }
 
-  auto rooms_temp_1 = std::make_unique<std::unique_ptr<Room[]>[]>(y_size);
-
-  rooms_ = std::move( rooms_temp_1 );
-  for( size_t i = 0; i < y_size; ++i )
+  if( !layout.items.empty() )
   {
-    auto rooms_temp_2 = std::make_unique<Room[]>(x_size);
-    rooms_[i] = std::move( rooms_temp_2 );
+    for( size_t i = 0; i < room_count_; ++i )
+    {
+      const Item itm = layout.items[i];
+      if( static_cast<unsigned>(itm) >
+          static_cast<unsigned>(Item::kTreasureGone) )
+      {
+        throw std::invalid_argument( "Error: Labyrinth() was given an "\
+          "invalid Item.\n" );
+      }
+      else if( itm == Item::kTreasure )
+      {
+        if( treasure_set_ )
+        {
+          throw std::logic_error( "Error: Labyrinth() was given more than "\
+            "one Treasure.\n" );
+        }
+        treasure_set_ = true;
+      }
+      rooms_[i].SetItem(itm);
+    }
   }
-
 }
 
 // SETUP:
 
-// This method connects two Rooms by breaking their walls.
+// This method connects two Rooms by breaking the Wall between them.
 // An exception is thrown if:
 //   One or both Rooms are outside the Labyrinth (domain_error)
 //   The Rooms are not adjacent (logic_error)
 //   The Rooms are the same (logic_error)
 //   The Rooms are already connected (logic_error)
+//   The Wall between the Rooms is the exit (logic_error)
 void Labyrinth::ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
 {
   if( !WithinBounds(rm_1) || !WithinBounds(rm_2) )
@@ -119,15 +162,14 @@ void Labyrinth::ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
       "coordinate for the two Rooms.\n" );
   }
 
-  int x_distance = (int)(rm_2.x) - (int)(rm_1.x);
-  int y_distance = (int)(rm_2.y) - (int)(rm_1.y);
+  // Coordinates are compared rather than subtracted so that sizes beyond
+  // the range of an int are handled correctly.
+  Direction break_wall_1 = Direction::kNone;
+  Direction break_wall_2 = Direction::kNone;
 
-  Direction break_wall_1;
-  Direction break_wall_2;
-
-  if( x_distance == 0 )
+  if( rm_1.x == rm_2.x )
   {
-    if( y_distance > 0 )  // rm_1 is north of rm_2
+    if( rm_2.y > rm_1.y )  // rm_1 is north of rm_2
     {
       break_wall_1 = Direction::kSouth;
       break_wall_2 = Direction::kNorth;
@@ -139,9 +181,9 @@ void Labyrinth::ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
     }
   }
 
-  else if( y_distance == 0 )
+  else if( rm_1.y == rm_2.y )
   {
-    if( x_distance > 0 )  // rm_1 is west of rm_2
+    if( rm_2.x > rm_1.x )  // rm_1 is west of rm_2
     {
       break_wall_1 = Direction::kEast;
       break_wall_2 = Direction::kWest;
@@ -153,14 +195,21 @@ void Labyrinth::ConnectRooms( const Coordinate rm_1, const Coordinate rm_2 )
     }
   }
 
-  if( RoomAt(rm_1).DirectionCheck(break_wall_1) == RoomBorder::kRoom )
+  if( !walls_.IsWall(rm_1, break_wall_1) )
   {
     throw std::logic_error( "Error: ConnectRooms() was given two Rooms "\
       "which are already connected.\n" );
   }
+  else if( exit_set_ &&
+           ( ( rm_1 == exit_room_ && break_wall_1 == exit_direction_ ) ||
+             ( rm_2 == exit_room_ && break_wall_2 == exit_direction_ ) ) )
+  {
+    throw std::logic_error( "Error: ConnectRooms() was given two Rooms "\
+      "separated by the exit.\n" );
+  }
 
-  RoomAt(rm_1).BreakWall(break_wall_1);
-  RoomAt(rm_2).BreakWall(break_wall_2);
+  // The Wall is shared by both Rooms, so a single write connects them.
+  walls_.SetWall( rm_1, break_wall_1, false );
   return;
 }
 
@@ -216,17 +265,7 @@ void Labyrinth::SetExit( const Coordinate rm, const Direction d )
       "invalid direction (kNone).\n" );
   }
 
-  auto rb = RoomBorder::kRoom;
-  try
-  {
-    rb = RoomAt(rm).DirectionCheck(d);
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
-  if (rb == RoomBorder::kRoom)
+  if( !walls_.IsWall(rm, d) )
   {
     throw std::invalid_argument( "Error: SetExit() was given a "\
       "direction with a Room, not a Wall.\n" );
@@ -238,16 +277,10 @@ void Labyrinth::SetExit( const Coordinate rm, const Direction d )
       "already exists.\n" );
   }
 
-  try
-  {
-    RoomAt(rm).CreateExit(d);
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
-
+  // The Wall itself is kept in walls_, so that the neighbouring Room (if
+  // any) still sees a Wall.
+  exit_room_ = rm;
+  exit_direction_ = d;
   exit_set_ = true;
   return;
 }
@@ -272,13 +305,13 @@ void Labyrinth::SetInhabitant( const Coordinate rm, const Inhabitant inh )
     throw std::invalid_argument( "Error: SetInhabitant() was given a null "\
       "Inhabitant.\n" );
   }
-  else if( RoomAt(rm).GetInhabitant() != Inhabitant::kNone )
+  else if( CellAt(rm).GetInhabitant() != Inhabitant::kNone )
   {
     throw std::logic_error( "Error: SetInhabitant() cannot replace an "\
       "existing Inhabitant; EnemyAttacked() should be used instead.\n" );
   }
 
-  RoomAt(rm).SetInhabitant(inh);
+  CellAt(rm).SetInhabitant(inh);
   return;
 }
 
@@ -302,7 +335,7 @@ void Labyrinth::SetItem( const Coordinate rm, const Item itm )
     throw std::invalid_argument( "Error: SetItem() was given an invalid "\
       "Item.\n" );
   }
-  else if( RoomAt(rm).GetItem() != Item::kNone )
+  else if( CellAt(rm).GetItem() != Item::kNone )
   {
     throw std::logic_error("Error: SetItem() cannot replace an existing "\
       "Item.\n");
@@ -313,16 +346,120 @@ void Labyrinth::SetItem( const Coordinate rm, const Item itm )
       "but the Treasure has already been set in the Labyrinth.\n" );
   }
 
-  try
+  CellAt(rm).SetItem(itm);
+
+  if( itm == Item::kTreasure )
   {
-    RoomAt(rm).SetItem(itm);
+    treasure_set_ = true;
   }
-  catch( const std::exception& e )
+}
+
+// This method scatters the Inhabitants and Items of the population
+// across random Rooms, in two sequential passes over the Rooms instead
+// of one SetInhabitant() or SetItem() call per Room. Rooms are sampled
+// without replacement (selection sampling), so no Room is ever tried
+// twice and no memory is needed besides the Rooms.
+// The Labyrinth is not modified if an exception is thrown.
+// An exception is thrown if:
+//   There are fewer empty Rooms outside the exclusion zones than
+//     Inhabitants or Items to place (logic_error)
+//   The population has a Treasure but the Treasure has already been
+//     placed (logic_error)
+void Labyrinth::Populate( const LabyrinthPopulation& population,
+                          RandomGenerator& rng )
+{
+  if( population.treasure && treasure_set_ )
   {
-    std::cout << e.what();
+    throw std::logic_error( "Error: Populate() was given a Treasure, but "\
+      "the Treasure has already been placed.\n" );
   }
 
-  if( itm == Item::kTreasure )
+  size_t minotaurs = population.minotaurs;
+  size_t mirrors = population.mirrors;
+  size_t bullets = population.bullets;
+  size_t treasures = population.treasure;
+
+  // The first pass counts the candidate Rooms
+  size_t inhabitant_rooms = 0;
+  size_t item_rooms = 0;
+  const bool place_inhabitants = ( minotaurs + mirrors != 0 );
+  const bool place_items = ( bullets + treasures != 0 );
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      const Coordinate rm(x, y);
+      const RoomCell cell = rooms_[IndexOf(rm)];
+      const bool wants_inhabitant = place_inhabitants &&
+        cell.GetInhabitant() == Inhabitant::kNone;
+      const bool wants_item = place_items && cell.GetItem() == Item::kNone;
+      if( ( wants_inhabitant || wants_item ) &&
+          !IsExcluded(rm, population) )
+      {
+        inhabitant_rooms += wants_inhabitant;
+        item_rooms += wants_item;
+      }
+    }
+  }
+
+  if( inhabitant_rooms < minotaurs + mirrors )
+  {
+    throw std::logic_error( "Error: Populate() was given more Inhabitants "\
+      "than there are empty Rooms.\n" );
+  }
+  else if( item_rooms < bullets + treasures )
+  {
+    throw std::logic_error( "Error: Populate() was given more Items than "\
+      "there are empty Rooms.\n" );
+  }
+
+  // The second pass visits the candidates again in the same order,
+  // choosing each with probability (still to place) / (candidates left),
+  // which picks a uniformly random set of Rooms; each chosen Room then
+  // receives a random one of the entities still to place.
+  for( size_t y = 0; y < y_size_ &&
+       ( minotaurs + mirrors + bullets + treasures != 0 ); ++y )
+  {
+    for( size_t x = 0; x < x_size_; ++x )
+    {
+      const Coordinate rm(x, y);
+      RoomCell& cell = rooms_[IndexOf(rm)];
+      const bool wants_inhabitant = place_inhabitants &&
+        cell.GetInhabitant() == Inhabitant::kNone;
+      const bool wants_item = place_items && cell.GetItem() == Item::kNone;
+      if( !( wants_inhabitant || wants_item ) ||
+          IsExcluded(rm, population) )
+      {
+        continue;
+      }
+
+      if( wants_inhabitant )
+      {
+        const size_t left = minotaurs + mirrors;
+        if( left != 0 && rng.Below(inhabitant_rooms) < left )
+        {
+          const bool minotaur = rng.Below(left) < minotaurs;
+          cell.SetInhabitant( minotaur ? Inhabitant::kMinotaur
+                                       : Inhabitant::kMirror );
+          --( minotaur ? minotaurs : mirrors );
+        }
+        --inhabitant_rooms;
+      }
+      if( wants_item )
+      {
+        const size_t left = bullets + treasures;
+        if( left != 0 && rng.Below(item_rooms) < left )
+        {
+          const bool bullet = rng.Below(left) < bullets;
+          cell.SetItem( bullet ? Item::kBullet : Item::kTreasure );
+          --( bullet ? bullets : treasures );
+        }
+        --item_rooms;
+      }
+    }
+  }
+
+  if( population.treasure )
   {
     treasure_set_ = true;
   }
@@ -340,7 +477,7 @@ Inhabitant Labyrinth::GetInhabitant( const Coordinate rm ) const
     throw std::domain_error( "Error: GetInhabitant() was given a "\
       "Coordinate outside of the Labyrinth.\n" );
   }
-  return RoomAt(rm).GetInhabitant();
+  return CellAt(rm).GetInhabitant();
 }
 
 // This method attacks the Inhabitant of the Room, and sets the resultant
@@ -358,16 +495,7 @@ void Labyrinth::AttackEnemy( const Coordinate rm )
       "Coordinate.\n" );
   }
 
-  auto inh = Inhabitant::kNone;
-  try
-  {
-    inh = RoomAt(rm).GetInhabitant();
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
+  const auto inh = CellAt(rm).GetInhabitant();
 
   switch( inh )
   {
@@ -388,27 +516,11 @@ void Labyrinth::AttackEnemy( const Coordinate rm )
 
     // Actual code, not error-checking
     case Inhabitant::kMinotaur:
-      try
-      {
-        RoomAt(rm).SetInhabitant(Inhabitant::kMinotaurDead);
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-        return;
-      }
+      CellAt(rm).SetInhabitant(Inhabitant::kMinotaurDead);
       break;
 
     case Inhabitant::kMirror:
-      try
-      {
-        RoomAt(rm).SetInhabitant(Inhabitant::kMirrorCracked);
-      }
-      catch( const std::exception& e )
-      {
-        std::cout << e.what();
-        return;
-      }
+      CellAt(rm).SetInhabitant(Inhabitant::kMirrorCracked);
       break;
   }
 }
@@ -424,7 +536,7 @@ Item Labyrinth::ItemAt( const Coordinate rm ) const
     throw std::domain_error( "Error: ItemAt() was given a "\
       "Coordinate outside of the Labyrinth.\n" );
   }
-  return RoomAt(rm).GetItem();
+  return CellAt(rm).GetItem();
 }
 
 // This method takes the Item from the Room.
@@ -440,17 +552,7 @@ void Labyrinth::TakeItem( const Coordinate rm )
       "invalid Coordinate.\n" );
   }
 
-  auto itm = Item::kNone;
-
-  try
-  {
-    itm = RoomAt(rm).GetItem();
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
+  const auto itm = CellAt(rm).GetItem();
 
   auto itm_new = Item::kNone;
 
@@ -475,17 +577,8 @@ void Labyrinth::TakeItem( const Coordinate rm )
       break;
   }
 
-  try
-  {
-    RoomAt(rm).SetItem(itm_new);
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
+  CellAt(rm).SetItem(itm_new);
 
-  // treasure_set_ is not changed upon failure in the try/catch block.
   if( itm_new == Item::kTreasureGone )
   {
     treasure_set_ = false;
@@ -509,17 +602,9 @@ void Labyrinth::DropTreasure( const Coordinate rm )
       "Treasure was already set in a Room of the Labyrinth.\n" );
   }
 
-  try
-  {
-    RoomAt(rm).SetItem(Item::kTreasure);
-  }
-  catch( const std::exception& e )
-  {
-    std::cout << e.what();
-    return;
-  }
+  CellAt(rm).SetItem(Item::kTreasure);
 
-  treasure_set_ = true;  // Not modified upon failure of try/catch block
+  treasure_set_ = true;
 }
 
 // This method returns the type of RoomBorder in the given direction.
@@ -540,23 +625,466 @@ RoomBorder Labyrinth::DirectionCheck( const Coordinate rm,
       "invalid direction (kNone).\n" );
   }
 
-  return RoomAt(rm).DirectionCheck(d);
+  return DirectionCheckUnchecked(rm, d);
 }
 
-// PRIVATE METHODS:
+// SIZE:
 
-// This private method returns a reference to the Room at the given
-// coordinate.
+// This method returns the number of Rooms along the x-axis.
+size_t Labyrinth::XSize() const
+{
+  return x_size_;
+}
+
+// This method returns the number of Rooms along the y-axis.
+size_t Labyrinth::YSize() const
+{
+  return y_size_;
+}
+
+// SPECIAL ROOMS AND WALLS:
+
+// These methods return the spawn Rooms of the Players.
+Coordinate Labyrinth::Spawn1() const
+{
+  return spawn_1_;
+}
+
+Coordinate Labyrinth::Spawn2() const
+{
+  return spawn_2_;
+}
+
+// This method returns true if the exit has been set, and false
+// otherwise.
+bool Labyrinth::HasExit() const
+{
+  return exit_set_;
+}
+
+// This method returns the Room which has the exit.
 // An exception is thrown if:
-//   The Room is outside the Labyrinth (domain_error)
-Room& Labyrinth::RoomAt( const Coordinate rm ) const
+//   The exit has not been set (logic_error)
+Coordinate Labyrinth::ExitRoom() const
+{
+  if( !exit_set_ )
+  {
+    throw std::logic_error( "Error: ExitRoom() was called, but the exit "\
+      "has not been set.\n" );
+  }
+  return exit_room_;
+}
+
+// This method returns the direction of the exit from its Room.
+// An exception is thrown if:
+//   The exit has not been set (logic_error)
+Direction Labyrinth::ExitDirection() const
+{
+  if( !exit_set_ )
+  {
+    throw std::logic_error( "Error: ExitDirection() was called, but the "\
+      "exit has not been set.\n" );
+  }
+  return exit_direction_;
+}
+
+// This method returns the Walls of the Labyrinth, for algorithms
+// which scan the Walls a bitmap word at a time. The exit is not
+// part of the WallGrid; its Wall is still set there.
+const WallGrid& Labyrinth::Walls() const
+{
+  return walls_;
+}
+
+// This method returns the contents of the Rooms in row-major order
+// (the Room at (x, y) is at index y * XSize() + x), for algorithms
+// which scan every Room.
+const RoomCell* Labyrinth::Cells() const
+{
+  return rooms_.get();
+}
+
+// NON-THROWING:
+
+// This method connects two Rooms by breaking the Wall between them.
+// Returns kOutOfBounds, kSameRoom, kNotAdjacent, kAlreadyConnected, or
+// kExitInTheWay upon failure.
+LabyrinthStatus Labyrinth::TryConnectRooms( const Coordinate rm_1,
+                                            const Coordinate rm_2 )
+{
+  if( !WithinBounds(rm_1) || !WithinBounds(rm_2) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( rm_1 == rm_2 )
+  {
+    return LabyrinthStatus::kSameRoom;
+  }
+
+  const Direction d = DirectionBetween( rm_1, rm_2 );
+  if( d == Direction::kNone )
+  {
+    return LabyrinthStatus::kNotAdjacent;
+  }
+  else if( !walls_.IsWall(rm_1, d) )
+  {
+    return LabyrinthStatus::kAlreadyConnected;
+  }
+  else if( exit_set_ &&
+           ( ( rm_1 == exit_room_ && d == exit_direction_ ) ||
+             ( rm_2 == exit_room_ &&
+               DirectionBetween(rm_2, rm_1) == exit_direction_ ) ) )
+  {
+    return LabyrinthStatus::kExitInTheWay;
+  }
+
+  walls_.SetWall( rm_1, d, false );
+  return LabyrinthStatus::kOk;
+}
+
+// This method sets the exit of the Labyrinth on a Wall.
+// Returns kOutOfBounds, kInvalidDirection, kNotAWall, or kExitAlreadySet
+// upon failure.
+LabyrinthStatus Labyrinth::TrySetExit( const Coordinate rm,
+                                       const Direction d )
 {
   if( !WithinBounds(rm) )
   {
-    throw std::domain_error( "Error: RoomAt() was given an invalid "\
-      "coordinate for rm.\n" );
+    return LabyrinthStatus::kOutOfBounds;
   }
-  return rooms_[rm.y][rm.x];
+  else if( d == Direction::kNone )
+  {
+    return LabyrinthStatus::kInvalidDirection;
+  }
+  else if( !walls_.IsWall(rm, d) )
+  {
+    return LabyrinthStatus::kNotAWall;
+  }
+  else if( exit_set_ )
+  {
+    return LabyrinthStatus::kExitAlreadySet;
+  }
+
+  exit_room_ = rm;
+  exit_direction_ = d;
+  exit_set_ = true;
+  return LabyrinthStatus::kOk;
+}
+
+// This method places an Inhabitant in a Room.
+// Returns kOutOfBounds, kNullInhabitant, or kOccupied upon failure.
+LabyrinthStatus Labyrinth::TrySetInhabitant( const Coordinate rm,
+                                             const Inhabitant inh )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( inh == Inhabitant::kNone )
+  {
+    return LabyrinthStatus::kNullInhabitant;
+  }
+
+  RoomCell& cell = CellAt(rm);
+  if( cell.GetInhabitant() != Inhabitant::kNone )
+  {
+    return LabyrinthStatus::kOccupied;
+  }
+
+  cell.SetInhabitant(inh);
+  return LabyrinthStatus::kOk;
+}
+
+// This method places an Item in a Room.
+// Returns kOutOfBounds, kNullItem, kOccupied, or kTreasureAlreadySet upon
+// failure.
+LabyrinthStatus Labyrinth::TrySetItem( const Coordinate rm, const Item itm )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( itm == Item::kNone )
+  {
+    return LabyrinthStatus::kNullItem;
+  }
+
+  RoomCell& cell = CellAt(rm);
+  if( cell.GetItem() != Item::kNone )
+  {
+    return LabyrinthStatus::kOccupied;
+  }
+  else if( itm == Item::kTreasure && treasure_set_ )
+  {
+    return LabyrinthStatus::kTreasureAlreadySet;
+  }
+
+  cell.SetItem(itm);
+  if( itm == Item::kTreasure )
+  {
+    treasure_set_ = true;
+  }
+  return LabyrinthStatus::kOk;
+}
+
+// This method returns the current Inhabitant of the Room.
+// Returns kOutOfBounds upon failure.
+LabyrinthResult<Inhabitant>
+Labyrinth::TryGetInhabitant( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    return { LabyrinthStatus::kOutOfBounds, Inhabitant::kNone };
+  }
+  return { LabyrinthStatus::kOk, GetInhabitantUnchecked(rm) };
+}
+
+// This method attacks the Inhabitant of the Room, and sets the resultant
+// Inhabitant.
+// Returns kOutOfBounds or kNoEnemy upon failure.
+LabyrinthStatus Labyrinth::TryAttackEnemy( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  return AttackEnemyUnchecked(rm);
+}
+
+// This method returns the current Item in the given Room, but does not
+// change it.
+// Returns kOutOfBounds upon failure.
+LabyrinthResult<Item> Labyrinth::TryItemAt( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    return { LabyrinthStatus::kOutOfBounds, Item::kNone };
+  }
+  return { LabyrinthStatus::kOk, ItemAtUnchecked(rm) };
+}
+
+// This method takes the Item from the Room.
+// Returns kOutOfBounds or kNoItem upon failure.
+LabyrinthStatus Labyrinth::TryTakeItem( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  return TakeItemUnchecked(rm);
+}
+
+// This method drops the Treasure in the given Room.
+// Returns kOutOfBounds or kTreasureAlreadySet upon failure.
+LabyrinthStatus Labyrinth::TryDropTreasure( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( treasure_set_ )
+  {
+    return LabyrinthStatus::kTreasureAlreadySet;
+  }
+
+  CellAt(rm).SetItem(Item::kTreasure);
+  treasure_set_ = true;
+  return LabyrinthStatus::kOk;
+}
+
+// This method returns the type of RoomBorder in the given direction.
+// Returns kOutOfBounds or kInvalidDirection upon failure.
+LabyrinthResult<RoomBorder>
+Labyrinth::TryDirectionCheck( const Coordinate rm, const Direction d ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    return { LabyrinthStatus::kOutOfBounds, RoomBorder::kWall };
+  }
+  else if( d == Direction::kNone )
+  {
+    return { LabyrinthStatus::kInvalidDirection, RoomBorder::kWall };
+  }
+  return { LabyrinthStatus::kOk, DirectionCheckUnchecked(rm, d) };
+}
+
+// UNCHECKED:
+
+// This method returns the current Inhabitant of the Room.
+// Bounds are not checked.
+Inhabitant Labyrinth::GetInhabitantUnchecked( const Coordinate rm ) const
+{
+  return CellAt(rm).GetInhabitant();
+}
+
+// This method returns the current Item in the given Room.
+// Bounds are not checked.
+Item Labyrinth::ItemAtUnchecked( const Coordinate rm ) const
+{
+  return CellAt(rm).GetItem();
+}
+
+// This method returns the type of RoomBorder in the given direction.
+// Bounds are not checked, and Direction d must not be kNone.
+RoomBorder Labyrinth::DirectionCheckUnchecked( const Coordinate rm,
+                                               const Direction d ) const
+{
+  if( exit_set_ && d == exit_direction_ && rm == exit_room_ )
+  {
+    return RoomBorder::kExit;
+  }
+  else if( walls_.IsWall(rm, d) )
+  {
+    return RoomBorder::kWall;
+  }
+  return RoomBorder::kRoom;
+}
+
+// This method attacks the Inhabitant of the Room, and sets the resultant
+// Inhabitant.
+// Bounds are not checked.
+// Returns kNoEnemy upon failure.
+LabyrinthStatus Labyrinth::AttackEnemyUnchecked( const Coordinate rm )
+{
+  RoomCell& cell = CellAt(rm);
+  switch( cell.GetInhabitant() )
+  {
+    case Inhabitant::kMinotaur:
+      cell.SetInhabitant(Inhabitant::kMinotaurDead);
+      return LabyrinthStatus::kOk;
+
+    case Inhabitant::kMirror:
+      cell.SetInhabitant(Inhabitant::kMirrorCracked);
+      return LabyrinthStatus::kOk;
+
+    default:
+      return LabyrinthStatus::kNoEnemy;
+  }
+}
+
+// This method takes the Item from the Room.
+// Bounds are not checked.
+// Returns kNoItem upon failure.
+LabyrinthStatus Labyrinth::TakeItemUnchecked( const Coordinate rm )
+{
+  RoomCell& cell = CellAt(rm);
+  switch( cell.GetItem() )
+  {
+    case Item::kBullet:
+      cell.SetItem(Item::kNone);
+      return LabyrinthStatus::kOk;
+
+    case Item::kTreasure:
+      cell.SetItem(Item::kTreasureGone);
+      treasure_set_ = false;
+      return LabyrinthStatus::kOk;
+
+    default:
+      return LabyrinthStatus::kNoItem;
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method returns true if the Room is within an exclusion
+// zone of the population, and false otherwise.
+bool Labyrinth::IsExcluded( const Coordinate rm,
+                            const LabyrinthPopulation& population ) const
+{
+  const size_t r = population.exclusion_radius;
+  const auto near = [rm, r]( const Coordinate c )
+  {
+    const size_t dx = rm.x > c.x ? rm.x - c.x : c.x - rm.x;
+    const size_t dy = rm.y > c.y ? rm.y - c.y : c.y - rm.y;
+    return dx <= r && dy <= r;
+  };
+
+  return ( population.exclude_spawns &&
+           ( near(spawn_1_) || near(spawn_2_) ) ) ||
+         ( population.exclude_exit && exit_set_ && near(exit_room_) );
+}
+
+// This private method returns the number of Rooms in a Labyrinth of the
+// given size.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+//   The number of Rooms overflows a size_t (domain_error)
+size_t Labyrinth::RoomCount( const size_t x_size, const size_t y_size )
+{
+  if( x_size == 0 )
+  {
+    if( y_size == 0 )
+    {
+      throw std::domain_error( "Error: Labyrinth() was given empty x and "\
+        "y sizes.\n" );
+    }
+    else
+    {
+      throw std::domain_error( "Error: Labyrinth() was given an empty "\
+        "x size.\n" );
+    }
+  }
+  else if( y_size == 0 )
+  {
+    throw std::domain_error( "Error: Labyrinth() was given an empty "\
+      "y size.\n" );
+  }
+
+  // The size is limited only by available memory (make_unique throws
+  // bad_alloc) and by the Room count fitting into a size_t.
+  if( x_size > std::numeric_limits<size_t>::max() / y_size )
+  {
+    throw std::domain_error( "Error: Labyrinth() was given x and y sizes "\
+      "whose Room count cannot be indexed.\n" );
+  }
+
+  return x_size * y_size;
+}
+
+// This private method returns a reference to the contents of the Room
+// at the given coordinate.
+// Bounds are not checked; the Coordinate must be within the Labyrinth.
+RoomCell& Labyrinth::CellAt( const Coordinate rm ) const
+{
+  return rooms_[IndexOf(rm)];
+}
+
+// This private method returns the Direction from rm_1 to rm_2 if the two
+// Rooms are adjacent, or kNone otherwise (including if they are the same).
+// Bounds are not checked.
+Direction Labyrinth::DirectionBetween( const Coordinate rm_1,
+                                       const Coordinate rm_2 )
+{
+  if( rm_1.x == rm_2.x )
+  {
+    if( rm_2.y == rm_1.y + 1 )
+    {
+      return Direction::kSouth;
+    }
+    else if( rm_1.y == rm_2.y + 1 )
+    {
+      return Direction::kNorth;
+    }
+  }
+  else if( rm_1.y == rm_2.y )
+  {
+    if( rm_2.x == rm_1.x + 1 )
+    {
+      return Direction::kEast;
+    }
+    else if( rm_1.x == rm_2.x + 1 )
+    {
+      return Direction::kWest;
+    }
+  }
+  return Direction::kNone;
+}
+
+// This private method returns the index of the given Room in rooms_.
+// Bounds are not checked; the Coordinate must be within the Labyrinth.
+size_t Labyrinth::IndexOf( const Coordinate rm ) const
+{
+  return rm.y * x_size_ + rm.x;
 }
 
 // This private method returns true if the Room is within the bounds of
@@ -0,0 +1,440 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the LabyrinthAudit class,
+ * which checks the structural invariants of a Labyrinth, or of a grid of
+ * Rooms, on a pool of threads.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_audit.hpp"
+
+constexpr size_t LabyrinthAudit::kMinRoomsPerThread;
+
+namespace
+{
+
+const Direction kDirections[] =
+{
+  Direction::kNorth,
+  Direction::kEast,
+  Direction::kSouth,
+  Direction::kWest,
+};
+
+// Bits of the mask returned by ReadSides()
+const uint8_t kOpenNorth = 1 << 0;
+const uint8_t kOpenEast  = 1 << 1;
+const uint8_t kOpenSouth = 1 << 2;
+const uint8_t kOpenWest  = 1 << 3;
+
+// This local function returns true if the Inhabitant is a valid
+// enumerator, and false otherwise.
+bool IsValidInhabitant( const Inhabitant inh );
+
+// This local function stores the RoomBorder of each side of the Room in
+// borders, in the order of kDirections, and returns a mask of the sides
+// which open onto another Room, with bit i set for kDirections[i].
+uint8_t ReadSides( const Room& r, RoomBorder borders[4] );
+
+// This local function returns true if the Room at (x, y) of an x_size by
+// y_size grid has a neighbour in the given direction, and false if the
+// direction leads outside the grid.
+bool HasNeighbour( const size_t x,
+                   const size_t y,
+                   const size_t x_size,
+                   const size_t y_size,
+                   const Direction d );
+
+// This local function returns true if the Inhabitant is a valid
+// enumerator, and false otherwise.
+bool IsValidInhabitant( const Inhabitant inh )
+{
+  return static_cast<unsigned>( inh ) <=
+         static_cast<unsigned>( Inhabitant::kMirrorCracked );
+}
+
+// This local function stores the RoomBorder of each side of the Room in
+// borders, in the order of kDirections, and returns a mask of the sides
+// which open onto another Room, with bit i set for kDirections[i].
+uint8_t ReadSides( const Room& r, RoomBorder borders[4] )
+{
+  uint8_t open = 0;
+  for( size_t i = 0; i < 4; ++i )
+  {
+    borders[i] = r.DirectionCheck( kDirections[i] );
+    open |= ( borders[i] == RoomBorder::kRoom ) << i;
+  }
+  return open;
+}
+
+// This local function returns true if the Room at (x, y) of an x_size by
+// y_size grid has a neighbour in the given direction, and false if the
+// direction leads outside the grid.
+bool HasNeighbour( const size_t x,
+                   const size_t y,
+                   const size_t x_size,
+                   const size_t y_size,
+                   const Direction d )
+{
+  switch( d )
+  {
+    case Direction::kNorth:
+      return y > 0;
+    case Direction::kEast:
+      return x + 1 < x_size;
+    case Direction::kSouth:
+      return y + 1 < y_size;
+    case Direction::kWest:
+      return x > 0;
+    default:
+      return false;
+  }
+}
+
+}  // Anonymous namespace
+
+// Parameterized constructor
+// A thread count of 0 uses one thread per hardware thread.
+LabyrinthAudit::LabyrinthAudit( const size_t thread_count ) :
+  thread_count_(thread_count != 0 ?
+                thread_count :
+                std::max( 1u, std::thread::hardware_concurrency() ))
+{
+}
+
+// AUDITING:
+
+// This method checks the Labyrinth and returns its violations, sorted
+// by Room (row-major) and then by check. The violations are valid
+// until the next audit.
+// An exception is thrown if:
+//   There is not enough memory for the violations (bad_alloc)
+//   A thread cannot be started (system_error)
+const std::vector<AuditViolation>& LabyrinthAudit::Audit( const Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  const size_t y_size = l.YSize();
+  const WallGrid& walls = l.Walls();
+  const size_t last = walls.WordsPerRow() - 1;
+  const uint64_t last_room = uint64_t( 1 ) << ( (x_size - 1) % 64 );
+  const uint64_t padding =
+    x_size % 64 == 0 ? 0 : ~uint64_t( 0 ) << ( x_size % 64 );
+
+  // The Labyrinth holds a single exit, which must face outwards
+  const bool has_exit = l.HasExit();
+  const Coordinate exit_room = has_exit ? l.ExitRoom() : Coordinate( 0, 0 );
+  const Direction exit_direction =
+    has_exit ? l.ExitDirection() : Direction::kNone;
+
+  RunBands( x_size, y_size,
+    [&]( const size_t y_start,
+         const size_t y_end,
+         std::vector<AuditViolation>& out )
+    {
+      for( size_t y = y_start; y < y_end; ++y )
+      {
+        const uint64_t* const east = walls.EastRow( y );
+        const uint64_t* const south = walls.SouthRow( y );
+        if( (east[last] & padding) != padding ||
+            (south[last] & padding) != padding )
+        {
+          out.push_back( AuditViolation{ Coordinate(0, y),
+                                         AuditCheck::kPaddingCleared,
+                                         Direction::kNone } );
+        }
+        if( !(east[last] & last_room) )
+        {
+          out.push_back( AuditViolation{ Coordinate(x_size - 1, y),
+                                         AuditCheck::kMissingOuterWall,
+                                         Direction::kEast } );
+        }
+        if( y + 1 == y_size )
+        {
+          for( size_t w = 0; w <= last; ++w )
+          {
+            for( uint64_t open = ~( south[w] | (w == last ? padding : 0) );
+                 open != 0;
+                 open &= open - 1 )
+            {
+              out.push_back( AuditViolation{
+                Coordinate(w * 64 + __builtin_ctzll(open), y),
+                AuditCheck::kMissingOuterWall,
+                Direction::kSouth } );
+            }
+          }
+        }
+
+        if( has_exit && exit_room.y == y &&
+            HasNeighbour(exit_room.x, y, x_size, y_size, exit_direction) )
+        {
+          out.push_back( AuditViolation{ exit_room,
+                                         AuditCheck::kInteriorExit,
+                                         exit_direction } );
+        }
+
+        for( size_t x = 0; x < x_size; ++x )
+        {
+          const Coordinate c( x, y );
+          if( l.ItemAtUnchecked(c) == Item::kTreasure )
+          {
+            out.push_back( AuditViolation{ c,
+                                           AuditCheck::kExtraTreasure,
+                                           Direction::kNone } );
+          }
+          if( !IsValidInhabitant(l.GetInhabitantUnchecked(c)) )
+          {
+            out.push_back( AuditViolation{ c,
+                                           AuditCheck::kInvalidInhabitant,
+                                           Direction::kNone } );
+          }
+        }
+      }
+    } );
+
+  return violations_;
+}
+
+// This method checks a grid of x_size by y_size packed Rooms, stored
+// row-major (index y * x_size + x), and returns its violations as
+// above.
+// An exception is thrown if:
+//   The Rooms are null (invalid_argument)
+//   A size of 0 is given (domain_error)
+//   The number of Rooms overflows a size_t (domain_error)
+//   There is not enough memory for the violations (bad_alloc)
+//   A thread cannot be started (system_error)
+const std::vector<AuditViolation>& LabyrinthAudit::Audit(
+  const Room* const rooms,
+  const size_t x_size,
+  const size_t y_size )
+{
+  if( rooms == nullptr )
+  {
+    throw std::invalid_argument( "Error: Audit() was given null Rooms.\n" );
+  }
+  else if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: Audit() was given a size of 0.\n" );
+  }
+  else if( x_size > SIZE_MAX / y_size )
+  {
+    throw std::domain_error( "Error: Audit() was given a size whose "\
+      "number of Rooms overflows a size_t.\n" );
+  }
+
+  RunBands( x_size, y_size,
+    [=]( const size_t y_start,
+         const size_t y_end,
+         std::vector<AuditViolation>& out )
+    {
+      // Each Room's sides are read once, and its open sides are compared
+      // against those of the Rooms to its west and north, so each shared
+      // Wall is compared once, and is reported from its west or north Room
+      std::vector<uint8_t> above( x_size );
+      std::vector<uint8_t> current( x_size );
+      RoomBorder borders[4];
+      if( y_start > 0 )
+      {
+        for( size_t x = 0; x < x_size; ++x )
+        {
+          above[x] = ReadSides( rooms[(y_start - 1) * x_size + x], borders );
+        }
+      }
+
+      for( size_t y = y_start; y < y_end; ++y )
+      {
+        for( size_t x = 0; x < x_size; ++x )
+        {
+          const Room& r = rooms[y * x_size + x];
+          const Coordinate c( x, y );
+          const uint8_t open = ReadSides( r, borders );
+          current[x] = open;
+          for( size_t i = 0; i < 4; ++i )
+          {
+            const Direction d = kDirections[i];
+            if( borders[i] == RoomBorder::kExit )
+            {
+              out.push_back(
+                AuditViolation{ c, AuditCheck::kExtraExit, d } );
+              if( HasNeighbour(x, y, x_size, y_size, d) )
+              {
+                out.push_back(
+                  AuditViolation{ c, AuditCheck::kInteriorExit, d } );
+              }
+            }
+            else if( borders[i] == RoomBorder::kRoom &&
+                     !HasNeighbour(x, y, x_size, y_size, d) )
+            {
+              out.push_back(
+                AuditViolation{ c, AuditCheck::kMissingOuterWall, d } );
+            }
+          }
+
+          if( x > 0 && !(current[x - 1] & kOpenEast) != !(open & kOpenWest) )
+          {
+            out.push_back( AuditViolation{ Coordinate(x - 1, y),
+                                           AuditCheck::kAsymmetricWall,
+                                           Direction::kEast } );
+          }
+          if( y > 0 && !(above[x] & kOpenSouth) != !(open & kOpenNorth) )
+          {
+            out.push_back( AuditViolation{ Coordinate(x, y - 1),
+                                           AuditCheck::kAsymmetricWall,
+                                           Direction::kSouth } );
+          }
+
+          if( r.GetItem() == Item::kTreasure )
+          {
+            out.push_back( AuditViolation{ c,
+                                           AuditCheck::kExtraTreasure,
+                                           Direction::kNone } );
+          }
+          if( !IsValidInhabitant(r.GetInhabitant()) )
+          {
+            out.push_back( AuditViolation{ c,
+                                           AuditCheck::kInvalidInhabitant,
+                                           Direction::kNone } );
+          }
+        }
+        above.swap( current );
+      }
+    } );
+  return violations_;
+}
+
+// This method returns the number of threads which an audit may use.
+size_t LabyrinthAudit::ThreadCount() const
+{
+  return thread_count_;
+}
+
+// PRIVATE METHODS:
+
+// This private method splits y_size rows of x_size Rooms into bands,
+// calls check( y_start, y_end, violations ) once per band on the
+// threads, and gathers and sorts the violations into violations_.
+// Each band's Treasures and exits are reported as kExtraTreasure and
+// kExtraExit by check(); all but the first of them in row-major order
+// are kept.
+template <typename Check>
+void LabyrinthAudit::RunBands( const size_t x_size,
+                               const size_t y_size,
+                               const Check& check )
+{
+  const size_t rooms = x_size * y_size;
+  const size_t bands = std::min( { thread_count_,
+                                   std::max( size_t(1),
+                                             rooms / kMinRoomsPerThread ),
+                                   y_size } );
+  const size_t rows_per_band = ( y_size + bands - 1 ) / bands;
+  std::vector<std::vector<AuditViolation>> found( bands );
+
+  // The first exception thrown is rethrown once every thread has finished
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  const auto work = [&]( const size_t band )
+  {
+    try
+    {
+      const size_t y_start = std::min( band * rows_per_band, y_size );
+      check( y_start, std::min( y_start + rows_per_band, y_size ),
+             found[band] );
+    }
+    catch( ... )
+    {
+      std::lock_guard<std::mutex> lock( error_mutex );
+      if( !error )
+      {
+        error = std::current_exception();
+      }
+    }
+  };
+
+  // The calling thread takes the first band
+  std::vector<std::thread> threads;
+  try
+  {
+    for( size_t band = 1; band < bands; ++band )
+    {
+      threads.emplace_back( work, band );
+    }
+  }
+  catch( ... )
+  {
+    for( std::thread& t : threads )
+    {
+      t.join();
+    }
+    throw;
+  }
+  work( 0 );
+  for( std::thread& t : threads )
+  {
+    t.join();
+  }
+  if( error )
+  {
+    std::rethrow_exception( error );
+  }
+
+  violations_.clear();
+  for( const std::vector<AuditViolation>& v : found )
+  {
+    violations_.insert( violations_.end(), v.begin(), v.end() );
+  }
+  std::sort( violations_.begin(), violations_.end(),
+    []( const AuditViolation& a, const AuditViolation& b )
+    {
+      if( a.room.y != b.room.y )
+      {
+        return a.room.y < b.room.y;
+      }
+      else if( a.room.x != b.room.x )
+      {
+        return a.room.x < b.room.x;
+      }
+      else if( a.check != b.check )
+      {
+        return a.check < b.check;
+      }
+      return a.direction < b.direction;
+    } );
+
+  // The first Treasure and the first exit are allowed
+  bool treasure_seen = false;
+  bool exit_seen = false;
+  size_t kept = 0;
+  for( const AuditViolation& v : violations_ )
+  {
+    if( v.check == AuditCheck::kExtraTreasure && !treasure_seen )
+    {
+      treasure_seen = true;
+    }
+    else if( v.check == AuditCheck::kExtraExit && !exit_seen )
+    {
+      exit_seen = true;
+    }
+    else
+    {
+      violations_[kept++] = v;
+    }
+  }
+  violations_.resize( kept );
+}
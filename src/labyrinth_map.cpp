@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-02-01
+ * Last edited: 2026-10-18
  *
  * This C++ header file contains the LabyrinthMap class which creates, updates,
  * and displays a map of a given Labyrinth.
@@ -10,6 +10,7 @@
 
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 #include <string>
 
@@ -114,6 +115,7 @@ void LabyrinthMapCoordinateRoom::SetItem( const Item i )
 // An exception is thrown if:
 //   l is null (invalid_argument)
 //   A size of 0 is given (domain_error)
+//   A size is too large for the Map to be indexed (domain_error)
 LabyrinthMap::LabyrinthMap( const Labyrinth* const l,
                             const size_t x_size,
                             const size_t y_size ) :
@@ -146,6 +148,12 @@ LabyrinthMap::LabyrinthMap( const Labyrinth* const l,
     throw std::domain_error( "Error: LabyrinthMap() was given an empty "\
       "y size.\n" );
   }
+  else if( x_size > kMaxMapRooms || y_size > kMaxMapRooms ||
+           map_x_size_ > std::numeric_limits<size_t>::max() / map_y_size_ )
+  {
+    throw std::domain_error( "Error: LabyrinthMap() was given x and y "\
+      "sizes whose Map cannot be indexed.\n" );
+  }
 
   // Creation of the map array
   auto map_temp_1 = std::make_unique<
@@ -506,7 +514,7 @@ void LabyrinthMap::LabelXAxis() const
   // Final length of the displayed map is around 3 times the labyrinth length
   // because the final map consists of Rooms which have 1 Border character
   // and 2 space characters.
-  const size_t kXMiddle = (x_size_ * 3)/2 + 1;
+  const size_t kXMiddle = x_size_ + x_size_/2 + 1;
   for( size_t i = 0; i < kXMiddle; ++i )
   {
     std::cout << " ";
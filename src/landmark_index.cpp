@@ -0,0 +1,149 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the LandmarkIndex class,
+ * which holds the distances of every Room of a Labyrinth from a few
+ * landmark Rooms, for guiding shortest-path searches.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_view.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/landmark_index.hpp"
+
+constexpr size_t LandmarkIndex::kMaxLandmarks;
+
+// Default constructor
+// No landmarks are held until Build() is called.
+LandmarkIndex::LandmarkIndex()
+{
+}
+
+// INDEX:
+
+// This method chooses the given number of landmarks and finds the
+// distance of every Room from each.
+// An exception is thrown if:
+//   The count is 0 or greater than kMaxLandmarks (domain_error)
+//   The Labyrinth has 2^32 or more Rooms (domain_error)
+//   There is not enough memory for the distances (bad_alloc)
+//
+// The index is only replaced once it has been built, so it is unchanged
+// if an exception is thrown.
+void LandmarkIndex::Build( const LabyrinthView& l, const size_t count )
+{
+  if( count == 0 || count > kMaxLandmarks )
+  {
+    throw std::domain_error( "Error: Build() was given a number of "\
+      "landmarks which is 0 or greater than kMaxLandmarks.\n" );
+  }
+  // Labyrinth sizes have already been checked against overflow
+  else if( l.XSize() * l.YSize() >= DistanceField::kUnreachable )
+  {
+    throw std::domain_error( "Error: Build() was given a Labyrinth with "\
+      "2^32 or more Rooms.\n" );
+  }
+
+  const size_t x_size = l.XSize();
+  const size_t rooms = x_size * l.YSize();
+  std::vector<uint32_t> distances( rooms * count );
+  std::vector<Coordinate> landmarks;
+  landmarks.reserve( count );
+
+  // The distance of each Room from the nearest landmark so far; a Room
+  // which no landmark reaches is the farthest of all
+  std::vector<uint32_t> nearest( rooms, DistanceField::kUnreachable );
+
+  DistanceField f;
+  f.Compute( l, Coordinate(x_size / 2, l.YSize() / 2) );
+  const uint32_t* d = f.Distances();
+  size_t next = 0;
+  for( size_t i = 0; i < rooms; ++i )
+  {
+    if( d[i] != DistanceField::kUnreachable && d[i] > d[next] )
+    {
+      next = i;
+    }
+  }
+
+  for( size_t k = 0; k < count; ++k )
+  {
+    landmarks.push_back( Coordinate(next % x_size, next / x_size) );
+    f.Compute( l, landmarks.back() );
+    d = f.Distances();
+    for( size_t i = 0; i < rooms; ++i )
+    {
+      distances[i * count + k] = d[i];
+      nearest[i] = std::min( nearest[i], d[i] );
+    }
+    next = std::max_element( nearest.begin(), nearest.end() ) -
+           nearest.begin();
+  }
+
+  distances_.swap( distances );
+  landmarks_.swap( landmarks );
+  x_size_ = x_size;
+  y_size_ = l.YSize();
+}
+
+// This method returns the number of landmarks, or 0 if nothing has
+// been built.
+size_t LandmarkIndex::LandmarkCount() const
+{
+  return landmarks_.size();
+}
+
+// This method returns the Room of the given landmark.
+// An exception is thrown if:
+//   There is no landmark with the given number (domain_error)
+Coordinate LandmarkIndex::Landmark( const size_t i ) const
+{
+  if( i >= landmarks_.size() )
+  {
+    throw std::domain_error( "Error: Landmark() was given the number of "\
+      "a landmark which does not exist.\n" );
+  }
+  return landmarks_[i];
+}
+
+// This method returns the distances of every Room from each
+// landmark, or nullptr if nothing has been built. The distance of
+// the Room at index (y * x_size + x) from landmark k is found at
+// index (y * x_size + x) * LandmarkCount() + k, and is
+// DistanceField::kUnreachable if the Room cannot be reached from
+// the landmark. The array is valid until the next Build().
+const uint32_t* LandmarkIndex::Distances() const
+{
+  return landmarks_.empty() ? nullptr : distances_.data();
+}
+
+// This method returns the number of bytes of memory held by the
+// index.
+size_t LandmarkIndex::MemoryUsage() const
+{
+  return sizeof( *this ) +
+         distances_.capacity() * sizeof( uint32_t ) +
+         landmarks_.capacity() * sizeof( Coordinate );
+}
+
+// These methods return the size of the indexed Labyrinth, or 0 if
+// nothing has been built.
+size_t LandmarkIndex::XSize() const
+{
+  return x_size_;
+}
+
+size_t LandmarkIndex::YSize() const
+{
+  return y_size_;
+}
@@ -0,0 +1,166 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the LevelTopology class,
+ * the read-only part of a level which any number of games can share.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/room_cell.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_view.hpp"
+#include "../include/level_topology.hpp"
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Parameterized constructor
+// This constructor copies the Labyrinth as it is now.
+// An exception is thrown if:
+//   There is not enough memory for the copy (bad_alloc)
+LevelTopology::LevelTopology( const Labyrinth& l ) :
+  x_size_(l.XSize()),
+  y_size_(l.YSize()),
+  walls_(l.XSize(), l.YSize()),
+  spawn_1_(l.Spawn1()),
+  spawn_2_(l.Spawn2())
+{
+  walls_.Assign( l.Walls().EastRow(0), l.Walls().SouthRow(0) );
+
+  const size_t rooms = x_size_ * y_size_;
+  rooms_ = std::make_unique<RoomCell[]>( rooms );
+  std::copy( l.Cells(), l.Cells() + rooms, rooms_.get() );
+  for( size_t i = 0; i < rooms; ++i )
+  {
+    treasure_set_ |= rooms_[i].GetItem() == Item::kTreasure;
+  }
+
+  if( l.HasExit() )
+  {
+    exit_room_ = l.ExitRoom();
+    exit_direction_ = l.ExitDirection();
+    exit_set_ = true;
+  }
+}
+
+// SIZE:
+
+// These methods return the number of Rooms along each axis.
+size_t LevelTopology::XSize() const
+{
+  return x_size_;
+}
+
+size_t LevelTopology::YSize() const
+{
+  return y_size_;
+}
+
+// SPECIAL ROOMS AND WALLS:
+
+// These methods return the spawn Rooms of the Players.
+Coordinate LevelTopology::Spawn1() const
+{
+  return spawn_1_;
+}
+
+Coordinate LevelTopology::Spawn2() const
+{
+  return spawn_2_;
+}
+
+// This method returns true if the exit has been set, and false
+// otherwise.
+bool LevelTopology::HasExit() const
+{
+  return exit_set_;
+}
+
+// This method returns the Room which has the exit.
+// An exception is thrown if:
+//   The exit has not been set (logic_error)
+Coordinate LevelTopology::ExitRoom() const
+{
+  if( !exit_set_ )
+  {
+    throw std::logic_error( "Error: ExitRoom() was called, but the exit "\
+      "has not been set.\n" );
+  }
+  return exit_room_;
+}
+
+// This method returns true if a Room starts with the Treasure, and
+// false otherwise.
+bool LevelTopology::HasTreasure() const
+{
+  return treasure_set_;
+}
+
+// This method returns the type of RoomBorder in the given direction.
+// An exception is thrown if:
+//   The Room is outside the level (domain_error)
+//   Direction d is kNone (invalid_argument)
+RoomBorder LevelTopology::DirectionCheck( const Coordinate rm,
+                                          const Direction d ) const
+{
+  if( rm.x >= x_size_ || rm.y >= y_size_ )
+  {
+    throw std::domain_error( "Error: DirectionCheck() was given a "\
+      "Coordinate outside of the level.\n" );
+  }
+  else if( d == Direction::kNone )
+  {
+    throw std::invalid_argument( "Error: DirectionCheck() was given an "\
+      "invalid direction (kNone).\n" );
+  }
+
+  return DirectionCheckUnchecked( rm, d );
+}
+
+// This method returns a view of the level for the search and
+// validation algorithms, with the Inhabitants and Items which
+// games start with.
+LevelTopology::operator LabyrinthView() const
+{
+  return LabyrinthView( x_size_, y_size_,
+                        walls_.EastRow(0), walls_.SouthRow(0),
+                        rooms_.get(),
+                        spawn_1_, spawn_2_,
+                        exit_set_, exit_room_ );
+}
+
+// UNCHECKED:
+
+Inhabitant LevelTopology::GetInhabitantUnchecked( const Coordinate rm ) const
+{
+  return rooms_[IndexOf( rm )].GetInhabitant();
+}
+
+Item LevelTopology::ItemAtUnchecked( const Coordinate rm ) const
+{
+  return rooms_[IndexOf( rm )].GetItem();
+}
+
+// Direction d must not be kNone.
+RoomBorder LevelTopology::DirectionCheckUnchecked( const Coordinate rm,
+                                                   const Direction d ) const
+{
+  if( exit_set_ && d == exit_direction_ && rm == exit_room_ )
+  {
+    return RoomBorder::kExit;
+  }
+  else if( walls_.IsWall(rm, d) )
+  {
+    return RoomBorder::kWall;
+  }
+  return RoomBorder::kRoom;
+}
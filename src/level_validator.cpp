@@ -0,0 +1,216 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the LevelValidator class,
+ * which finds the connected regions of a Labyrinth with a union-find and
+ * checks that it is playable.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_view.hpp"
+#include "../include/level_report.hpp"
+#include "../include/level_validator.hpp"
+
+// Default constructor
+LevelValidator::LevelValidator()
+{
+}
+
+// VALIDATION:
+
+// This method finds the regions of the Labyrinth and checks its
+// special Rooms. The report is valid until the next validation.
+// An exception is thrown if:
+//   The Labyrinth has 2^32 or more Rooms (domain_error)
+//   There is not enough memory for the regions (bad_alloc)
+const LevelReport& LevelValidator::Validate( const LabyrinthView& l )
+{
+  // Labyrinth sizes have already been checked against overflow
+  const size_t x_size = l.XSize();
+  const size_t rooms = x_size * l.YSize();
+  if( rooms >= UINT32_MAX )
+  {
+    throw std::domain_error( "Error: Validate() was given a Labyrinth with "\
+      "2^32 or more Rooms.\n" );
+  }
+
+  // Nothing is kept from the last Labyrinth if memory runs out
+  x_size_ = 0;
+  y_size_ = 0;
+  parent_.resize( rooms );
+  size_.resize( rooms );
+  for( uint32_t i = 0; i < rooms; ++i )
+  {
+    parent_[i] = i;
+    size_[i] = 1;
+  }
+
+  // A cleared bit of a Wall bitmap is a broken Wall. The Walls on the
+  // outside of the Labyrinth and the padding bits at the end of each row
+  // are always set, so every cleared east bit has a Room to its east and
+  // every cleared south bit a Room to its south.
+  const size_t words_per_row = l.WordsPerRow();
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    const uint64_t* const east = l.EastRow( y );
+    const uint64_t* const south = l.SouthRow( y );
+    for( size_t w = 0; w < words_per_row; ++w )
+    {
+      const uint32_t first = static_cast<uint32_t>( y * x_size + w * 64 );
+      for( uint64_t open = ~east[w]; open != 0; open &= open - 1 )
+      {
+        const uint32_t i = first + __builtin_ctzll( open );
+        Merge( i, i + 1 );
+      }
+      for( uint64_t open = ~south[w]; open != 0; open &= open - 1 )
+      {
+        const uint32_t i = first + __builtin_ctzll( open );
+        Merge( i, i + static_cast<uint32_t>(x_size) );
+      }
+    }
+  }
+
+  report_.regions.clear();
+  report_.isolated_rooms = 0;
+  report_.missing.clear();
+  report_.unreachable.clear();
+  for( uint32_t i = 0; i < rooms; ++i )
+  {
+    if( parent_[i] == i )
+    {
+      report_.regions.push_back(
+        LevelRegion{ Coordinate(i % x_size, i / x_size), size_[i] } );
+      report_.isolated_rooms += size_[i] == 1;
+    }
+  }
+  std::sort( report_.regions.begin(), report_.regions.end(),
+    []( const LevelRegion& a, const LevelRegion& b )
+    {
+      return a.size > b.size ||
+             ( a.size == b.size && ( a.room.y < b.room.y ||
+                                     ( a.room.y == b.room.y &&
+                                       a.room.x < b.room.x ) ) );
+    } );
+
+  // The special Rooms, each checked against the primary spawn
+  const uint32_t spawn = Find(
+    static_cast<uint32_t>( l.Spawn1().y * x_size + l.Spawn1().x ) );
+  const auto check = [this, x_size, spawn]( const Coordinate rm,
+                                            const SpecialRoom s )
+  {
+    if( Find(static_cast<uint32_t>(rm.y * x_size + rm.x)) != spawn )
+    {
+      report_.unreachable.push_back( s );
+    }
+  };
+  check( l.Spawn2(), SpecialRoom::kSpawn2 );
+
+  bool treasure_found = false;
+  for( size_t y = 0; y < l.YSize() && !treasure_found; ++y )
+  {
+    for( size_t x = 0; x < x_size; ++x )
+    {
+      if( l.ItemAtUnchecked(Coordinate(x, y)) == Item::kTreasure )
+      {
+        check( Coordinate(x, y), SpecialRoom::kTreasure );
+        treasure_found = true;
+        break;
+      }
+    }
+  }
+  if( !treasure_found )
+  {
+    report_.missing.push_back( SpecialRoom::kTreasure );
+  }
+
+  if( l.HasExit() )
+  {
+    check( l.ExitRoom(), SpecialRoom::kExit );
+  }
+  else
+  {
+    report_.missing.push_back( SpecialRoom::kExit );
+  }
+
+  x_size_ = x_size;
+  y_size_ = l.YSize();
+  return report_;
+}
+
+// This method returns true if the two Rooms were in the same region
+// of the last validated Labyrinth, and false otherwise.
+// An exception is thrown if:
+//   Nothing has been validated (logic_error)
+//   A Room is outside the validated Labyrinth (domain_error)
+bool LevelValidator::Connected( const Coordinate rm_1,
+                                const Coordinate rm_2 ) const
+{
+  if( x_size_ == 0 )
+  {
+    throw std::logic_error( "Error: Connected() was called before a "\
+      "Labyrinth was validated.\n" );
+  }
+  else if( rm_1.x >= x_size_ || rm_1.y >= y_size_ ||
+           rm_2.x >= x_size_ || rm_2.y >= y_size_ )
+  {
+    throw std::domain_error( "Error: Connected() was given a Room which is "\
+      "outside the validated Labyrinth.\n" );
+  }
+  return FindConst( static_cast<uint32_t>(rm_1.y * x_size_ + rm_1.x) ) ==
+         FindConst( static_cast<uint32_t>(rm_2.y * x_size_ + rm_2.x) );
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the root of the set of the Room,
+// halving the path to it.
+uint32_t LevelValidator::Find( uint32_t i )
+{
+  while( parent_[i] != i )
+  {
+    parent_[i] = parent_[parent_[i]];
+    i = parent_[i];
+  }
+  return i;
+}
+
+// This private method returns the root of the set of the Room,
+// leaving the sets unchanged.
+uint32_t LevelValidator::FindConst( uint32_t i ) const
+{
+  while( parent_[i] != i )
+  {
+    i = parent_[i];
+  }
+  return i;
+}
+
+// This private method merges the sets of the two Rooms.
+void LevelValidator::Merge( const uint32_t i, const uint32_t j )
+{
+  uint32_t a = Find( i );
+  uint32_t b = Find( j );
+  if( a == b )
+  {
+    return;
+  }
+  else if( size_[a] < size_[b] )
+  {
+    std::swap( a, b );
+  }
+  parent_[b] = a;
+  size_[a] += size_[b];
+}
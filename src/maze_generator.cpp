@@ -0,0 +1,397 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the MazeGenerator class,
+ * which carves a random maze into a Labyrinth.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/maze_generator.hpp"
+
+namespace
+{
+
+// States of a Room during Prim's algorithm
+constexpr uint8_t kPrimOutside  = 0;
+constexpr uint8_t kPrimFrontier = 1;
+constexpr uint8_t kPrimInMaze   = 2;
+
+// During Wilson's algorithm, the low bits of a Room's state hold the
+// direction last taken out of it by the current walk (0 to 3 for north,
+// east, south, west), and this bit is set once it is part of the maze.
+constexpr uint8_t kWilsonInMaze = 0x80;
+
+}  // Anonymous namespace
+
+// Parameterized constructor
+MazeGenerator::MazeGenerator( const MazeAlgorithm algorithm,
+                              const uint64_t seed ) :
+  algorithm_(algorithm),
+  rng_(seed)
+{
+}
+
+// Parameterized constructor
+// The generator continues the given random stream.
+MazeGenerator::MazeGenerator( const MazeAlgorithm algorithm,
+                              const RandomGenerator& rng ) :
+  algorithm_(algorithm),
+  rng_(rng)
+{
+}
+
+// This method carves a maze into the Labyrinth.
+// The Labyrinth should have every interior Wall intact (as it is when
+// constructed) and no exit; Walls which cannot be broken are skipped,
+// in which case the maze will not be perfect.
+// An exception is thrown if:
+//   The algorithm is not a valid MazeAlgorithm (invalid_argument)
+//   There is not enough memory for the working state (bad_alloc)
+void MazeGenerator::Generate( Labyrinth& l )
+{
+  GenerateRegion( l, Coordinate(0, 0), l.XSize(), l.YSize() );
+}
+
+// This method carves a maze into the x_size by y_size region of the
+// Labyrinth whose top left Room is top_left, breaking only the Walls
+// between Rooms of the region.
+// The requirements of Generate() apply to the region.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+//   The region is not entirely within the Labyrinth (domain_error)
+//   The algorithm is not a valid MazeAlgorithm (invalid_argument)
+//   There is not enough memory for the working state (bad_alloc)
+void MazeGenerator::GenerateRegion( Labyrinth& l,
+                                    const Coordinate top_left,
+                                    const size_t x_size,
+                                    const size_t y_size )
+{
+  if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: GenerateRegion() was given an empty "\
+      "size.\n" );
+  }
+  else if( top_left.x >= l.XSize() || x_size > l.XSize() - top_left.x ||
+           top_left.y >= l.YSize() || y_size > l.YSize() - top_left.y )
+  {
+    throw std::domain_error( "Error: GenerateRegion() was given a region "\
+      "outside the Labyrinth.\n" );
+  }
+
+  origin_ = top_left;
+  x_size_ = x_size;
+  y_size_ = y_size;
+  switch( algorithm_ )
+  {
+    case MazeAlgorithm::kRecursiveBacktracker:
+      RecursiveBacktracker( l );
+      return;
+    case MazeAlgorithm::kKruskal:
+      Kruskal( l );
+      return;
+    case MazeAlgorithm::kPrim:
+      Prim( l );
+      return;
+    case MazeAlgorithm::kWilson:
+      Wilson( l );
+      return;
+    default:
+      throw std::invalid_argument( "Error: Generate() was given an invalid "\
+        "algorithm.\n" );
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method carves a maze with a depth-first search which
+// backtracks using an explicit stack, so that the depth of the search is
+// not limited by the call stack.
+void MazeGenerator::RecursiveBacktracker( Labyrinth& l )
+{
+  const size_t x_size = x_size_;
+  const size_t y_size = y_size_;
+  const size_t room_count = x_size * y_size;
+
+  std::vector<bool> visited( room_count, false );
+  std::vector<size_t> stack;
+
+  const size_t start = rng_.Below( room_count );
+  visited[start] = true;
+  stack.push_back( start );
+
+  size_t neighbours[4];
+  size_t unvisited[4];
+  while( !stack.empty() )
+  {
+    const size_t rm = stack.back();
+    const size_t count = Neighbours( rm, x_size, y_size, neighbours );
+    size_t unvisited_count = 0;
+    for( size_t i = 0; i < count; ++i )
+    {
+      if( !visited[neighbours[i]] )
+      {
+        unvisited[unvisited_count++] = neighbours[i];
+      }
+    }
+
+    if( unvisited_count == 0 )
+    {
+      stack.pop_back();
+      continue;
+    }
+
+    const size_t next = unvisited[rng_.Below(unvisited_count)];
+    Connect( l, rm, next );
+    visited[next] = true;
+    stack.push_back( next );
+  }
+}
+
+// This private method carves a maze by breaking randomly chosen Walls
+// between Rooms which are not yet connected, tracked with a union-find
+// forest. Walls are drawn with a partial Fisher-Yates shuffle, which stops
+// as soon as every Room is connected.
+void MazeGenerator::Kruskal( Labyrinth& l )
+{
+  const size_t x_size = x_size_;
+  const size_t y_size = y_size_;
+  const size_t room_count = x_size * y_size;
+
+  // Each interior Wall is stored as (index * 2) for the Wall to the east of
+  // the Room, or (index * 2 + 1) for the Wall to the south.
+  std::vector<size_t> walls;
+  walls.reserve( (x_size - 1) * y_size + x_size * (y_size - 1) );
+  for( size_t rm = 0; rm < room_count; ++rm )
+  {
+    if( rm % x_size != x_size - 1 )
+    {
+      walls.push_back( rm * 2 );
+    }
+    if( rm / x_size != y_size - 1 )
+    {
+      walls.push_back( rm * 2 + 1 );
+    }
+  }
+
+  std::vector<size_t> parent( room_count );
+  std::iota( parent.begin(), parent.end(), size_t(0) );
+  std::vector<uint8_t> rank( room_count, 0 );
+
+  // Finds the root of a Room's tree, halving the path along the way
+  const auto find = [&parent]( size_t rm )
+  {
+    while( parent[rm] != rm )
+    {
+      parent[rm] = parent[parent[rm]];
+      rm = parent[rm];
+    }
+    return rm;
+  };
+
+  size_t connections_left = room_count - 1;
+  for( size_t i = 0; i < walls.size() && connections_left > 0; ++i )
+  {
+    std::swap( walls[i], walls[i + rng_.Below(walls.size() - i)] );
+    const size_t rm_1 = walls[i] / 2;
+    const size_t rm_2 = ( walls[i] % 2 == 0 ) ? rm_1 + 1 : rm_1 + x_size;
+
+    size_t root_1 = find( rm_1 );
+    size_t root_2 = find( rm_2 );
+    if( root_1 == root_2 )
+    {
+      continue;
+    }
+
+    if( rank[root_1] < rank[root_2] )
+    {
+      std::swap( root_1, root_2 );
+    }
+    parent[root_2] = root_1;
+    if( rank[root_1] == rank[root_2] )
+    {
+      ++rank[root_1];
+    }
+
+    Connect( l, rm_1, rm_2 );
+    --connections_left;
+  }
+}
+
+// This private method carves a maze by growing it from a random Room,
+// each time connecting a random Room on its frontier to a random
+// neighbour already in the maze.
+void MazeGenerator::Prim( Labyrinth& l )
+{
+  const size_t x_size = x_size_;
+  const size_t y_size = y_size_;
+  const size_t room_count = x_size * y_size;
+
+  std::vector<uint8_t> state( room_count, kPrimOutside );
+  std::vector<size_t> frontier;
+  size_t neighbours[4];
+  size_t in_maze[4];
+
+  size_t rm = rng_.Below( room_count );
+  while( true )
+  {
+    state[rm] = kPrimInMaze;
+    const size_t count = Neighbours( rm, x_size, y_size, neighbours );
+    for( size_t i = 0; i < count; ++i )
+    {
+      if( state[neighbours[i]] == kPrimOutside )
+      {
+        state[neighbours[i]] = kPrimFrontier;
+        frontier.push_back( neighbours[i] );
+      }
+    }
+
+    if( frontier.empty() )
+    {
+      return;
+    }
+
+    // Remove a random Room from the frontier
+    const size_t chosen = rng_.Below( frontier.size() );
+    rm = frontier[chosen];
+    frontier[chosen] = frontier.back();
+    frontier.pop_back();
+
+    const size_t neighbour_count = Neighbours( rm, x_size, y_size,
+                                               neighbours );
+    size_t in_maze_count = 0;
+    for( size_t i = 0; i < neighbour_count; ++i )
+    {
+      if( state[neighbours[i]] == kPrimInMaze )
+      {
+        in_maze[in_maze_count++] = neighbours[i];
+      }
+    }
+    Connect( l, rm, in_maze[rng_.Below(in_maze_count)] );
+  }
+}
+
+// This private method carves a maze from loop-erased random walks: from
+// each Room not yet in the maze, a random walk is taken until it reaches
+// the maze, and the path is then added with its loops removed. Every
+// perfect maze is produced with equal probability.
+//
+// Loops are erased implicitly by remembering only the last direction
+// taken out of each Room, so the walk needs no storage of its own.
+void MazeGenerator::Wilson( Labyrinth& l )
+{
+  const size_t x_size = x_size_;
+  const size_t y_size = y_size_;
+  const size_t room_count = x_size * y_size;
+
+  std::vector<uint8_t> state( room_count, 0 );
+  state[rng_.Below(room_count)] = kWilsonInMaze;
+
+  // Returns the index of the Room in the given direction (0 to 3)
+  const auto step = [x_size]( const size_t rm, const uint8_t direction )
+  {
+    switch( direction )
+    {
+      case 0:
+        return rm - x_size;
+      case 1:
+        return rm + 1;
+      case 2:
+        return rm + x_size;
+      default:
+        return rm - 1;
+    }
+  };
+
+  size_t neighbours[4];
+  for( size_t start = 0; start < room_count; ++start )
+  {
+    // Walk until the maze is reached
+    size_t rm = start;
+    while( !(state[rm] & kWilsonInMaze) )
+    {
+      const size_t count = Neighbours( rm, x_size, y_size, neighbours );
+      const size_t next = neighbours[rng_.Below(count)];
+      uint8_t direction = 3;
+      if( next + x_size == rm )
+      {
+        direction = 0;
+      }
+      else if( next == rm + 1 )
+      {
+        direction = 1;
+      }
+      else if( next == rm + x_size )
+      {
+        direction = 2;
+      }
+      state[rm] = direction;
+      rm = next;
+    }
+
+    // Add the loop-erased path to the maze
+    rm = start;
+    while( !(state[rm] & kWilsonInMaze) )
+    {
+      const size_t next = step( rm, state[rm] );
+      Connect( l, rm, next );
+      state[rm] = kWilsonInMaze;
+      rm = next;
+    }
+  }
+}
+
+// This private method connects the two adjacent Rooms of the region with
+// the given indices.
+void MazeGenerator::Connect( Labyrinth& l,
+                             const size_t rm_1,
+                             const size_t rm_2 ) const
+{
+  const Coordinate c_1( origin_.x + rm_1 % x_size_,
+                        origin_.y + rm_1 / x_size_ );
+  const Coordinate c_2( origin_.x + rm_2 % x_size_,
+                        origin_.y + rm_2 / x_size_ );
+
+  // A Wall which cannot be broken (e.g. the exit) is left standing
+  (void)( l.TryConnectRooms( c_1, c_2 ) );
+}
+
+// This private method stores the indices of the Rooms adjacent to the
+// Room with index rm in neighbours, and returns how many there are.
+size_t MazeGenerator::Neighbours( const size_t rm,
+                                  const size_t x_size,
+                                  const size_t y_size,
+                                  size_t (&neighbours)[4] )
+{
+  const size_t x = rm % x_size;
+  const size_t y = rm / x_size;
+  size_t count = 0;
+  if( y > 0 )
+  {
+    neighbours[count++] = rm - x_size;
+  }
+  if( x < x_size - 1 )
+  {
+    neighbours[count++] = rm + 1;
+  }
+  if( y < y_size - 1 )
+  {
+    neighbours[count++] = rm + x_size;
+  }
+  if( x > 0 )
+  {
+    neighbours[count++] = rm - 1;
+  }
+  return count;
+}
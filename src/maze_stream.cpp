@@ -0,0 +1,222 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the MazeStreamWriter and
+ * MazeStreamReader classes, which write and read the Walls of a Labyrinth
+ * one row at a time in a streaming binary format.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth_layout.hpp"
+#include "../include/maze_stream.hpp"
+#include "../include/little_endian.hpp"
+
+namespace
+{
+
+// Identifies the streaming format and its version
+constexpr char kMagic[] = "LABYROW1";
+
+}  // Anonymous namespace
+
+// MAZESTREAMWRITER:
+
+// Parameterized constructor
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+//   The header cannot be written (runtime_error)
+MazeStreamWriter::MazeStreamWriter( std::ostream& out,
+                                    const size_t x_size,
+                                    const size_t y_size ) :
+  out_(out),
+  x_size_(x_size),
+  y_size_(y_size),
+  words_per_row_(WallGrid::WordsPerRow(x_size))
+{
+  if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: MazeStreamWriter() was given an "\
+      "empty size.\n" );
+  }
+
+  const uint64_t sizes[] = { x_size, y_size };
+  if( !WriteHeader(out_, kMagic, sizes) )
+  {
+    throw std::runtime_error( "Error: MazeStreamWriter() could not write "\
+      "to the stream.\n" );
+  }
+  buffer_.resize( words_per_row_ * 16 );
+}
+
+// This method writes the next row, given as WordsPerRow() east Wall
+// words and WordsPerRow() south Wall words.
+// An exception is thrown if:
+//   Every row has already been written (logic_error)
+//   The row cannot be written (runtime_error)
+void MazeStreamWriter::WriteRow( const uint64_t* const east,
+                                 const uint64_t* const south )
+{
+  if( rows_written_ == y_size_ )
+  {
+    throw std::logic_error( "Error: WriteRow() was called after every row "\
+      "was written.\n" );
+  }
+
+  // The row is encoded into one buffer so that it takes a single write
+  char* bytes = buffer_.data();
+  for( size_t i = 0; i < words_per_row_; ++i, bytes += 8 )
+  {
+    EncodeWord( east[i], bytes );
+  }
+  for( size_t i = 0; i < words_per_row_; ++i, bytes += 8 )
+  {
+    EncodeWord( south[i], bytes );
+  }
+  if( !out_.write( buffer_.data(), buffer_.size() ) )
+  {
+    throw std::runtime_error( "Error: WriteRow() could not write to the "\
+      "stream.\n" );
+  }
+  ++rows_written_;
+}
+
+// These methods return the size of the Labyrinth being written.
+size_t MazeStreamWriter::XSize() const
+{
+  return x_size_;
+}
+
+size_t MazeStreamWriter::YSize() const
+{
+  return y_size_;
+}
+
+// This method returns the number of 64-bit words in each bitmap row.
+size_t MazeStreamWriter::WordsPerRow() const
+{
+  return words_per_row_;
+}
+
+// This method returns the number of rows written so far.
+size_t MazeStreamWriter::RowsWritten() const
+{
+  return rows_written_;
+}
+
+// MAZESTREAMREADER:
+
+// Parameterized constructor
+// An exception is thrown if:
+//   The header is missing or invalid (runtime_error)
+//   The number of Rooms (x size * y size) in the header overflows a
+//     size_t (domain_error)
+MazeStreamReader::MazeStreamReader( std::istream& in ) :
+  in_(in)
+{
+  uint64_t sizes[2];
+  if( !ReadHeader(in_, kMagic, sizes) )
+  {
+    throw std::runtime_error( "Error: MazeStreamReader() was given a "\
+      "stream which is not a maze stream.\n" );
+  }
+
+  x_size_ = sizes[0];
+  y_size_ = sizes[1];
+  if( x_size_ == 0 || y_size_ == 0 )
+  {
+    throw std::runtime_error( "Error: MazeStreamReader() was given a "\
+      "stream with an empty size.\n" );
+  }
+  if( x_size_ > std::numeric_limits<size_t>::max() / y_size_ )
+  {
+    throw std::domain_error( "Error: MazeStreamReader() was given a "\
+      "stream with x and y sizes whose Room count cannot be indexed.\n" );
+  }
+  words_per_row_ = WallGrid::WordsPerRow( x_size_ );
+  buffer_.resize( words_per_row_ * 16 );
+}
+
+// This method reads the next row into WordsPerRow() east Wall words
+// and WordsPerRow() south Wall words, and returns true, or returns
+// false if every row has already been read.
+// An exception is thrown if:
+//   The stream ends in the middle of the rows (runtime_error)
+bool MazeStreamReader::ReadRow( uint64_t* const east, uint64_t* const south )
+{
+  if( rows_read_ == y_size_ )
+  {
+    return false;
+  }
+
+  if( !in_.read( buffer_.data(), buffer_.size() ) )
+  {
+    throw std::runtime_error( "Error: ReadRow() was given a stream which "\
+      "ended early.\n" );
+  }
+  const char* bytes = buffer_.data();
+  for( size_t i = 0; i < words_per_row_; ++i, bytes += 8 )
+  {
+    east[i] = DecodeWord( bytes );
+  }
+  for( size_t i = 0; i < words_per_row_; ++i, bytes += 8 )
+  {
+    south[i] = DecodeWord( bytes );
+  }
+  ++rows_read_;
+  return true;
+}
+
+// This method reads every row into a LabyrinthLayout without
+// Inhabitants or Items, which can be used to construct a Labyrinth.
+// An exception is thrown if:
+//   A row has already been read (logic_error)
+//   The stream ends in the middle of the rows (runtime_error)
+//   There is not enough memory for the layout (bad_alloc)
+LabyrinthLayout MazeStreamReader::ReadLayout()
+{
+  if( rows_read_ != 0 )
+  {
+    throw std::logic_error( "Error: ReadLayout() was called after a row "\
+      "was read.\n" );
+  }
+
+  LabyrinthLayout layout;
+  layout.x_size = x_size_;
+  layout.y_size = y_size_;
+  layout.east_walls.resize( words_per_row_ * y_size_ );
+  layout.south_walls.resize( words_per_row_ * y_size_ );
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    ReadRow( &layout.east_walls[y * words_per_row_],
+             &layout.south_walls[y * words_per_row_] );
+  }
+  return layout;
+}
+
+// These methods return the size of the Labyrinth in the stream.
+size_t MazeStreamReader::XSize() const
+{
+  return x_size_;
+}
+
+size_t MazeStreamReader::YSize() const
+{
+  return y_size_;
+}
+
+// This method returns the number of 64-bit words in each bitmap row.
+size_t MazeStreamReader::WordsPerRow() const
+{
+  return words_per_row_;
+}
@@ -0,0 +1,368 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the PathFinder class, which
+ * finds shortest paths between Rooms of a Labyrinth with A* search.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/packed_coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_view.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/landmark_index.hpp"
+#include "../include/room_layout.hpp"
+#include "../include/path_finder.hpp"
+
+constexpr uint32_t PathFinder::kUnreached;
+
+// Parameterized constructor
+// The order is the order of the per-Room arrays of the workspace.
+PathFinder::PathFinder( const RoomOrder order ) :
+  order_(order)
+{
+}
+
+// SEARCH:
+
+// This method returns a shortest path from one Room to another,
+// beginning with from and ending with to, or an empty path if to
+// cannot be reached from from. The path is valid until the next
+// search.
+// An exception is thrown if:
+//   A Room is outside the Labyrinth (domain_error)
+//   The Labyrinth has 2^32 or more Rooms, or needs as many in
+//     Morton order (domain_error)
+//   There is not enough memory for the search (bad_alloc)
+const std::vector<Coordinate>& PathFinder::Path( const LabyrinthView& l,
+                                                 const Coordinate from,
+                                                 const Coordinate to )
+{
+  return Find( l, nullptr, from, to );
+}
+
+// This method returns a shortest path from one Room to another as
+// above, guided by the landmarks of the index, which must have
+// been built from the Labyrinth with its current Walls.
+// An exception is thrown if:
+//   A Room is outside the Labyrinth (domain_error)
+//   The index was not built from a Labyrinth of the same size
+//     (invalid_argument)
+//   The Labyrinth has 2^32 or more Rooms, or needs as many in
+//     Morton order (domain_error)
+//   There is not enough memory for the search (bad_alloc)
+const std::vector<Coordinate>& PathFinder::Path(
+  const LabyrinthView& l,
+  const LandmarkIndex& landmarks,
+  const Coordinate from,
+  const Coordinate to )
+{
+  if( landmarks.XSize() != l.XSize() || landmarks.YSize() != l.YSize() )
+  {
+    throw std::invalid_argument( "Error: Path() was given a LandmarkIndex "\
+      "which was not built from a Labyrinth of the same size.\n" );
+  }
+  return Find( l, &landmarks, from, to );
+}
+
+// This method returns the number of Rooms expanded by the last
+// search.
+size_t PathFinder::ExpandedCount() const
+{
+  return expanded_count_;
+}
+
+// PRIVATE METHODS:
+
+// This private method checks the Rooms, runs the search guided by
+// the landmarks (if not null), and returns the path.
+const std::vector<Coordinate>& PathFinder::Find(
+  const LabyrinthView& l,
+  const LandmarkIndex* const landmarks,
+  const Coordinate from,
+  const Coordinate to )
+{
+  if( from.x >= l.XSize() || from.y >= l.YSize() ||
+      to.x >= l.XSize() || to.y >= l.YSize() )
+  {
+    throw std::domain_error( "Error: Path() was given a Room which is "\
+      "outside the Labyrinth.\n" );
+  }
+  // Labyrinth sizes have already been checked against overflow
+  else if( l.XSize() * l.YSize() >= kUnreached )
+  {
+    throw std::domain_error( "Error: Path() was given a Labyrinth with "\
+      "2^32 or more Rooms.\n" );
+  }
+  else if( order_ == RoomOrder::kMorton &&
+           MortonLayout(l.XSize(), l.YSize()).Capacity() > kUnreached )
+  {
+    throw std::domain_error( "Error: Path() was given a Labyrinth which "\
+      "needs 2^32 or more Rooms in Morton order.\n" );
+  }
+
+  path_.clear();
+  expanded_count_ = 0;
+  try
+  {
+    Search( l, landmarks, from, to );
+  }
+  catch( ... )
+  {
+    // Leaves every Room unreached for the next search
+    Clear();
+    throw;
+  }
+  Clear();
+  return path_;
+}
+
+// This private method runs the search and fills path_.
+void PathFinder::Search( const LabyrinthView& l,
+                         const LandmarkIndex* const landmarks,
+                         const Coordinate from,
+                         const Coordinate to )
+{
+  if( order_ == RoomOrder::kMorton )
+  {
+    Search( l, landmarks, from, to, MortonLayout(l.XSize(), l.YSize()) );
+  }
+  else
+  {
+    Search( l, landmarks, from, to, RowMajorLayout(l.XSize(), l.YSize()) );
+  }
+}
+
+// This private method runs the search with the given layout of the
+// per-Room arrays.
+//
+// The Walls are read straight from the WallGrid bitmaps, as in
+// DistanceField. Every step costs 1 and changes the Manhattan distance by
+// exactly 1, so a step leaves f (the cost so far plus the distance left)
+// unchanged or raises it by 2. The open list is therefore two stacks, one
+// of Rooms with the least f and one of Rooms with f 2 more, in place of a
+// priority queue: a Room is added or taken in constant time, and Rooms
+// are still taken in order of f, so the first time a Room is taken its
+// cost is final. Entries for a Room which has since been reached more
+// cheaply are skipped. Each stack takes the Room added last first, which
+// follows open corridors without expanding their neighbours.
+//
+// With landmarks, the estimate of the distance left is the greatest of
+// the Manhattan distance and |d(L, room) - d(L, to)| for each landmark L.
+// Rooms alternate like the squares of a chessboard, so every one of these
+// is odd for the Rooms of one colour and even for the other, and each
+// changes by at most 1 in a step; the estimate therefore still changes by
+// exactly 1 in a step, and the two stacks still hold. The landmark
+// distances are always row-major.
+template <typename Layout>
+void PathFinder::Search( const LabyrinthView& l,
+                         const LandmarkIndex* const landmarks,
+                         const Coordinate from,
+                         const Coordinate to,
+                         const Layout& layout )
+{
+  const size_t capacity = layout.Capacity();
+  if( cost_.size() < capacity )
+  {
+    cost_.resize( capacity, kUnreached );
+    parent_.resize( capacity );
+  }
+
+  // The rows of each bitmap follow one another
+  const uint64_t* const east = l.EastRow( 0 );
+  const uint64_t* const south = l.SouthRow( 0 );
+  const size_t words_per_row = l.WordsPerRow();
+
+  // Returns bit x of row y of a bitmap, i.e. whether the Wall exists
+  const auto wall = [words_per_row]( const uint64_t* const bitmap,
+                                     const uint32_t x,
+                                     const uint32_t y )
+  {
+    return ( bitmap[y * words_per_row + x / 64] >> (x % 64) ) & 1;
+  };
+
+  // Row-major Room indices fit in 32 bits, and so do the Coordinates
+  const uint32_t x_size = static_cast<uint32_t>( l.XSize() );
+  const PackedCoordinate from_c( from );
+  const PackedCoordinate to_c( to );
+  const uint32_t to_x = to_c.x;
+  const uint32_t to_y = to_c.y;
+  const uint32_t start =
+    static_cast<uint32_t>( layout.Index(from_c.x, from_c.y) );
+  const uint32_t goal = static_cast<uint32_t>( layout.Index(to_x, to_y) );
+
+  uint32_t* const cost = cost_.data();
+  uint32_t* const parent = parent_.data();
+
+  // The landmark distances of the goal; a landmark which reaches only one
+  // of the two Rooms shows that there is no path
+  const size_t count = landmarks == nullptr ? 0 : landmarks->LandmarkCount();
+  const uint32_t* const bounds =
+    landmarks == nullptr ? nullptr : landmarks->Distances();
+  uint32_t goal_bounds[LandmarkIndex::kMaxLandmarks];
+  const size_t start_row_major = from.y * x_size + from.x;
+  const size_t goal_row_major = to.y * x_size + to.x;
+  for( size_t k = 0; k < count; ++k )
+  {
+    goal_bounds[k] = bounds[goal_row_major * count + k];
+    if( ( bounds[start_row_major * count + k] ==
+          DistanceField::kUnreachable ) !=
+        ( goal_bounds[k] == DistanceField::kUnreachable ) )
+    {
+      return;
+    }
+  }
+
+  // Returns the estimate of the distance left from the Room at (x, y)
+  const auto estimate = [bounds, count, &goal_bounds, x_size, to_x, to_y](
+    const uint32_t x,
+    const uint32_t y )
+  {
+    uint32_t h = ( x > to_x ? x - to_x : to_x - x ) +
+                 ( y > to_y ? y - to_y : to_y - y );
+    const uint32_t* const room_bounds =
+      bounds + ( size_t(y) * x_size + x ) * count;
+    for( size_t k = 0; k < count; ++k )
+    {
+      const uint32_t a = room_bounds[k];
+      const uint32_t b = goal_bounds[k];
+      h = std::max( h, a > b ? a - b : b - a );
+    }
+    return h;
+  };
+
+  // Reaches Room n from Room i at cost g, if that is cheaper. A step
+  // towards the goal keeps f; a step away from it raises f by 2.
+  const auto reach = [this, cost, parent]( const uint32_t n,
+                                           const uint32_t i,
+                                           const uint32_t g,
+                                           const bool towards )
+  {
+    if( g < cost[n] )
+    {
+      if( cost[n] == kUnreached )
+      {
+        touched_.push_back( n );
+      }
+      cost[n] = g;
+      parent[n] = i;
+      ( towards ? open_ : open_next_ ).push_back( OpenRoom{ g, n } );
+    }
+  };
+
+  cost[start] = 0;
+  touched_.push_back( start );
+  open_.push_back( OpenRoom{ 0, start } );
+  while( !open_.empty() || !open_next_.empty() )
+  {
+    if( open_.empty() )
+    {
+      open_.swap( open_next_ );
+    }
+    const OpenRoom top = open_.back();
+    open_.pop_back();
+    if( top.g != cost[top.index] )
+    {
+      continue;
+    }
+
+    const uint32_t i = top.index;
+    if( i == goal )
+    {
+      for( uint32_t r = goal; r != start; r = parent[r] )
+      {
+        path_.push_back( layout.At(r).ToCoordinate() );
+      }
+      path_.push_back( from );
+      std::reverse( path_.begin(), path_.end() );
+      return;
+    }
+
+    ++expanded_count_;
+    const PackedCoordinate c = layout.At( i );
+    const uint32_t x = c.x;
+    const uint32_t y = c.y;
+    const uint32_t g = top.g + 1;
+
+    // Indices of the neighbours fit in 32 bits, as the indices of the
+    // Rooms do
+    const auto east_of = [&layout, i]()
+    {
+      return static_cast<uint32_t>( layout.East(i) );
+    };
+    const auto south_of = [&layout, i]()
+    {
+      return static_cast<uint32_t>( layout.South(i) );
+    };
+    const auto west_of = [&layout, i]()
+    {
+      return static_cast<uint32_t>( layout.West(i) );
+    };
+    const auto north_of = [&layout, i]()
+    {
+      return static_cast<uint32_t>( layout.North(i) );
+    };
+
+    if( bounds != nullptr )
+    {
+      const uint32_t h = estimate( x, y );
+      if( !wall(east, x, y) )
+      {
+        reach( east_of(), i, g, estimate(x + 1, y) < h );
+      }
+      if( !wall(south, x, y) )
+      {
+        reach( south_of(), i, g, estimate(x, y + 1) < h );
+      }
+      if( x > 0 && !wall(east, x - 1, y) )
+      {
+        reach( west_of(), i, g, estimate(x - 1, y) < h );
+      }
+      if( y > 0 && !wall(south, x, y - 1) )
+      {
+        reach( north_of(), i, g, estimate(x, y - 1) < h );
+      }
+      continue;
+    }
+
+    if( !wall(east, x, y) )
+    {
+      reach( east_of(), i, g, x < to_x );
+    }
+    if( !wall(south, x, y) )
+    {
+      reach( south_of(), i, g, y < to_y );
+    }
+    if( x > 0 && !wall(east, x - 1, y) )
+    {
+      reach( west_of(), i, g, x > to_x );
+    }
+    if( y > 0 && !wall(south, x, y - 1) )
+    {
+      reach( north_of(), i, g, y > to_y );
+    }
+  }
+}
+
+// This private method resets the cost of every touched Room and
+// empties the open list.
+void PathFinder::Clear()
+{
+  for( const uint32_t i : touched_ )
+  {
+    cost_[i] = kUnreached;
+  }
+  touched_.clear();
+  open_.clear();
+  open_next_.clear();
+}
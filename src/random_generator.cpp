@@ -0,0 +1,90 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the RandomGenerator class,
+ * the seedable random number generator shared by maze generation,
+ * placement, and respawning.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../include/random_generator.hpp"
+
+// Parameterized constructor
+RandomGenerator::RandomGenerator( const uint64_t seed )
+{
+  uint64_t x = seed;
+  for( size_t i = 0; i < 4; ++i )
+  {
+    state_[i] = SplitMix64( x );
+  }
+}
+
+// This method returns a generator for the stream with the given index,
+// derived from the current state of this generator, which is not
+// changed. Streams with different indices are independent.
+RandomGenerator RandomGenerator::Stream( const uint64_t index ) const
+{
+  // Every word of the state and the index feed the new seed
+  uint64_t x = index;
+  uint64_t seed = SplitMix64( x );
+  for( size_t i = 0; i < 4; ++i )
+  {
+    x = seed ^ state_[i];
+    seed = SplitMix64( x );
+  }
+  return RandomGenerator( seed );
+}
+
+// This method returns a new, independent generator and advances this
+// one.
+RandomGenerator RandomGenerator::Split()
+{
+  return Stream( Next() );
+}
+
+// This method advances the generator by 2^128 numbers, which gives
+// 2^128 non-overlapping sequences of 2^128 numbers each.
+void RandomGenerator::Jump()
+{
+  static const uint64_t kJump[] =
+    { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+      0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+
+  uint64_t jumped[4] = { 0, 0, 0, 0 };
+  for( size_t i = 0; i < 4; ++i )
+  {
+    for( int b = 0; b < 64; ++b )
+    {
+      if( kJump[i] & (uint64_t(1) << b) )
+      {
+        for( size_t j = 0; j < 4; ++j )
+        {
+          jumped[j] ^= state_[j];
+        }
+      }
+      Next();
+    }
+  }
+  for( size_t i = 0; i < 4; ++i )
+  {
+    state_[i] = jumped[i];
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the next number of a SplitMix64
+// sequence, advancing x.
+uint64_t RandomGenerator::SplitMix64( uint64_t& x )
+{
+  x += 0x9E3779B97F4A7C15ULL;
+  uint64_t z = x;
+  z = ( z ^ (z >> 30) ) * 0xBF58476D1CE4E5B9ULL;
+  z = ( z ^ (z >> 27) ) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
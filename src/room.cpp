@@ -1,22 +1,46 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-01-25
+ * Last edited: 2026-10-18
  *
  * This program contains implementations of a Room class, which is a template
  * to create a Labyrinth.
  *
  */
 
+#include <cstdint>
 #include <iostream>
 #include <stdexcept>
 
 #include "../include/room_properties.hpp"
 #include "../include/room.hpp"
 
+namespace
+{
+
+// Field positions and masks of the packed Room word
+const uint16_t kInhabitantShift = 0;
+const uint16_t kInhabitantMask  = 0x7 << kInhabitantShift;
+const uint16_t kItemShift       = 3;
+const uint16_t kItemMask        = 0x3 << kItemShift;
+const uint16_t kExitShift       = 5;
+const uint16_t kExitMask        = 0x7 << kExitShift;
+const uint16_t kWallNorth       = 1 << 8;
+const uint16_t kWallEast        = 1 << 9;
+const uint16_t kWallSouth       = 1 << 10;
+const uint16_t kWallWest        = 1 << 11;
+const uint16_t kWallsAll        = kWallNorth | kWallEast |
+                                  kWallSouth | kWallWest;
+
+}  // Anonymous namespace
+
+static_assert( sizeof(Room) == sizeof(uint16_t),
+               "Room should be packed into a single 16-bit word." );
+
 // Default constructor
 // This constructor sets a basic, walled, empty Room.
-Room::Room()
+Room::Room() :
+  bits_(kWallsAll)
 {
 }
 
@@ -28,40 +52,44 @@ Room::Room( const Inhabitant dark_thing,
             const bool wall_north,
             const bool wall_east,
             const bool wall_south,
-            const bool wall_west )
+            const bool wall_west ) :
+  bits_(0)
 {
-  dark_thing_ = dark_thing;
-  object_     = object;
-  exit_       = exit;
-  wall_north_ = wall_north;
-  wall_east_  = wall_east;
-  wall_south_ = wall_south;
-  wall_west_  = wall_west;
+  SetInhabitant(dark_thing);
+  SetItem(object);
+  bits_ |= static_cast<uint16_t>(exit) << kExitShift;
+  if( wall_north ) bits_ |= kWallNorth;
+  if( wall_east )  bits_ |= kWallEast;
+  if( wall_south ) bits_ |= kWallSouth;
+  if( wall_west )  bits_ |= kWallWest;
 }
 
 // This method returns the current inhabitant of the Room.
 Inhabitant Room::GetInhabitant() const
 {
-  return dark_thing_;
+  return static_cast<Inhabitant>( (bits_ & kInhabitantMask) >>
+                                  kInhabitantShift );
 }
 
 // This method changes the current inhabitant of the Room.
 void Room::SetInhabitant( const Inhabitant inh )
 {
-  dark_thing_ = inh;
+  bits_ = (bits_ & ~kInhabitantMask) |
+          ( static_cast<uint16_t>(inh) << kInhabitantShift );
   return;
 }
 
 // This method returns the current item in the Room.
 Item Room::GetItem() const
 {
-  return object_;
+  return static_cast<Item>( (bits_ & kItemMask) >> kItemShift );
 }
 
 // This method changes the current item in the Room.
 void Room::SetItem( const Item itm )
 {
-  object_ = itm;
+  bits_ = (bits_ & ~kItemMask) |
+          ( static_cast<uint16_t>(itm) << kItemShift );
   return;
 }
 
@@ -72,48 +100,18 @@ void Room::SetItem( const Item itm )
 //   The Wall has already been removed (logic_error)
 void Room::BreakWall( const Direction d )
 {
-  switch( d )
+  if( d == Direction::kNone )
   {
-    case( Direction::kNone ):
-      throw std::invalid_argument( "Error: BreakWall() was given an "\
-        "invalid Direction (kNone).\n");
-
-    case( Direction::kNorth ):
-      if( !wall_north_ )  // Wall already removed
-      {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
-      }
-      wall_north_ = false;
-      break;
-
-    case( Direction::kEast ):
-      if( !wall_east_ )
-      {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
-      }
-      wall_east_ = false;
-      break;
-
-    case( Direction::kSouth ):
-      if( !wall_south_ )
-      {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
-      }
-      wall_south_ = false;
-      break;
-
-    case( Direction::kWest ):
-      if( !wall_west_ )
-      {
-        throw std::logic_error( "Error: BreakWall() was given an "\
-          "already-removed Wall.\n" );
-      }
-      wall_west_ = false;
-      break;
+    throw std::invalid_argument( "Error: BreakWall() was given an "\
+      "invalid Direction (kNone).\n");
   }
+  else if( !(bits_ & WallBit(d)) )  // Wall already removed
+  {
+    throw std::logic_error( "Error: BreakWall() was given an "\
+      "already-removed Wall.\n" );
+  }
+
+  bits_ &= ~WallBit(d);
   return;
 }
 
@@ -135,7 +133,7 @@ void Room::CreateExit( const Direction d )
     throw std::logic_error( "Error: CreateExit() was given a Wall "\
       "which has already been broken." );
   }
-  else if( exit_ != Direction::kNone )
+  else if( Exit() != Direction::kNone )
   {
     throw std::logic_error( "Error: CreateExit() was given a Room "\
       "which already has an exit.\n" );
@@ -150,7 +148,7 @@ void Room::CreateExit( const Direction d )
     std::cout << e.what();
     return;
   }
-  exit_ = d;
+  bits_ |= static_cast<uint16_t>(d) << kExitShift;
 }
 
 // This method returns:
@@ -167,15 +165,12 @@ RoomBorder Room::DirectionCheck( const Direction d ) const
       "direction kNone.\n" ) ;
   }
 
-  if( d == exit_ )
+  if( d == Exit() )
   {
     return RoomBorder::kExit;
   }
 
-  else if( ( d == Direction::kNorth && !(wall_north_) ) ||
-           ( d == Direction::kEast  && !(wall_east_)  ) ||
-           ( d == Direction::kSouth && !(wall_south_) ) ||
-           ( d == Direction::kWest  && !(wall_west_)  ) )
+  else if( !(bits_ & WallBit(d)) )
   {
     return RoomBorder::kRoom;
   }
@@ -185,3 +180,31 @@ RoomBorder Room::DirectionCheck( const Direction d ) const
     return RoomBorder::kWall;
   }
 }
+
+// PRIVATE METHODS:
+
+// This private method returns the bit of bits_ which stores the Wall
+// in the given direction, or 0 if d is kNone.
+uint16_t Room::WallBit( const Direction d )
+{
+  switch( d )
+  {
+    case Direction::kNorth:
+      return kWallNorth;
+    case Direction::kEast:
+      return kWallEast;
+    case Direction::kSouth:
+      return kWallSouth;
+    case Direction::kWest:
+      return kWallWest;
+    default:
+      return 0;
+  }
+}
+
+// This private method returns the Direction of the exit, or kNone if
+// the Room has no exit.
+Direction Room::Exit() const
+{
+  return static_cast<Direction>( (bits_ & kExitMask) >> kExitShift );
+}
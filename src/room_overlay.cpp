@@ -0,0 +1,230 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the RoomOverlay class,
+ * which holds the Rooms that one game has changed on top of a shared
+ * LevelTopology.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room_cell.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_status.hpp"
+#include "../include/level_topology.hpp"
+#include "../include/room_overlay.hpp"
+
+// CONSTRUCTOR/DESTRUCTOR:
+
+// Parameterized constructor
+// The overlay begins with no changed Rooms.
+// An exception is thrown if:
+//   The topology is null (invalid_argument)
+RoomOverlay::RoomOverlay( std::shared_ptr<const LevelTopology> topology ) :
+  topology_(std::move(topology))
+{
+  if( topology_ == nullptr )
+  {
+    throw std::invalid_argument( "Error: RoomOverlay() was given a null "\
+      "LevelTopology.\n" );
+  }
+  treasure_set_ = topology_->HasTreasure();
+}
+
+// PLAY:
+
+// This method returns the current Inhabitant of the Room.
+// An exception is thrown if:
+//   The Room is outside the level (domain_error)
+Inhabitant RoomOverlay::GetInhabitant( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: GetInhabitant() was given a "\
+      "Coordinate outside of the level.\n" );
+  }
+  return GetInhabitantUnchecked( rm );
+}
+
+// This method returns the current Item in the given Room, but does
+// not change it.
+// An exception is thrown if:
+//   The Room is outside the level (domain_error)
+Item RoomOverlay::ItemAt( const Coordinate rm ) const
+{
+  if( !WithinBounds(rm) )
+  {
+    throw std::domain_error( "Error: ItemAt() was given a Coordinate "\
+      "outside of the level.\n" );
+  }
+  return ItemAtUnchecked( rm );
+}
+
+// This method drops the Treasure in the given Room.
+// Returns kOutOfBounds or kTreasureAlreadySet upon failure.
+LabyrinthStatus RoomOverlay::TryDropTreasure( const Coordinate rm )
+{
+  if( !WithinBounds(rm) )
+  {
+    return LabyrinthStatus::kOutOfBounds;
+  }
+  else if( treasure_set_ )
+  {
+    return LabyrinthStatus::kTreasureAlreadySet;
+  }
+
+  WritableCellAt(rm).SetItem(Item::kTreasure);
+  treasure_set_ = true;
+  return LabyrinthStatus::kOk;
+}
+
+// This method discards every change, so that the overlay can be
+// reused for a new game of the same level without allocating.
+void RoomOverlay::Clear()
+{
+  changed_.clear();
+  changed_bits_ = 0;
+  treasure_set_ = topology_->HasTreasure();
+}
+
+// STATE:
+
+// This method returns the shared level.
+const LevelTopology& RoomOverlay::Topology() const
+{
+  return *topology_;
+}
+
+// This method returns the number of Rooms which have been changed.
+size_t RoomOverlay::ChangedRoomCount() const
+{
+  return changed_.size();
+}
+
+// This method returns the number of bytes held by the overlay,
+// including the storage of its changed Rooms.
+size_t RoomOverlay::ByteSize() const
+{
+  return sizeof(RoomOverlay) + changed_.capacity() * sizeof(ChangedRoom);
+}
+
+// UNCHECKED:
+
+Inhabitant RoomOverlay::GetInhabitantUnchecked( const Coordinate rm ) const
+{
+  return CellAt(rm).GetInhabitant();
+}
+
+Item RoomOverlay::ItemAtUnchecked( const Coordinate rm ) const
+{
+  return CellAt(rm).GetItem();
+}
+
+// Direction d must not be kNone.
+RoomBorder RoomOverlay::DirectionCheckUnchecked( const Coordinate rm,
+                                                 const Direction d ) const
+{
+  return topology_->DirectionCheckUnchecked( rm, d );
+}
+
+// Returns kNoEnemy upon failure.
+LabyrinthStatus RoomOverlay::AttackEnemyUnchecked( const Coordinate rm )
+{
+  switch( CellAt(rm).GetInhabitant() )
+  {
+    case Inhabitant::kMinotaur:
+      WritableCellAt(rm).SetInhabitant(Inhabitant::kMinotaurDead);
+      return LabyrinthStatus::kOk;
+
+    case Inhabitant::kMirror:
+      WritableCellAt(rm).SetInhabitant(Inhabitant::kMirrorCracked);
+      return LabyrinthStatus::kOk;
+
+    default:
+      return LabyrinthStatus::kNoEnemy;
+  }
+}
+
+// Returns kNoItem upon failure.
+LabyrinthStatus RoomOverlay::TakeItemUnchecked( const Coordinate rm )
+{
+  switch( CellAt(rm).GetItem() )
+  {
+    case Item::kBullet:
+      WritableCellAt(rm).SetItem(Item::kNone);
+      return LabyrinthStatus::kOk;
+
+    case Item::kTreasure:
+      WritableCellAt(rm).SetItem(Item::kTreasureGone);
+      treasure_set_ = false;
+      return LabyrinthStatus::kOk;
+
+    default:
+      return LabyrinthStatus::kNoItem;
+  }
+}
+
+// PRIVATE METHODS:
+
+// This private method returns true if the Room is within the level,
+// and false otherwise.
+bool RoomOverlay::WithinBounds( const Coordinate rm ) const
+{
+  return rm.x < topology_->XSize() && rm.y < topology_->YSize();
+}
+
+// This private method returns the current contents of the Room.
+// Bounds are not checked.
+RoomCell RoomOverlay::CellAt( const Coordinate rm ) const
+{
+  const size_t index = topology_->IndexOf( rm );
+  if( ( changed_bits_ & ChangedBit(index) ) == 0 )
+  {
+    return topology_->CellAt( index );
+  }
+
+  const auto it = std::lower_bound(
+    changed_.begin(), changed_.end(), index,
+    []( const ChangedRoom& c, const size_t i ) { return c.index < i; } );
+  if( it != changed_.end() && it->index == index )
+  {
+    return it->cell;
+  }
+  return topology_->CellAt( index );
+}
+
+// This private method returns the contents of the Room in the
+// overlay, copying the Room into it first if it has not changed yet.
+// Bounds are not checked.
+// An exception is thrown if:
+//   There is not enough memory for the Room (bad_alloc)
+RoomCell& RoomOverlay::WritableCellAt( const Coordinate rm )
+{
+  const size_t index = topology_->IndexOf( rm );
+  auto it = std::lower_bound(
+    changed_.begin(), changed_.end(), index,
+    []( const ChangedRoom& c, const size_t i ) { return c.index < i; } );
+  if( it == changed_.end() || it->index != index )
+  {
+    it = changed_.insert( it, ChangedRoom{ index, topology_->CellAt(index) } );
+    changed_bits_ |= ChangedBit( index );
+  }
+  return it->cell;
+}
+
+// This private method returns the bit of changed_bits_ for the Room at
+// the given row-major index.
+uint64_t RoomOverlay::ChangedBit( const size_t index )
+{
+  return uint64_t(1) << ( index % 64 );
+}
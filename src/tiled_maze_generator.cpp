@@ -0,0 +1,230 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the TiledMazeGenerator
+ * class, which generates a maze in tiles on several threads and stitches
+ * the tiles together.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/tiled_maze_generator.hpp"
+
+// Parameterized constructor
+// A thread count of 0 uses one thread per hardware thread.
+// An exception is thrown if:
+//   A tile size of 0 is given (domain_error)
+//   The tile x size is not a multiple of 64 (invalid_argument)
+TiledMazeGenerator::TiledMazeGenerator( const MazeAlgorithm algorithm,
+                                        const size_t tile_x_size,
+                                        const size_t tile_y_size,
+                                        const uint64_t seed,
+                                        const size_t thread_count ) :
+  algorithm_(algorithm),
+  tile_x_size_(tile_x_size),
+  tile_y_size_(tile_y_size),
+  thread_count_(thread_count != 0 ?
+                thread_count :
+                std::max( 1u, std::thread::hardware_concurrency() )),
+  rng_(seed)
+{
+  if( tile_x_size == 0 || tile_y_size == 0 )
+  {
+    throw std::domain_error( "Error: TiledMazeGenerator() was given an "\
+      "empty tile size.\n" );
+  }
+  else if( tile_x_size % 64 != 0 )
+  {
+    throw std::invalid_argument( "Error: TiledMazeGenerator() was given a "\
+      "tile x size which is not a multiple of 64.\n" );
+  }
+}
+
+// This method carves a maze into the Labyrinth.
+// The Labyrinth should have every interior Wall intact (as it is when
+// constructed) and no exit; Walls which cannot be broken are skipped,
+// in which case the maze will not be perfect.
+// An exception is thrown if:
+//   The algorithm is not a valid MazeAlgorithm (invalid_argument)
+//   There is not enough memory for the working state (bad_alloc)
+//   A thread cannot be started (system_error)
+void TiledMazeGenerator::Generate( Labyrinth& l )
+{
+  const size_t tiles_x = ( l.XSize() + tile_x_size_ - 1 ) / tile_x_size_;
+  const size_t tiles_y = ( l.YSize() + tile_y_size_ - 1 ) / tile_y_size_;
+  const size_t tile_count = tiles_x * tiles_y;
+  const RandomGenerator tile_streams = rng_.Split();
+
+  // Each thread takes the next tile until none are left; the first
+  // exception thrown stops every thread and is rethrown here.
+  std::atomic<size_t> next_tile( 0 );
+  std::atomic<bool> failed( false );
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  const auto work = [&]()
+  {
+    try
+    {
+      for( size_t tile = next_tile++;
+           tile < tile_count && !failed;
+           tile = next_tile++ )
+      {
+        GenerateTile( l,
+                      ( tile % tiles_x ) * tile_x_size_,
+                      ( tile / tiles_x ) * tile_y_size_,
+                      tile_streams.Stream( tile ) );
+      }
+    }
+    catch( ... )
+    {
+      std::lock_guard<std::mutex> lock( error_mutex );
+      if( !error )
+      {
+        error = std::current_exception();
+      }
+      failed = true;
+    }
+  };
+
+  // The calling thread works as well
+  std::vector<std::thread> threads;
+  const size_t extra_threads = std::min( thread_count_, tile_count ) - 1;
+  try
+  {
+    for( size_t i = 0; i < extra_threads; ++i )
+    {
+      threads.emplace_back( work );
+    }
+  }
+  catch( ... )
+  {
+    failed = true;
+    for( std::thread& t : threads )
+    {
+      t.join();
+    }
+    throw;
+  }
+  work();
+  for( std::thread& t : threads )
+  {
+    t.join();
+  }
+  if( error )
+  {
+    std::rethrow_exception( error );
+  }
+
+  StitchTiles( l );
+}
+
+// This method returns the number of threads used by Generate().
+size_t TiledMazeGenerator::ThreadCount() const
+{
+  return thread_count_;
+}
+
+// PRIVATE METHODS:
+
+// This private method carves a maze into one tile of the Labyrinth,
+// whose top left Room is (x_start, y_start).
+void TiledMazeGenerator::GenerateTile( Labyrinth& l,
+                                       const size_t x_start,
+                                       const size_t y_start,
+                                       const RandomGenerator& rng ) const
+{
+  MazeGenerator g( algorithm_, rng );
+  g.GenerateRegion( l,
+                    Coordinate(x_start, y_start),
+                    std::min( tile_x_size_, l.XSize() - x_start ),
+                    std::min( tile_y_size_, l.YSize() - y_start ) );
+}
+
+// This private method joins the tiles of the Labyrinth with one
+// broken Wall along each boundary of a random spanning tree of the
+// tiles.
+void TiledMazeGenerator::StitchTiles( Labyrinth& l )
+{
+  const size_t tiles_x = ( l.XSize() + tile_x_size_ - 1 ) / tile_x_size_;
+  const size_t tiles_y = ( l.YSize() + tile_y_size_ - 1 ) / tile_y_size_;
+  const size_t tile_count = tiles_x * tiles_y;
+
+  // Each boundary is stored as (tile * 2) for the boundary to the east of
+  // the tile, or (tile * 2 + 1) for the boundary to the south.
+  std::vector<size_t> boundaries;
+  for( size_t tile = 0; tile < tile_count; ++tile )
+  {
+    if( tile % tiles_x != tiles_x - 1 )
+    {
+      boundaries.push_back( tile * 2 );
+    }
+    if( tile / tiles_x != tiles_y - 1 )
+    {
+      boundaries.push_back( tile * 2 + 1 );
+    }
+  }
+
+  std::vector<size_t> parent( tile_count );
+  std::iota( parent.begin(), parent.end(), size_t(0) );
+  const auto find = [&parent]( size_t tile )
+  {
+    while( parent[tile] != tile )
+    {
+      parent[tile] = parent[parent[tile]];
+      tile = parent[tile];
+    }
+    return tile;
+  };
+
+  for( size_t i = 0; i < boundaries.size(); ++i )
+  {
+    std::swap( boundaries[i],
+               boundaries[i + rng_.Below( boundaries.size() - i )] );
+    const size_t tile_1 = boundaries[i] / 2;
+    const bool east = ( boundaries[i] % 2 == 0 );
+    const size_t tile_2 = east ? tile_1 + 1 : tile_1 + tiles_x;
+
+    const size_t set_1 = find( tile_1 );
+    const size_t set_2 = find( tile_2 );
+    if( set_1 == set_2 )
+    {
+      continue;
+    }
+    parent[set_2] = set_1;
+
+    // Break one random Wall along the boundary
+    const size_t x_start = ( tile_1 % tiles_x ) * tile_x_size_;
+    const size_t y_start = ( tile_1 / tiles_x ) * tile_y_size_;
+    if( east )
+    {
+      const size_t length = std::min( tile_y_size_, l.YSize() - y_start );
+      const Coordinate rm( x_start + tile_x_size_ - 1,
+                           y_start + rng_.Below( length ) );
+      (void)( l.TryConnectRooms( rm, Coordinate(rm.x + 1, rm.y) ) );
+    }
+    else
+    {
+      const size_t length = std::min( tile_x_size_, l.XSize() - x_start );
+      const Coordinate rm( x_start + rng_.Below( length ),
+                           y_start + tile_y_size_ - 1 );
+      (void)( l.TryConnectRooms( rm, Coordinate(rm.x, rm.y + 1) ) );
+    }
+  }
+}
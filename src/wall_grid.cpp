@@ -0,0 +1,231 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file contains the implementation of the WallGrid class, which
+ * stores every Wall of a Labyrinth exactly once as two bitmaps.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+
+// Parameterized constructor
+// Every Wall of the grid exists initially.
+// An exception is thrown if:
+//   A size of 0 is given (domain_error)
+WallGrid::WallGrid( const size_t x_size, const size_t y_size ) :
+  x_size_(x_size),
+  y_size_(y_size),
+  words_per_row_(WordsPerRow(x_size))
+{
+  if( x_size == 0 || y_size == 0 )
+  {
+    throw std::domain_error( "Error: WallGrid() was given an empty "\
+      "size.\n" );
+  }
+
+  const size_t words = words_per_row_ * y_size_;
+  east_  = std::make_unique<uint64_t[]>(words);
+  south_ = std::make_unique<uint64_t[]>(words);
+  for( size_t i = 0; i < words; ++i )
+  {
+    east_[i]  = ~uint64_t(0);
+    south_[i] = ~uint64_t(0);
+  }
+}
+
+// This method returns true if the Room has a Wall in the given
+// direction, and false if it opens onto another Room.
+// Bounds are not checked; the Room must be within the grid.
+// An exception is thrown if:
+//   Direction d is kNone (invalid_argument)
+bool WallGrid::IsWall( const Coordinate rm, const Direction d ) const
+{
+  switch( d )
+  {
+    case Direction::kNorth:
+      return rm.y == 0 || GetBit( south_.get(), rm.x, rm.y - 1 );
+    case Direction::kEast:
+      return GetBit( east_.get(), rm.x, rm.y );
+    case Direction::kSouth:
+      return GetBit( south_.get(), rm.x, rm.y );
+    case Direction::kWest:
+      return rm.x == 0 || GetBit( east_.get(), rm.x - 1, rm.y );
+    default:
+      throw std::invalid_argument( "Error: IsWall() was given an invalid "\
+        "direction (kNone).\n" );
+  }
+}
+
+// This method sets whether the Wall of the Room in the given direction
+// exists. The neighbouring Room shares the same Wall.
+// Bounds are not checked; the Room must be within the grid.
+// An exception is thrown if:
+//   Direction d is kNone (invalid_argument)
+//   The Wall is on the outside of the grid and exists is false
+//     (logic_error)
+void WallGrid::SetWall( const Coordinate rm,
+                        const Direction d,
+                        const bool exists )
+{
+  if( d == Direction::kNone )
+  {
+    throw std::invalid_argument( "Error: SetWall() was given an invalid "\
+      "direction (kNone).\n" );
+  }
+
+  const bool outside =
+    ( d == Direction::kNorth && rm.y == 0 ) ||
+    ( d == Direction::kEast  && rm.x == x_size_ - 1 ) ||
+    ( d == Direction::kSouth && rm.y == y_size_ - 1 ) ||
+    ( d == Direction::kWest  && rm.x == 0 );
+  if( outside )
+  {
+    if( !exists )
+    {
+      throw std::logic_error( "Error: SetWall() cannot remove a Wall on "\
+        "the outside of the grid.\n" );
+    }
+    return;
+  }
+
+  switch( d )
+  {
+    case Direction::kNorth:
+      SetBit( south_.get(), rm.x, rm.y - 1, exists );
+      break;
+    case Direction::kEast:
+      SetBit( east_.get(), rm.x, rm.y, exists );
+      break;
+    case Direction::kSouth:
+      SetBit( south_.get(), rm.x, rm.y, exists );
+      break;
+    case Direction::kWest:
+      SetBit( east_.get(), rm.x - 1, rm.y, exists );
+      break;
+    default:
+      break;
+  }
+}
+
+// This method replaces every Wall of the grid with the given bitmaps,
+// which must use the row layout of the grid (WordsPerRow() words per
+// row, y_size rows). Padding bits are ignored.
+// An exception is thrown if:
+//   A Wall on the outside of the grid is missing (invalid_argument)
+void WallGrid::Assign( const uint64_t* const east,
+                       const uint64_t* const south )
+{
+  const size_t last = words_per_row_ - 1;
+  const uint64_t padding = PaddingMask();
+  const uint64_t last_room = uint64_t(1) << ((x_size_ - 1) % 64);
+
+  // Everything is validated before copying so that the grid is unchanged
+  // upon failure.
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    if( !(east[y * words_per_row_ + last] & last_room) )
+    {
+      throw std::invalid_argument( "Error: Assign() was given an east "\
+        "bitmap missing a Wall on the outside of the grid.\n" );
+    }
+  }
+  const uint64_t* const south_last_row =
+    south + (y_size_ - 1) * words_per_row_;
+  for( size_t i = 0; i < words_per_row_; ++i )
+  {
+    const uint64_t word = ( i == last ) ? south_last_row[i] | padding
+                                        : south_last_row[i];
+    if( word != ~uint64_t(0) )
+    {
+      throw std::invalid_argument( "Error: Assign() was given a south "\
+        "bitmap missing a Wall on the outside of the grid.\n" );
+    }
+  }
+
+  const size_t words = words_per_row_ * y_size_;
+  for( size_t i = 0; i < words; ++i )
+  {
+    east_[i]  = east[i];
+    south_[i] = south[i];
+  }
+  for( size_t y = 0; y < y_size_; ++y )
+  {
+    east_[y * words_per_row_ + last]  |= padding;
+    south_[y * words_per_row_ + last] |= padding;
+  }
+}
+
+// This method returns the number of 64-bit words in each bitmap row.
+size_t WallGrid::WordsPerRow() const
+{
+  return words_per_row_;
+}
+
+// This method returns the number of 64-bit words in each bitmap row of
+// a grid with the given x size.
+size_t WallGrid::WordsPerRow( const size_t x_size )
+{
+  return x_size / 64 + (x_size % 64 != 0);
+}
+
+// This method returns the first word of row y of the east bitmap.
+// Bounds are not checked; y must be less than the y size.
+const uint64_t* WallGrid::EastRow( const size_t y ) const
+{
+  return east_.get() + y * words_per_row_;
+}
+
+// This method returns the first word of row y of the south bitmap.
+// Bounds are not checked; y must be less than the y size.
+const uint64_t* WallGrid::SouthRow( const size_t y ) const
+{
+  return south_.get() + y * words_per_row_;
+}
+
+// PRIVATE METHODS:
+
+// This private method returns the mask of the padding bits in the last
+// word of each row.
+uint64_t WallGrid::PaddingMask() const
+{
+  if( x_size_ % 64 == 0 )
+  {
+    return 0;
+  }
+  return ~uint64_t(0) << (x_size_ % 64);
+}
+
+// This private method sets or clears bit x of row y of the bitmap.
+void WallGrid::SetBit( uint64_t* const bitmap,
+                       const size_t x,
+                       const size_t y,
+                       const bool value )
+{
+  uint64_t& word = bitmap[y * words_per_row_ + x / 64];
+  const uint64_t mask = uint64_t(1) << (x % 64);
+  if( value )
+  {
+    word |= mask;
+  }
+  else
+  {
+    word &= ~mask;
+  }
+}
+
+// This private method returns bit x of row y of the bitmap.
+bool WallGrid::GetBit( const uint64_t* const bitmap,
+                       const size_t x,
+                       const size_t y ) const
+{
+  return ( bitmap[y * words_per_row_ + x / 64] >> (x % 64) ) & 1;
+}
@@ -0,0 +1,155 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks structural audits with the LabyrinthAudit
+ * class on an increasing number of threads, both of a Labyrinth and of
+ * the same maze as a grid of packed Rooms (4,096 x 4,096 Rooms by
+ * default).
+ *
+ * Usage: ./output [x_size y_size]
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/tiled_maze_generator.hpp"
+#include "../include/labyrinth_audit.hpp"
+
+namespace
+{
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 4096;
+  size_t y_size = 4096;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+  const double rooms = static_cast<double>(x_size) * y_size;
+
+  std::cout << std::endl
+            << "BENCHMARKING STRUCTURAL AUDITS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "Auditing a " << x_size << " x " << y_size << " maze ("
+            << rooms << " Rooms) with a broken Wall in every 4,096 "
+            << "packed Rooms; " << std::thread::hardware_concurrency()
+            << " hardware threads." << std::endl;
+
+  try
+  {
+    Labyrinth l( x_size, y_size );
+    TiledMazeGenerator g( MazeAlgorithm::kRecursiveBacktracker,
+                          256, 256, 1 );
+    g.Generate( l );
+    l.SetExit( Coordinate(x_size - 1, 0), Direction::kEast );
+    l.SetItem( Coordinate(x_size / 2, y_size / 2), Item::kTreasure );
+
+    // The same maze with each Wall stored on both of its sides, as a
+    // loader of per-Room data would hold it
+    std::vector<Room> grid;
+    grid.reserve( x_size * y_size );
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x < x_size; ++x )
+      {
+        const Coordinate c( x, y );
+        const auto wall = [&l, c]( const Direction d )
+        {
+          return l.DirectionCheckUnchecked( c, d ) != RoomBorder::kRoom;
+        };
+        const bool exit = l.DirectionCheckUnchecked(c, Direction::kEast) ==
+                          RoomBorder::kExit;
+        grid.push_back( Room(l.GetInhabitantUnchecked(c),
+                             l.ItemAtUnchecked(c),
+                             exit ? Direction::kEast : Direction::kNone,
+                             wall(Direction::kNorth),
+                             wall(Direction::kEast) && !exit,
+                             wall(Direction::kSouth),
+                             wall(Direction::kWest)) );
+      }
+    }
+    size_t corrupted = 0;
+    for( size_t i = 0; i < grid.size(); i += 4096 )
+    {
+      if( grid[i].DirectionCheck(Direction::kSouth) == RoomBorder::kWall )
+      {
+        grid[i].BreakWall( Direction::kSouth );
+        ++corrupted;
+      }
+    }
+
+    size_t first_count = 0;
+    for( size_t threads = 1; threads <= 8; threads *= 2 )
+    {
+      LabyrinthAudit a( threads );
+      auto start = std::chrono::steady_clock::now();
+      const size_t labyrinth_count = a.Audit( l ).size();
+      const double labyrinth_seconds = SecondsSince( start );
+
+      start = std::chrono::steady_clock::now();
+      const size_t grid_count = a.Audit( grid.data(), x_size, y_size ).size();
+      const double grid_seconds = SecondsSince( start );
+      if( threads == 1 )
+      {
+        first_count = grid_count;
+      }
+
+      std::cout << "  " << threads << " thread(s):" << std::endl
+                << "    Labyrinth:    " << labyrinth_seconds * 1e3 << " ms ("
+                << rooms / labyrinth_seconds / 1e6 << " million Rooms/s), "
+                << labyrinth_count << " violations" << std::endl
+                << "    Packed Rooms: " << grid_seconds * 1e3 << " ms ("
+                << rooms / grid_seconds / 1e6 << " million Rooms/s), "
+                << grid_count << " violations of " << corrupted
+                << " corrupted Rooms" << std::endl;
+      if( grid_count != first_count || labyrinth_count != 0 )
+      {
+        std::cout << "Error: The audit depends on the thread count."
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
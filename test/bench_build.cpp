@@ -0,0 +1,269 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks building and populating a Labyrinth one call at
+ * a time against doing so in bulk with a LabyrinthLayout and Populate().
+ *
+ * Usage: ./output [x_size y_size]
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth_layout.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/labyrinth.hpp"
+
+namespace
+{
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start );
+
+// These local functions return the contents placed in the Room with the
+// given index by both benchmarks.
+Inhabitant InhabitantFor( const size_t i );
+Item ItemFor( const size_t i );
+
+// This local function places the population into an empty Labyrinth of
+// the given size with random Rooms retried while occupied, and into
+// another with Populate(), and prints the time taken by each.
+void BenchmarkPlacement( const size_t x_size,
+                         const size_t y_size,
+                         const LabyrinthPopulation& population );
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// This local function returns the Inhabitant placed in the Room with the
+// given index by both benchmarks.
+Inhabitant InhabitantFor( const size_t i )
+{
+  if( i % 17 == 0 )
+  {
+    return Inhabitant::kMinotaur;
+  }
+  else if( i % 23 == 0 )
+  {
+    return Inhabitant::kMirror;
+  }
+  return Inhabitant::kNone;
+}
+
+// This local function returns the Item placed in the Room with the given
+// index by both benchmarks.
+Item ItemFor( const size_t i )
+{
+  if( i == 1 )
+  {
+    return Item::kTreasure;
+  }
+  else if( i % 11 == 0 )
+  {
+    return Item::kBullet;
+  }
+  return Item::kNone;
+}
+
+// This local function places the population into an empty Labyrinth of
+// the given size with random Rooms retried while occupied, and into
+// another with Populate(), and prints the time taken by each.
+void BenchmarkPlacement( const size_t x_size,
+                         const size_t y_size,
+                         const LabyrinthPopulation& population )
+{
+  std::cout << std::endl
+            << "Placing " << population.minotaurs << " Minotaurs, "
+            << population.mirrors << " Mirrors, " << population.bullets
+            << " Bullets, and the Treasure:" << std::endl;
+
+  // Random Rooms, retried while occupied
+  Labyrinth l_retry( x_size, y_size );
+  RandomGenerator rng( 1 );
+  size_t attempts = 0;
+  auto start = std::chrono::steady_clock::now();
+  const auto place_inhabitants = [&]( const size_t count,
+                                      const Inhabitant inh )
+  {
+    for( size_t placed = 0; placed < count; ++attempts )
+    {
+      const Coordinate c( rng.Below(x_size), rng.Below(y_size) );
+      placed += l_retry.TrySetInhabitant( c, inh ) == LabyrinthStatus::kOk;
+    }
+  };
+  const auto place_items = [&]( const size_t count, const Item itm )
+  {
+    for( size_t placed = 0; placed < count; ++attempts )
+    {
+      const Coordinate c( rng.Below(x_size), rng.Below(y_size) );
+      placed += l_retry.TrySetItem( c, itm ) == LabyrinthStatus::kOk;
+    }
+  };
+  place_inhabitants( population.minotaurs, Inhabitant::kMinotaur );
+  place_inhabitants( population.mirrors, Inhabitant::kMirror );
+  place_items( population.bullets, Item::kBullet );
+  place_items( population.treasure, Item::kTreasure );
+  std::cout << "  TrySetInhabitant()/TrySetItem() with retries: "
+            << MillisecondsSince(start) << " ms (" << attempts
+            << " attempts)" << std::endl;
+
+  Labyrinth l_populated( x_size, y_size );
+  start = std::chrono::steady_clock::now();
+  l_populated.Populate( population, rng );
+  std::cout << "  Populate():                                   "
+            << MillisecondsSince(start) << " ms" << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 1000;
+  size_t y_size = 1000;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING LABYRINTH CONSTRUCTION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Building a " << x_size << " x " << y_size
+            << " Labyrinth (rows joined down the west column):"
+            << std::endl;
+
+  try
+  {
+    // One call per opening and per entity
+    auto start = std::chrono::steady_clock::now();
+    Labyrinth l_calls( x_size, y_size );
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x < x_size; ++x )
+      {
+        const Coordinate c(x, y);
+        if( x + 1 < x_size )
+        {
+          l_calls.ConnectRooms( c, Coordinate(x + 1, y) );
+        }
+        if( x == 0 && y + 1 < y_size )
+        {
+          l_calls.ConnectRooms( c, Coordinate(x, y + 1) );
+        }
+
+        const size_t i = y * x_size + x;
+        if( InhabitantFor(i) != Inhabitant::kNone )
+        {
+          l_calls.SetInhabitant( c, InhabitantFor(i) );
+        }
+        if( ItemFor(i) != Item::kNone )
+        {
+          l_calls.SetItem( c, ItemFor(i) );
+        }
+      }
+    }
+    std::cout << "  ConnectRooms()/SetInhabitant()/SetItem(): "
+              << MillisecondsSince(start) << " ms" << std::endl;
+
+    // The same level as a layout
+    start = std::chrono::steady_clock::now();
+    LabyrinthLayout layout;
+    layout.x_size = x_size;
+    layout.y_size = y_size;
+    const size_t words = WallGrid::WordsPerRow(x_size) * y_size;
+    layout.east_walls.assign( words, 0 );
+    layout.south_walls.assign( words, ~uint64_t(0) );
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      uint64_t* const east = &layout.east_walls[y * (words / y_size)];
+      east[(x_size - 1) / 64] |= uint64_t(1) << ((x_size - 1) % 64);
+      if( y + 1 < y_size )
+      {
+        layout.south_walls[y * (words / y_size)] &= ~uint64_t(1);
+      }
+    }
+    layout.inhabitants.resize( x_size * y_size );
+    layout.items.resize( x_size * y_size );
+    for( size_t i = 0; i < x_size * y_size; ++i )
+    {
+      layout.inhabitants[i] = InhabitantFor(i);
+      layout.items[i] = ItemFor(i);
+    }
+    std::cout << "  Filling the LabyrinthLayout:                "
+              << MillisecondsSince(start) << " ms" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    Labyrinth l_bulk( layout );
+    std::cout << "  Labyrinth(layout):                          "
+              << MillisecondsSince(start) << " ms" << std::endl;
+
+    // Both Labyrinths should be identical
+    size_t differences = 0;
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x < x_size; ++x )
+      {
+        const Coordinate c(x, y);
+        differences +=
+          ( l_calls.DirectionCheck(c, Direction::kEast) !=
+            l_bulk.DirectionCheck(c, Direction::kEast) ) +
+          ( l_calls.DirectionCheck(c, Direction::kSouth) !=
+            l_bulk.DirectionCheck(c, Direction::kSouth) ) +
+          ( l_calls.GetInhabitant(c) != l_bulk.GetInhabitant(c) ) +
+          ( l_calls.ItemAt(c) != l_bulk.ItemAt(c) );
+      }
+    }
+    std::cout << "  Differences between the two (should be 0): "
+              << differences << std::endl;
+    if( differences != 0 )
+    {
+      return 1;
+    }
+
+    // A quarter of the Rooms receive an Inhabitant, and a tenth an Item
+    LabyrinthPopulation population;
+    population.minotaurs = x_size * y_size / 5;
+    population.mirrors = x_size * y_size / 20;
+    population.bullets = x_size * y_size / 10;
+    population.treasure = true;
+    BenchmarkPlacement( x_size, y_size, population );
+
+    // Nearly every Room is filled, where retries slow down the most
+    population.minotaurs = x_size * y_size / 100 * 95;
+    population.mirrors = 0;
+    population.bullets = x_size * y_size / 100 * 95;
+    BenchmarkPlacement( x_size, y_size, population );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,249 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks reading and changing the Rooms of a 256 x 256
+ * ConcurrentLabyrinth against those of the Labyrinth it was copied from,
+ * and Rooms of the ConcurrentLabyrinth changed by every hardware thread
+ * at once (10 million actions by default).
+ *
+ * Usage: ./output [action_count]
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_status.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/concurrent_labyrinth.hpp"
+
+namespace
+{
+
+// The size of the level
+constexpr size_t kSize = 256;
+
+// This local function builds the same populated maze into every
+// Labyrinth of the benchmark size it is given.
+void BuildLevel( Labyrinth& l );
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function reads the Inhabitant and Item of action_count
+// Rooms in turn, and returns the number of Rooms with an Inhabitant or
+// Item.
+template <typename Level>
+size_t ReadRooms( const Level& l, const size_t action_count );
+
+// This local function takes the Item of action_count Rooms in turn,
+// dropping the Treasure back whenever it is taken, and returns the number
+// of Items taken.
+template <typename Level>
+size_t TakeItems( Level& l, const size_t first, const size_t action_count );
+
+// This local function prints the time and rate of a run.
+void PrintRate( const char* const name,
+                const size_t action_count,
+                const double seconds );
+
+// This local function builds the same populated maze into every
+// Labyrinth of the benchmark size it is given.
+void BuildLevel( Labyrinth& l )
+{
+  MazeGenerator g( MazeAlgorithm::kKruskal, 1 );
+  g.Generate( l );
+  RandomGenerator rng( 2 );
+  LabyrinthPopulation population;
+  population.minotaurs = 5000;
+  population.mirrors = 5000;
+  population.bullets = 20000;
+  population.treasure = true;
+  l.Populate( population, rng );
+}
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+// This local function reads the Inhabitant and Item of action_count
+// Rooms in turn, and returns the number of Rooms with an Inhabitant or
+// Item.
+template <typename Level>
+size_t ReadRooms( const Level& l, const size_t action_count )
+{
+  size_t found = 0;
+  for( size_t i = 0; i < action_count; ++i )
+  {
+    const size_t index = i % ( kSize * kSize );
+    const Coordinate rm( index % kSize, index / kSize );
+    found += l.GetInhabitantUnchecked( rm ) != Inhabitant::kNone ||
+             l.ItemAtUnchecked( rm ) != Item::kNone;
+  }
+  return found;
+}
+
+// This local function takes the Item of action_count Rooms in turn,
+// dropping the Treasure back whenever it is taken, and returns the number
+// of Items taken.
+template <typename Level>
+size_t TakeItems( Level& l, const size_t first, const size_t action_count )
+{
+  size_t taken = 0;
+  for( size_t i = 0; i < action_count; ++i )
+  {
+    const size_t index = ( first + i ) % ( kSize * kSize );
+    const Coordinate rm( index % kSize, index / kSize );
+    const Item itm = l.ItemAtUnchecked( rm );
+    if( l.TryTakeItem(rm).Ok() )
+    {
+      ++taken;
+      if( itm == Item::kTreasure )
+      {
+        l.TryDropTreasure( rm );
+      }
+    }
+  }
+  return taken;
+}
+
+// This local function prints the time and rate of a run.
+void PrintRate( const char* const name,
+                const size_t action_count,
+                const double seconds )
+{
+  std::cout << "    " << name << ": " << seconds * 1e3 << " ms ("
+            << action_count / seconds / 1e6 << " million Rooms/s)"
+            << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t action_count = 10000000;
+  if( argc == 2 )
+  {
+    action_count = std::strtoull( argv[1], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING CONCURRENT ROOM ACCESS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  try
+  {
+    Labyrinth l( kSize, kSize );
+    BuildLevel( l );
+    ConcurrentLabyrinth c( l );
+
+    std::cout << "Reading " << action_count << " Rooms on one thread:"
+              << std::endl;
+    auto start = std::chrono::steady_clock::now();
+    const size_t found = ReadRooms( l, action_count );
+    PrintRate( "Labyrinth", action_count, SecondsSince(start) );
+    start = std::chrono::steady_clock::now();
+    const size_t found_concurrent = ReadRooms( c, action_count );
+    PrintRate( "ConcurrentLabyrinth", action_count, SecondsSince(start) );
+    std::cout << "    Same Rooms found: " << ( found == found_concurrent )
+              << std::endl << std::endl;
+
+    // The Labyrinth's take returns only a status, so it is wrapped to
+    // return a result as the ConcurrentLabyrinth's does
+    struct PlainLevel
+    {
+      Labyrinth& l;
+      Item ItemAtUnchecked( const Coordinate rm ) const
+      {
+        return l.ItemAtUnchecked( rm );
+      }
+      LabyrinthResult<Item> TryTakeItem( const Coordinate rm )
+      {
+        return { l.TryTakeItem(rm), Item::kNone };
+      }
+      LabyrinthStatus TryDropTreasure( const Coordinate rm )
+      {
+        return l.TryDropTreasure( rm );
+      }
+    };
+
+    std::cout << "Taking the Items of " << action_count
+              << " Rooms on one thread:" << std::endl;
+    Labyrinth l_copy( kSize, kSize );
+    BuildLevel( l_copy );
+    PlainLevel plain = { l_copy };
+    start = std::chrono::steady_clock::now();
+    const size_t taken = TakeItems( plain, 0, action_count );
+    PrintRate( "Labyrinth", action_count, SecondsSince(start) );
+    ConcurrentLabyrinth c_take( l );
+    start = std::chrono::steady_clock::now();
+    const size_t taken_concurrent = TakeItems( c_take, 0, action_count );
+    PrintRate( "ConcurrentLabyrinth", action_count, SecondsSince(start) );
+    std::cout << "    Same Items taken: " << ( taken == taken_concurrent )
+              << std::endl << std::endl;
+
+    const size_t thread_count =
+      std::max( 1u, std::thread::hardware_concurrency() );
+    std::cout << "Taking the Items of " << action_count << " Rooms on "
+              << thread_count << " thread(s) at once:" << std::endl;
+    ConcurrentLabyrinth c_shared( l );
+    const size_t share = action_count / thread_count;
+    std::vector<std::thread> threads;
+    start = std::chrono::steady_clock::now();
+    for( size_t t = 0; t < thread_count; ++t )
+    {
+      // Each thread starts at a different Room, so the threads race
+      // whenever one catches up with another
+      threads.emplace_back( [&, t]()
+      {
+        TakeItems( c_shared, t * kSize * kSize / thread_count, share );
+      } );
+    }
+    for( std::thread& t : threads )
+    {
+      t.join();
+    }
+    PrintRate( "ConcurrentLabyrinth", share * thread_count,
+               SecondsSince(start) );
+    size_t bullets_left = 0;
+    for( size_t i = 0; i < kSize * kSize; ++i )
+    {
+      bullets_left += c_shared.ItemAtUnchecked(
+        Coordinate(i % kSize, i / kSize) ) == Item::kBullet;
+    }
+    std::cout << "    Bullets left: " << bullets_left << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks the DistanceField class against a
+ * breadth-first search which allocates its own queue and distances and
+ * checks one Wall at a time through Labyrinth::DirectionCheck().
+ *
+ * Usage: ./output [x_size y_size]
+ *   By default, a maze of 1024 x 1024 Rooms is searched.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <queue>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/distance_field.hpp"
+
+namespace
+{
+
+// Searches timed by each benchmark
+constexpr size_t kRepetitions = 10;
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns the distance of every Room from the given
+// Room, found one Room at a time through DirectionCheck().
+std::vector<uint32_t> SimpleDistances( const Labyrinth& l,
+                                       const Coordinate source );
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// This local function returns the distance of every Room from the given
+// Room, found one Room at a time through DirectionCheck().
+std::vector<uint32_t> SimpleDistances( const Labyrinth& l,
+                                       const Coordinate source )
+{
+  const Direction directions[] =
+    { Direction::kNorth, Direction::kEast, Direction::kSouth, Direction::kWest };
+  const int dx[] = { 0, 1, 0, -1 };
+  const int dy[] = { -1, 0, 1, 0 };
+
+  std::vector<uint32_t> d( l.XSize() * l.YSize(),
+                           DistanceField::kUnreachable );
+  std::queue<Coordinate> queue;
+  queue.push( source );
+  d[source.y * l.XSize() + source.x] = 0;
+  while( !queue.empty() )
+  {
+    const Coordinate c = queue.front();
+    queue.pop();
+    for( size_t i = 0; i < 4; ++i )
+    {
+      if( l.DirectionCheck(c, directions[i]) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      const Coordinate next( c.x + dx[i], c.y + dy[i] );
+      if( d[next.y * l.XSize() + next.x] == DistanceField::kUnreachable )
+      {
+        d[next.y * l.XSize() + next.x] = d[c.y * l.XSize() + c.x] + 1;
+        queue.push( next );
+      }
+    }
+  }
+  return d;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 1024;
+  size_t y_size = 1024;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING DISTANCE FIELDS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  try
+  {
+    std::cout << "Generating a " << x_size << " x " << y_size << " maze ("
+              << x_size * y_size << " Rooms)..." << std::endl << std::endl;
+    Labyrinth l( x_size, y_size );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 1 );
+    g.Generate( l );
+    l.SetExit( Coordinate(x_size - 1, y_size - 1), Direction::kEast );
+    const Coordinate centre( x_size / 2, y_size / 2 );
+
+    std::cout << "Distances from the centre, averaged over " << kRepetitions
+              << " searches:" << std::endl;
+
+    uint64_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kRepetitions; ++i )
+    {
+      checksum += SimpleDistances( l, centre )[0];
+    }
+    const double simple_ms = MillisecondsSince( start ) / kRepetitions;
+    std::cout << "  std::queue and DirectionCheck(): " << simple_ms
+              << " ms" << std::endl;
+
+    DistanceField f;
+    start = std::chrono::steady_clock::now();
+    f.Compute( l, centre );
+    std::cout << "  DistanceField, first search:     "
+              << MillisecondsSince(start) << " ms" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kRepetitions; ++i )
+    {
+      f.Compute( l, centre );
+      checksum -= f.Distances()[0];
+    }
+    const double field_ms = MillisecondsSince( start ) / kRepetitions;
+    std::cout << "  DistanceField, reused:           " << field_ms << " ms ("
+              << x_size * y_size / field_ms / 1000 << " million Rooms/s, "
+              << simple_ms / field_ms << "x faster)" << std::endl
+              << "  Greatest distance: " << f.MaxDistance()
+              << " (checksum " << checksum << ", should be 0)" << std::endl
+              << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    f.ComputeFromExit( l );
+    std::cout << "Distances from the exit:           "
+              << MillisecondsSince(start) << " ms" << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    f.Compute( l, std::vector<Coordinate>{ Coordinate(0, 0),
+                                           Coordinate(x_size - 1, 0),
+                                           Coordinate(0, y_size - 1),
+                                           Coordinate(x_size - 1,
+                                                      y_size - 1) } );
+    std::cout << "Distances from the four corners:   "
+              << MillisecondsSince(start) << " ms" << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
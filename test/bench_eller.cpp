@@ -0,0 +1,122 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks streaming maze generation with the
+ * EllerGenerator class (100,000 x 1,000 Rooms by default).
+ *
+ * Usage: ./output [x_size y_size [file]]
+ *   Without a file, rows are only counted; with a file, the maze is
+ *   written to it in the streaming format.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+
+#include "../include/wall_grid.hpp"
+#include "../include/maze_stream.hpp"
+#include "../include/eller_generator.hpp"
+
+namespace
+{
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 100000;
+  size_t y_size = 1000;
+  if( argc >= 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING STREAMING MAZE GENERATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  const double rooms = static_cast<double>(x_size) * y_size;
+  const size_t words = WallGrid::WordsPerRow( x_size );
+  std::cout << "Generating a " << x_size << " x " << y_size << " maze ("
+            << rooms << " Rooms) with Eller's algorithm." << std::endl
+            << "  Working memory: about "
+            << ( x_size * (3 * sizeof(size_t) + 2) + words * 16 ) / 1024.0
+            << " KiB, whatever the y size." << std::endl;
+
+  try
+  {
+    EllerGenerator g( x_size, y_size, 1 );
+
+    // Counts the Walls broken between Rooms; padding bits are always set
+    size_t connections = 0;
+    auto start = std::chrono::steady_clock::now();
+    g.Generate( [&connections, words]( const size_t y,
+                                       const uint64_t* const east,
+                                       const uint64_t* const south )
+    {
+      (void)(y);
+      for( size_t i = 0; i < words; ++i )
+      {
+        connections += __builtin_popcountll( ~east[i] ) +
+                       __builtin_popcountll( ~south[i] );
+      }
+    } );
+    double seconds = SecondsSince(start);
+    std::cout << "  Generated in " << seconds << " s ("
+              << rooms / seconds / 1e6 << " million Rooms/s)." << std::endl
+              << "  Connections: " << connections << " (expected "
+              << x_size * y_size - 1 << ")." << std::endl;
+    if( connections != x_size * y_size - 1 )
+    {
+      std::cout << "Error: The maze is not perfect." << std::endl;
+      return 1;
+    }
+
+    if( argc == 4 )
+    {
+      std::ofstream file( argv[3], std::ios::binary );
+      MazeStreamWriter writer( file, x_size, y_size );
+      start = std::chrono::steady_clock::now();
+      g.Generate( writer );
+      file.flush();
+      seconds = SecondsSince(start);
+      std::cout << "  Written to " << argv[3] << " in " << seconds << " s ("
+                << rooms / seconds / 1e6 << " million Rooms/s, "
+                << ( 24 + 16.0 * words * y_size ) / (1024.0 * 1024.0)
+                << " MiB)." << std::endl;
+    }
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
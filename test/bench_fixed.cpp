@@ -0,0 +1,153 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks building and searching many small levels with
+ * the FixedLabyrinth class template, against a Labyrinth of the same size
+ * (100,000 levels of 16 x 16 Rooms by default).
+ *
+ * Usage: ./output [level_count]
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_view.hpp"
+#include "../include/fixed_labyrinth.hpp"
+#include "../include/distance_field.hpp"
+
+namespace
+{
+
+const size_t kSize = 16;
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function carves a serpentine level into the Labyrinth, sets
+// its exit, checks every Wall of every Room, and returns the number of
+// Walls found plus the distance from the exit to (0, 0).
+template <typename L>
+size_t BuildAndSolve( L& l, DistanceField& f );
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+// This local function carves a serpentine level into the Labyrinth, sets
+// its exit, checks every Wall of every Room, and returns the number of
+// Walls found plus the distance from the exit to (0, 0).
+template <typename L>
+size_t BuildAndSolve( L& l, DistanceField& f )
+{
+  for( size_t y = 0; y < kSize; ++y )
+  {
+    for( size_t x = 1; x < kSize; ++x )
+    {
+      l.ConnectRooms( Coordinate(x - 1, y), Coordinate(x, y) );
+    }
+    if( y > 0 )
+    {
+      const size_t x = y % 2 == 1 ? kSize - 1 : 0;
+      l.ConnectRooms( Coordinate(x, y - 1), Coordinate(x, y) );
+    }
+  }
+  l.SetExit( Coordinate(kSize - 1, kSize - 1), Direction::kEast );
+
+  const Direction directions[] = { Direction::kNorth, Direction::kEast,
+                                   Direction::kSouth, Direction::kWest };
+  size_t walls = 0;
+  for( size_t y = 0; y < kSize; ++y )
+  {
+    for( size_t x = 0; x < kSize; ++x )
+    {
+      for( const Direction d : directions )
+      {
+        walls += l.DirectionCheck( Coordinate(x, y), d ) ==
+                 RoomBorder::kWall;
+      }
+    }
+  }
+
+  f.ComputeFromExit( l );
+  return walls + f.DistanceTo( Coordinate(0, 0) );
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t level_count = 100000;
+  if( argc == 2 )
+  {
+    level_count = std::strtoull( argv[1], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING FIXED-SIZE LABYRINTHS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "Building, checking, and solving " << level_count << " "
+            << kSize << " x " << kSize << " levels:" << std::endl;
+
+  try
+  {
+    DistanceField f;
+
+    size_t dynamic_sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < level_count; ++i )
+    {
+      Labyrinth l( kSize, kSize );
+      dynamic_sum += BuildAndSolve( l, f );
+    }
+    const double dynamic_seconds = SecondsSince( start );
+
+    size_t fixed_sum = 0;
+    start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < level_count; ++i )
+    {
+      FixedLabyrinth<kSize, kSize> l;
+      fixed_sum += BuildAndSolve( l, f );
+    }
+    const double fixed_seconds = SecondsSince( start );
+
+    std::cout << "  Labyrinth:      " << dynamic_seconds * 1e3 << " ms ("
+              << dynamic_seconds / level_count * 1e9 << " ns/level)"
+              << std::endl
+              << "  FixedLabyrinth: " << fixed_seconds * 1e3 << " ms ("
+              << fixed_seconds / level_count * 1e9 << " ns/level)"
+              << std::endl;
+    if( dynamic_sum != fixed_sum )
+    {
+      std::cout << "Error: The levels differ." << std::endl;
+      return 1;
+    }
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
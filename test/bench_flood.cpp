@@ -0,0 +1,212 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks finding the Rooms which can be reached from
+ * spawn 1 with a FloodFill, against a breadth-first search which checks
+ * one Wall at a time through Labyrinth::DirectionCheck() and against a
+ * DistanceField.
+ *
+ * Usage: ./output [x_size y_size]
+ *   By default, Labyrinths of 1024 x 1024 Rooms are filled.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <queue>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/flood_fill.hpp"
+
+namespace
+{
+
+// Fills timed by each benchmark
+constexpr size_t kRepetitions = 10;
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns the number of Rooms which can be reached
+// from the given Room, found one Room at a time through DirectionCheck().
+size_t SimpleReachableCount( const Labyrinth& l, const Coordinate source );
+
+// This local function times each way of filling the Labyrinth from spawn
+// 1 and prints the results.
+void BenchFill( const Labyrinth& l, const char* const name );
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// This local function returns the number of Rooms which can be reached
+// from the given Room, found one Room at a time through DirectionCheck().
+size_t SimpleReachableCount( const Labyrinth& l, const Coordinate source )
+{
+  const Direction directions[] =
+    { Direction::kNorth, Direction::kEast, Direction::kSouth, Direction::kWest };
+  const int dx[] = { 0, 1, 0, -1 };
+  const int dy[] = { -1, 0, 1, 0 };
+
+  std::vector<bool> seen( l.XSize() * l.YSize(), false );
+  std::queue<Coordinate> queue;
+  queue.push( source );
+  seen[source.y * l.XSize() + source.x] = true;
+  size_t count = 0;
+  while( !queue.empty() )
+  {
+    const Coordinate c = queue.front();
+    queue.pop();
+    ++count;
+    for( size_t i = 0; i < 4; ++i )
+    {
+      if( l.DirectionCheck(c, directions[i]) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      const Coordinate next( c.x + dx[i], c.y + dy[i] );
+      if( !seen[next.y * l.XSize() + next.x] )
+      {
+        seen[next.y * l.XSize() + next.x] = true;
+        queue.push( next );
+      }
+    }
+  }
+  return count;
+}
+
+// This local function times each way of filling the Labyrinth from spawn
+// 1 and prints the results.
+void BenchFill( const Labyrinth& l, const char* const name )
+{
+  std::cout << name << ", averaged over " << kRepetitions << " fills:"
+            << std::endl;
+
+  size_t simple_count = 0;
+  auto start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < kRepetitions; ++i )
+  {
+    simple_count = SimpleReachableCount( l, l.Spawn1() );
+  }
+  const double simple_ms = MillisecondsSince( start ) / kRepetitions;
+  std::cout << "  std::queue and DirectionCheck(): " << simple_ms << " ms ("
+            << simple_count << " Rooms)" << std::endl;
+
+  DistanceField d;
+  start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < kRepetitions; ++i )
+  {
+    d.Compute( l, l.Spawn1() );
+  }
+  const double distance_ms = MillisecondsSince( start ) / kRepetitions;
+  std::cout << "  DistanceField:                   " << distance_ms
+            << " ms (" << d.ReachableCount() << " Rooms)" << std::endl;
+
+  FloodFill f;
+  start = std::chrono::steady_clock::now();
+  for( size_t i = 0; i < kRepetitions; ++i )
+  {
+    f.Fill( l, l.Spawn1() );
+  }
+  const double flood_ms = MillisecondsSince( start ) / kRepetitions;
+  std::cout << "  FloodFill:                       " << flood_ms << " ms ("
+            << f.ReachableCount() << " Rooms, " << simple_ms / flood_ms
+            << "x faster)" << std::endl << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 1024;
+  size_t y_size = 1024;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING FLOOD FILLS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  try
+  {
+    const Coordinate centre( x_size / 2, y_size / 2 );
+
+    // A perfect maze, where every path winds
+    Labyrinth l_maze( x_size, y_size );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 1 );
+    g.Generate( l_maze );
+    l_maze.SetSpawn1( centre );
+    BenchFill( l_maze, "Perfect maze" );
+
+    // Caves: the same maze with a third of the remaining Walls broken
+    RandomGenerator rng( 2 );
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x < x_size; ++x )
+      {
+        if( x + 1 < x_size && rng.Below(3) == 0 )
+        {
+          l_maze.TryConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+        }
+        if( y + 1 < y_size && rng.Below(3) == 0 )
+        {
+          l_maze.TryConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+        }
+      }
+    }
+    BenchFill( l_maze, "Caves" );
+
+    // Open halls divided by one long Wall, of which only half is
+    // reachable
+    Labyrinth l_open( x_size, y_size );
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x < x_size; ++x )
+      {
+        if( x + 1 < x_size && x + 1 != x_size / 2 )
+        {
+          l_open.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+        }
+        if( y + 1 < y_size )
+        {
+          l_open.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+        }
+      }
+    }
+    l_open.SetSpawn1( Coordinate(0, 0) );
+    BenchFill( l_open, "Open halls" );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
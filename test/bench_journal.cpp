@@ -0,0 +1,236 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks recording random play of a populated 256 x 256
+ * level in a CommandJournal (1 million actions by default), replaying it,
+ * and seeking to random steps of it with several snapshot intervals.
+ *
+ * Usage: ./output [action_count]
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <sstream>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/game_session.hpp"
+#include "../include/command_journal.hpp"
+#include "../include/journaled_game.hpp"
+#include "../include/journal_replayer.hpp"
+
+namespace
+{
+
+// The size of the level, and the number of random seeks
+constexpr size_t kSize = 256;
+constexpr size_t kSeeks = 200;
+
+// This local function builds the same populated maze into every
+// Labyrinth of the benchmark size it is given.
+void BuildLevel( Labyrinth& l );
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function plays random actions through the game, whose
+// Player is the GameSession, restarting whenever the game ends.
+template <typename Game>
+void Play( Game& game,
+           const GameSession& session,
+           const size_t action_count );
+
+// This local function builds the same populated maze into every
+// Labyrinth of the benchmark size it is given.
+void BuildLevel( Labyrinth& l )
+{
+  MazeGenerator g( MazeAlgorithm::kKruskal, 1 );
+  g.Generate( l );
+  l.SetExit( Coordinate(kSize - 1, kSize - 1), Direction::kEast );
+  l.SetSpawn1( Coordinate(kSize / 2, kSize / 2) );
+  l.SetSpawn2( Coordinate(0, 0) );
+  RandomGenerator rng( 2 );
+  LabyrinthPopulation population;
+  population.minotaurs = 2000;
+  population.mirrors = 2000;
+  population.bullets = 4000;
+  population.treasure = true;
+  l.Populate( population, rng );
+}
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+// This local function plays random actions through the game, whose
+// Player is the GameSession, restarting whenever the game ends.
+template <typename Game>
+void Play( Game& game,
+           const GameSession& session,
+           const size_t action_count )
+{
+  RandomGenerator rng( 3 );
+  const Direction directions[] = { Direction::kNorth, Direction::kEast,
+                                   Direction::kSouth, Direction::kWest };
+  for( size_t i = 0; i < action_count; ++i )
+  {
+    switch( session.State() )
+    {
+      case SessionState::kExploring:
+        game.Move( directions[rng.Below(4)] );
+        break;
+
+      case SessionState::kEncounter:
+        if( rng.Below(4) != 0 )
+        {
+          game.Shoot();
+        }
+        else
+        {
+          game.HoldFire();
+        }
+        break;
+
+      default:
+        game.Restart();
+        break;
+    }
+  }
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t action_count = 1000000;
+  if( argc == 2 )
+  {
+    action_count = std::strtoull( argv[1], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING THE COMMAND JOURNAL" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  try
+  {
+    std::cout << "Playing " << action_count << " random actions of a "
+              << kSize << " x " << kSize << " level:" << std::endl;
+    Labyrinth l_plain( kSize, kSize );
+    BuildLevel( l_plain );
+    GameSession plain( l_plain, 2 );
+    auto start = std::chrono::steady_clock::now();
+    Play( plain, plain, action_count );
+    const double plain_seconds = SecondsSince( start );
+    std::cout << "    GameSession: " << plain_seconds * 1e3 << " ms"
+              << std::endl;
+
+    Labyrinth l( kSize, kSize );
+    BuildLevel( l );
+    start = std::chrono::steady_clock::now();
+    JournaledGame game( l, 2 );
+    const double copy_seconds = SecondsSince( start );
+    const size_t setup_commands = game.Journal().Size();
+    const size_t setup_bytes = game.Journal().ByteSize();
+    start = std::chrono::steady_clock::now();
+    Play( game, game.Session(), action_count );
+    const double record_seconds = SecondsSince( start );
+    const CommandJournal& journal = game.Journal();
+    std::cout << "    JournaledGame: " << record_seconds * 1e3 << " ms ("
+              << record_seconds / plain_seconds << " times as long)"
+              << std::endl
+              << "    Level recorded in " << copy_seconds * 1e3 << " ms as "
+              << setup_commands << " commands of " << setup_bytes
+              << " bytes" << std::endl
+              << "    Play recorded as " << journal.Size() - setup_commands
+              << " commands of " << journal.ByteSize() - setup_bytes
+              << " bytes ("
+              << static_cast<double>(journal.ByteSize() - setup_bytes) /
+                 ( journal.Size() - setup_commands )
+              << " bytes per command)" << std::endl << std::endl;
+
+    std::cout << "Writing and reading the journal:" << std::endl;
+    std::stringstream stream;
+    start = std::chrono::steady_clock::now();
+    journal.Write( stream );
+    std::cout << "    Write: " << SecondsSince(start) * 1e3 << " ms"
+              << std::endl;
+    start = std::chrono::steady_clock::now();
+    const CommandJournal read( stream );
+    std::cout << "    Read and check: " << SecondsSince(start) * 1e3
+              << " ms" << std::endl << std::endl;
+
+    std::cout << "Replaying the journal from the start:" << std::endl;
+    JournalReplayer full( read, read.Size() + 1 );
+    start = std::chrono::steady_clock::now();
+    full.Seek( read.Size() );
+    const double replay_seconds = SecondsSince( start );
+    std::cout << "    " << replay_seconds * 1e3 << " ms ("
+              << read.Size() / replay_seconds / 1e6
+              << " million commands/s)" << std::endl
+              << "    Same Player as recorded: "
+              << ( full.Session().Position() == game.Session().Position() &&
+                   full.Session().Steps() == game.Session().Steps() )
+              << std::endl << std::endl;
+
+    std::cout << "Seeking to " << kSeeks << " random steps, after one "
+              << "replay to the end:" << std::endl;
+    const size_t intervals[] = { 1024, 16384, 262144, read.Size() + 1 };
+    for( const size_t interval : intervals )
+    {
+      JournalReplayer replayer( read, interval );
+      replayer.Seek( read.Size() );
+      RandomGenerator rng( 4 );
+      const size_t replayed = replayer.CommandsReplayed();
+      start = std::chrono::steady_clock::now();
+      for( size_t i = 0; i < kSeeks; ++i )
+      {
+        replayer.Seek( rng.Below(read.Size() + 1) );
+      }
+      const double seek_seconds = SecondsSince( start );
+      if( interval > read.Size() )
+      {
+        std::cout << "    Without snapshots: ";
+      }
+      else
+      {
+        std::cout << "    Every " << interval << " steps: ";
+      }
+      std::cout << seek_seconds / kSeeks * 1e3 << " ms per seek, "
+                << ( replayer.CommandsReplayed() - replayed ) / kSeeks
+                << " commands per seek, " << replayer.SnapshotCount()
+                << " snapshots of "
+                << ( kSize * kSize + kSize * 16 ) / 1024 << " KiB"
+                << std::endl;
+    }
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks path queries through a JunctionGraph against
+ * queries with a reused PathFinder, and incremental updates of the graph
+ * against rebuilding it.
+ *
+ * Usage: ./output [x_size y_size]
+ *   By default, Labyrinths of 1024 x 1024 Rooms are searched.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "../include/labyrinth_status.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/path_finder.hpp"
+#include "../include/junction_graph.hpp"
+
+namespace
+{
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function times building the graph, queries between random
+// pairs of Rooms, and updates after breaking random Walls, and prints the
+// results. Walls of the Labyrinth are broken.
+void BenchLabyrinth( Labyrinth& l,
+                     const char* const name,
+                     const size_t queries,
+                     const size_t updates );
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// This local function times building the graph, queries between random
+// pairs of Rooms, and updates after breaking random Walls, and prints the
+// results. Walls of the Labyrinth are broken.
+void BenchLabyrinth( Labyrinth& l,
+                     const char* const name,
+                     const size_t queries,
+                     const size_t updates )
+{
+  std::cout << name << ":" << std::endl;
+
+  auto start = std::chrono::steady_clock::now();
+  JunctionGraph j( &l );
+  const double build_ms = MillisecondsSince( start );
+  std::cout << "  Build:                " << build_ms << " ms ("
+            << j.NodeCount() << " nodes and " << j.EdgeCount()
+            << " edges for " << l.XSize() * l.YSize() << " Rooms)"
+            << std::endl;
+
+  RandomGenerator rng( 1 );
+  std::vector<std::pair<Coordinate, Coordinate>> pairs;
+  for( size_t i = 0; i < queries; ++i )
+  {
+    pairs.push_back( std::make_pair(
+      Coordinate(rng.Below(l.XSize()), rng.Below(l.YSize())),
+      Coordinate(rng.Below(l.XSize()), rng.Below(l.YSize()))) );
+  }
+
+  PathFinder finder;
+  size_t finder_total = 0;
+  start = std::chrono::steady_clock::now();
+  for( const auto& p : pairs )
+  {
+    finder_total += finder.Path( l, p.first, p.second ).size();
+  }
+  const double finder_ms = MillisecondsSince( start );
+  std::cout << "  Reused PathFinder:    "
+            << finder_ms * 1000 / queries << " us per query" << std::endl;
+
+  size_t total = 0;
+  size_t expanded = 0;
+  start = std::chrono::steady_clock::now();
+  for( const auto& p : pairs )
+  {
+    total += j.Path( p.first, p.second ).size();
+    expanded += j.ExpandedCount();
+  }
+  const double graph_ms = MillisecondsSince( start );
+  std::cout << "  JunctionGraph:        "
+            << graph_ms * 1000 / queries << " us per query ("
+            << finder_ms / graph_ms << "x faster, "
+            << expanded / queries << " nodes expanded per query)"
+            << std::endl
+            << "  Same total path length (should be 1): "
+            << ( total == finder_total ) << std::endl;
+
+  size_t broken = 0;
+  start = std::chrono::steady_clock::now();
+  while( broken < updates )
+  {
+    const Coordinate rm_1( rng.Below(l.XSize()), rng.Below(l.YSize()) );
+    const Coordinate rm_2 = rng.Below( 2 ) == 0 ?
+      Coordinate( rm_1.x + 1, rm_1.y ) :
+      Coordinate( rm_1.x, rm_1.y + 1 );
+    if( l.TryConnectRooms(rm_1, rm_2) == LabyrinthStatus::kOk )
+    {
+      j.Update( rm_1, rm_2 );
+      ++broken;
+    }
+  }
+  const double update_ms = MillisecondsSince( start );
+  start = std::chrono::steady_clock::now();
+  j.Rebuild();
+  const double rebuild_ms = MillisecondsSince( start );
+  std::cout << "  Update():             "
+            << update_ms * 1000 / updates << " us per broken Wall"
+            << std::endl
+            << "  Rebuild():            " << rebuild_ms * 1000
+            << " us (" << rebuild_ms / update_ms * updates
+            << "x the cost of one Update())" << std::endl << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 1024;
+  size_t y_size = 1024;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING JUNCTION GRAPHS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  try
+  {
+    Labyrinth l_maze( x_size, y_size );
+    MazeGenerator g_maze( MazeAlgorithm::kRecursiveBacktracker, 1 );
+    g_maze.Generate( l_maze );
+    BenchLabyrinth( l_maze, "Perfect maze", 200, 10000 );
+
+    // A maze with a tenth of the remaining Walls broken, which has many
+    // more junctions
+    Labyrinth l_loops( x_size, y_size );
+    MazeGenerator g_loops( MazeAlgorithm::kRecursiveBacktracker, 2 );
+    g_loops.Generate( l_loops );
+    RandomGenerator rng( 3 );
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x < x_size; ++x )
+      {
+        if( x + 1 < x_size && rng.Below(10) == 0 )
+        {
+          l_loops.TryConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+        }
+        if( y + 1 < y_size && rng.Below(10) == 0 )
+        {
+          l_loops.TryConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+        }
+      }
+    }
+    BenchLabyrinth( l_loops, "Maze with loops", 200, 10000 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
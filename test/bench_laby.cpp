@@ -0,0 +1,263 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks Room lookups and whole-grid scans of the
+ * Labyrinth class, and compares the contiguous row-major Room layout with
+ * the previous layout of one heap allocation per row.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/room.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_status.hpp"
+#include "../include/labyrinth.hpp"
+
+namespace
+{
+
+// This local function returns the number of nanoseconds elapsed since
+// the given time point.
+double NanosecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function prints a single benchmark result.
+void PrintResult( const char* const name,
+                  const double ns_total,
+                  const size_t operations,
+                  const size_t checksum );
+
+// This local function returns the number of nanoseconds elapsed since
+// the given time point.
+double NanosecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count();
+}
+
+// This local function prints a single benchmark result.
+void PrintResult( const char* const name,
+                  const double ns_total,
+                  const size_t operations,
+                  const size_t checksum )
+{
+  std::cout << "  " << name << ": "
+            << ns_total / operations << " ns/op"
+            << "  (" << operations << " ops, checksum "
+            << checksum << ")" << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "BENCHMARKING LABYRINTH ROOM STORAGE" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  std::cout << "Room size: " << sizeof(Room) << " bytes ("
+            << sizeof(Room) * 1000000 / (1024.0 * 1024.0)
+            << " MiB per million Rooms)" << std::endl << std::endl;
+
+  // Raw Room layouts
+  //
+  // The previous Labyrinth layout (one allocation per row) is rebuilt here
+  // so that both layouts can be timed with the same scan.
+  const size_t kRawX = 1000;
+  const size_t kRawY = 1000;
+  const size_t kRawPasses = 20;
+
+  auto jagged = std::make_unique<std::unique_ptr<Room[]>[]>(kRawY);
+  for( size_t y = 0; y < kRawY; ++y )
+  {
+    jagged[y] = std::make_unique<Room[]>(kRawX);
+  }
+  auto flat = std::make_unique<Room[]>(kRawX * kRawY);
+
+  std::cout << "Full-grid scan of " << kRawX << " x " << kRawY
+            << " Rooms (east and south borders):" << std::endl;
+
+  size_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for( size_t pass = 0; pass < kRawPasses; ++pass )
+  {
+    for( size_t y = 0; y < kRawY; ++y )
+    {
+      for( size_t x = 0; x < kRawX; ++x )
+      {
+        const Room& r = jagged[y][x];
+        checksum += ( r.DirectionCheck(Direction::kEast) == RoomBorder::kWall );
+        checksum += ( r.DirectionCheck(Direction::kSouth) == RoomBorder::kWall );
+      }
+    }
+  }
+  PrintResult( "Per-row allocations (before)", NanosecondsSince(start),
+               kRawPasses * kRawX * kRawY, checksum );
+
+  checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for( size_t pass = 0; pass < kRawPasses; ++pass )
+  {
+    for( size_t y = 0; y < kRawY; ++y )
+    {
+      for( size_t x = 0; x < kRawX; ++x )
+      {
+        const Room& r = flat[y * kRawX + x];
+        checksum += ( r.DirectionCheck(Direction::kEast) == RoomBorder::kWall );
+        checksum += ( r.DirectionCheck(Direction::kSouth) == RoomBorder::kWall );
+      }
+    }
+  }
+  PrintResult( "Contiguous row-major (after) ", NanosecondsSince(start),
+               kRawPasses * kRawX * kRawY, checksum );
+  std::cout << std::endl;
+
+  // Labyrinth public API
+  const size_t kLabyX = 20;
+  const size_t kLabyY = 20;
+  const size_t kLabyPasses = 20000;
+
+  Labyrinth l( kLabyX, kLabyY );
+  for( size_t y = 0; y < kLabyY; ++y )
+  {
+    for( size_t x = 0; x + 1 < kLabyX; ++x )
+    {
+      l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+  }
+
+  std::cout << "Labyrinth of " << kLabyX << " x " << kLabyY
+            << " Rooms:" << std::endl;
+
+  checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for( size_t pass = 0; pass < kLabyPasses; ++pass )
+  {
+    for( size_t y = 0; y < kLabyY; ++y )
+    {
+      for( size_t x = 0; x < kLabyX; ++x )
+      {
+        const Coordinate c(x, y);
+        checksum += ( l.DirectionCheck(c, Direction::kEast) ==
+                      RoomBorder::kRoom );
+        checksum += ( l.DirectionCheck(c, Direction::kSouth) ==
+                      RoomBorder::kRoom );
+      }
+    }
+  }
+  PrintResult( "DirectionCheck() scan", NanosecondsSince(start),
+               kLabyPasses * kLabyX * kLabyY, checksum );
+
+  checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for( size_t pass = 0; pass < kLabyPasses; ++pass )
+  {
+    // Column-major order defeats the row-major prefetch on purpose
+    for( size_t x = 0; x < kLabyX; ++x )
+    {
+      for( size_t y = 0; y < kLabyY; ++y )
+      {
+        checksum += ( l.GetInhabitant(Coordinate(x, y)) ==
+                      Inhabitant::kNone );
+      }
+    }
+  }
+  PrintResult( "GetInhabitant() lookup", NanosecondsSince(start),
+               kLabyPasses * kLabyX * kLabyY, checksum );
+  std::cout << std::endl;
+
+  // Throwing, non-throwing, and unchecked APIs
+  std::cout << "Throwing, non-throwing, and unchecked APIs on the same "
+            << "Labyrinth:" << std::endl;
+
+  checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for( size_t pass = 0; pass < kLabyPasses; ++pass )
+  {
+    for( size_t y = 0; y < kLabyY; ++y )
+    {
+      for( size_t x = 0; x < kLabyX; ++x )
+      {
+        const auto r = l.TryDirectionCheck( Coordinate(x, y),
+                                            Direction::kEast );
+        checksum += ( r.Ok() && r.value == RoomBorder::kRoom );
+      }
+    }
+  }
+  PrintResult( "TryDirectionCheck()      ", NanosecondsSince(start),
+               kLabyPasses * kLabyX * kLabyY, checksum );
+
+  checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for( size_t pass = 0; pass < kLabyPasses; ++pass )
+  {
+    for( size_t y = 0; y < kLabyY; ++y )
+    {
+      for( size_t x = 0; x < kLabyX; ++x )
+      {
+        checksum += ( l.DirectionCheckUnchecked( Coordinate(x, y),
+                                                 Direction::kEast ) ==
+                      RoomBorder::kRoom );
+      }
+    }
+  }
+  PrintResult( "DirectionCheckUnchecked()", NanosecondsSince(start),
+               kLabyPasses * kLabyX * kLabyY, checksum );
+
+  // Failures are where exceptions cost the most: every Room is empty, so
+  // every attempt to take an Item fails.
+  const size_t kFailPasses = 100;
+
+  checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for( size_t pass = 0; pass < kFailPasses; ++pass )
+  {
+    for( size_t y = 0; y < kLabyY; ++y )
+    {
+      for( size_t x = 0; x < kLabyX; ++x )
+      {
+        try
+        {
+          l.TakeItem( Coordinate(x, y) );
+        }
+        catch( const std::logic_error& e )
+        {
+          ++checksum;
+        }
+      }
+    }
+  }
+  PrintResult( "TakeItem() failing       ", NanosecondsSince(start),
+               kFailPasses * kLabyX * kLabyY, checksum );
+
+  checksum = 0;
+  start = std::chrono::steady_clock::now();
+  for( size_t pass = 0; pass < kFailPasses; ++pass )
+  {
+    for( size_t y = 0; y < kLabyY; ++y )
+    {
+      for( size_t x = 0; x < kLabyX; ++x )
+      {
+        checksum += ( l.TryTakeItem( Coordinate(x, y) ) ==
+                      LabyrinthStatus::kNoItem );
+      }
+    }
+  }
+  PrintResult( "TryTakeItem() failing    ", NanosecondsSince(start),
+               kFailPasses * kLabyX * kLabyY, checksum );
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
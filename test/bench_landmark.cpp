@@ -0,0 +1,176 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks building LandmarkIndexes of several sizes, and
+ * path queries guided by them against plain A* queries, with a reused
+ * PathFinder for both.
+ *
+ * Usage: ./output [x_size y_size]
+ *   By default, Labyrinths of 2048 x 2048 Rooms are searched.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/landmark_index.hpp"
+#include "../include/path_finder.hpp"
+
+namespace
+{
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function times plain A* queries between random pairs of
+// Rooms, then builds indexes of several numbers of landmarks and times
+// the same queries guided by each, and prints the results.
+void BenchLabyrinth( const Labyrinth& l,
+                     const char* const name,
+                     const size_t queries );
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// This local function times plain A* queries between random pairs of
+// Rooms, then builds indexes of several numbers of landmarks and times
+// the same queries guided by each, and prints the results.
+void BenchLabyrinth( const Labyrinth& l,
+                     const char* const name,
+                     const size_t queries )
+{
+  const size_t rooms = l.XSize() * l.YSize();
+  std::cout << name << " (" << rooms << " Rooms, " << queries
+            << " queries):" << std::endl;
+
+  RandomGenerator rng( 1 );
+  std::vector<std::pair<Coordinate, Coordinate>> pairs;
+  for( size_t i = 0; i < queries; ++i )
+  {
+    pairs.push_back( std::make_pair(
+      Coordinate(rng.Below(l.XSize()), rng.Below(l.YSize())),
+      Coordinate(rng.Below(l.XSize()), rng.Below(l.YSize()))) );
+  }
+
+  PathFinder finder;
+  size_t plain_total = 0;
+  size_t plain_expanded = 0;
+  auto start = std::chrono::steady_clock::now();
+  for( const auto& p : pairs )
+  {
+    plain_total += finder.Path( l, p.first, p.second ).size();
+    plain_expanded += finder.ExpandedCount();
+  }
+  const double plain_ms = MillisecondsSince( start );
+  std::cout << "  Plain A*:        " << plain_ms / queries
+            << " ms per query (" << plain_expanded / queries
+            << " Rooms expanded per query)" << std::endl;
+
+  const size_t counts[] = { 4, 8, 16 };
+  for( const size_t count : counts )
+  {
+    LandmarkIndex index;
+    start = std::chrono::steady_clock::now();
+    index.Build( l, count );
+    const double build_ms = MillisecondsSince( start );
+
+    size_t total = 0;
+    size_t expanded = 0;
+    start = std::chrono::steady_clock::now();
+    for( const auto& p : pairs )
+    {
+      total += finder.Path( l, index, p.first, p.second ).size();
+      expanded += finder.ExpandedCount();
+    }
+    const double guided_ms = MillisecondsSince( start );
+    std::cout << "  " << count << " landmarks:" << std::endl
+              << "    Build:         " << build_ms << " ms, "
+              << index.MemoryUsage() / (1024.0 * 1024.0) << " MiB ("
+              << index.MemoryUsage() / double(rooms) << " bytes per Room)"
+              << std::endl
+              << "    Queries:       " << guided_ms / queries
+              << " ms per query (" << plain_ms / guided_ms
+              << "x faster, " << expanded / queries
+              << " Rooms expanded per query)" << std::endl
+              << "    Same total path length (should be 1): "
+              << ( total == plain_total ) << std::endl;
+  }
+  std::cout << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 2048;
+  size_t y_size = 2048;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING LANDMARK-GUIDED PATH QUERIES" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  try
+  {
+    Labyrinth l_maze( x_size, y_size );
+    MazeGenerator g_maze( MazeAlgorithm::kKruskal, 1 );
+    g_maze.Generate( l_maze );
+    BenchLabyrinth( l_maze, "Perfect maze", 40 );
+
+    // Caves: a maze with a third of the remaining Walls broken
+    Labyrinth l_caves( x_size, y_size );
+    MazeGenerator g_caves( MazeAlgorithm::kKruskal, 2 );
+    g_caves.Generate( l_caves );
+    RandomGenerator rng( 3 );
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x < x_size; ++x )
+      {
+        if( x + 1 < x_size && rng.Below(3) == 0 )
+        {
+          l_caves.TryConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+        }
+        if( y + 1 < y_size && rng.Below(3) == 0 )
+        {
+          l_caves.TryConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+        }
+      }
+    }
+    BenchLabyrinth( l_caves, "Caves", 40 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file is a stress benchmark which builds and scans a large
+ * Labyrinth (10,000 x 10,000 Rooms by default).
+ *
+ * Usage: ./output [x_size y_size]
+ *
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+
+#include "../include/room_properties.hpp"
+#include "../include/room_cell.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+
+namespace
+{
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 10000;
+  size_t y_size = 10000;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "STRESS BENCHMARKING A LARGE LABYRINTH" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  // Each Room takes one RoomCell plus its east and south Wall bits.
+  const double rooms = static_cast<double>(x_size) * y_size;
+  const double bytes = rooms * sizeof(RoomCell) +
+                       2.0 * ((x_size + 63) / 64) * 8 * y_size;
+  std::cout << "Creating a Labyrinth of " << x_size << " x " << y_size
+            << " (" << rooms << " Rooms, "
+            << bytes / (1024.0 * 1024.0) << " MiB):"
+            << std::endl;
+
+  auto start = std::chrono::steady_clock::now();
+  try
+  {
+    Labyrinth l( x_size, y_size );
+    std::cout << "  Allocated in " << SecondsSince(start) << " s."
+              << std::endl;
+
+    // Every row is connected from west to east, and the rows are joined
+    // down the west column, which gives a perfect (loop-free) maze.
+    start = std::chrono::steady_clock::now();
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x + 1 < x_size; ++x )
+      {
+        l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < y_size )
+      {
+        l.ConnectRooms( Coordinate(0, y), Coordinate(0, y + 1) );
+      }
+    }
+    const double build_seconds = SecondsSince(start);
+    std::cout << "  Connected in " << build_seconds << " s ("
+              << rooms / build_seconds << " Rooms/s)." << std::endl;
+
+    // Scans every Room's east and south borders, as a whole-grid pass
+    // such as LabyrinthMap::UpdateBorders() does.
+    start = std::chrono::steady_clock::now();
+    size_t open_borders = 0;
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x < x_size; ++x )
+      {
+        const Coordinate c(x, y);
+        open_borders += ( l.DirectionCheck(c, Direction::kEast) ==
+                          RoomBorder::kRoom );
+        open_borders += ( l.DirectionCheck(c, Direction::kSouth) ==
+                          RoomBorder::kRoom );
+      }
+    }
+    const double scan_seconds = SecondsSince(start);
+    std::cout << "  Scanned in " << scan_seconds << " s ("
+              << rooms / scan_seconds << " Rooms/s)." << std::endl;
+
+    const size_t expected = (x_size - 1) * y_size + (y_size - 1);
+    std::cout << "  Open borders: " << open_borders << " (expected "
+              << expected << ")." << std::endl;
+    if( open_borders != expected )
+    {
+      std::cout << "Error: The scan did not match the connected Rooms."
+                << std::endl;
+      return 1;
+    }
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,185 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks distance fields and path queries with their
+ * per-Room arrays in row-major and in Morton order, on a large maze
+ * (4,096 x 4,096 Rooms by default).
+ *
+ * Usage: ./output [x_size y_size]
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/packed_coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/room_layout.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/path_finder.hpp"
+
+namespace
+{
+
+// Searches timed by each benchmark
+constexpr size_t kRepetitions = 5;
+constexpr size_t kQueries = 20;
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns true if the two DistanceFields, in row-major
+// and Morton order, hold the same distance for every Room.
+bool SameDistances( const DistanceField& row_major,
+                    const DistanceField& morton );
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// This local function returns true if the two DistanceFields, in row-major
+// and Morton order, hold the same distance for every Room.
+bool SameDistances( const DistanceField& row_major,
+                    const DistanceField& morton )
+{
+  const MortonLayout layout( morton.XSize(), morton.YSize() );
+  const uint32_t* const d_1 = row_major.Distances();
+  const uint32_t* const d_2 = morton.Distances();
+  for( uint32_t y = 0; y < row_major.YSize(); ++y )
+  {
+    for( uint32_t x = 0; x < row_major.XSize(); ++x )
+    {
+      if( d_1[y * row_major.XSize() + x] != d_2[layout.Index(x, y)] )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 4096;
+  size_t y_size = 4096;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING ROOM LAYOUTS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "A Coordinate takes " << sizeof(Coordinate) << " bytes; a "
+            << "PackedCoordinate takes " << sizeof(PackedCoordinate)
+            << " bytes." << std::endl << std::endl;
+
+  try
+  {
+    std::cout << "Generating a " << x_size << " x " << y_size << " maze ("
+              << x_size * y_size << " Rooms)..." << std::endl << std::endl;
+    Labyrinth l( x_size, y_size );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 1 );
+    g.Generate( l );
+    const Coordinate centre( x_size / 2, y_size / 2 );
+
+    std::cout << "Distances from the centre, averaged over " << kRepetitions
+              << " searches:" << std::endl;
+    DistanceField f_row_major( RoomOrder::kRowMajor );
+    DistanceField f_morton( RoomOrder::kMorton );
+    f_row_major.Compute( l, centre );
+    f_morton.Compute( l, centre );
+
+    auto start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kRepetitions; ++i )
+    {
+      f_row_major.Compute( l, centre );
+    }
+    const double row_major_ms = MillisecondsSince( start ) / kRepetitions;
+
+    start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kRepetitions; ++i )
+    {
+      f_morton.Compute( l, centre );
+    }
+    const double morton_ms = MillisecondsSince( start ) / kRepetitions;
+
+    std::cout << "  Row-major: " << row_major_ms << " ms" << std::endl
+              << "  Morton:    " << morton_ms << " ms ("
+              << row_major_ms / morton_ms << "x as fast)" << std::endl
+              << "  Same distances (should be 1): "
+              << SameDistances( f_row_major, f_morton ) << std::endl
+              << std::endl;
+
+    std::cout << "Paths between " << kQueries << " pairs of Rooms:"
+              << std::endl;
+    RandomGenerator rng( 2 );
+    std::vector<Coordinate> ends;
+    for( size_t i = 0; i < 2 * kQueries; ++i )
+    {
+      ends.push_back( Coordinate(rng.Below(x_size), rng.Below(y_size)) );
+    }
+
+    PathFinder p_row_major( RoomOrder::kRowMajor );
+    PathFinder p_morton( RoomOrder::kMorton );
+    size_t row_major_length = 0;
+    size_t morton_length = 0;
+
+    start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kQueries; ++i )
+    {
+      row_major_length +=
+        p_row_major.Path( l, ends[2 * i], ends[2 * i + 1] ).size();
+    }
+    const double path_row_major_ms = MillisecondsSince( start ) / kQueries;
+
+    start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kQueries; ++i )
+    {
+      morton_length +=
+        p_morton.Path( l, ends[2 * i], ends[2 * i + 1] ).size();
+    }
+    const double path_morton_ms = MillisecondsSince( start ) / kQueries;
+
+    std::cout << "  Row-major: " << path_row_major_ms << " ms per query"
+              << std::endl
+              << "  Morton:    " << path_morton_ms << " ms per query ("
+              << path_row_major_ms / path_morton_ms << "x as fast)"
+              << std::endl
+              << "  Same total path length (should be 1): "
+              << ( row_major_length == morton_length ) << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks the throughput of each MazeGenerator algorithm
+ * in Rooms per second.
+ *
+ * Usage: ./output [large]
+ *   By default, mazes of about 1 thousand and 1 million Rooms are
+ *   generated; with "large", a maze of 100 million Rooms is also generated
+ *   (several gigabytes of memory for Kruskal's algorithm).
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <iostream>
+
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+
+namespace
+{
+
+// This local function returns the number of seconds elapsed since the
+// given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function generates repetitions mazes of the given size with
+// the given algorithm, and prints the throughput.
+void BenchAlgorithm( const MazeAlgorithm algorithm,
+                     const char* const name,
+                     const size_t x_size,
+                     const size_t y_size,
+                     const size_t repetitions );
+
+// This local function returns the number of seconds elapsed since the
+// given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+// This local function generates repetitions mazes of the given size with
+// the given algorithm, and prints the throughput.
+void BenchAlgorithm( const MazeAlgorithm algorithm,
+                     const char* const name,
+                     const size_t x_size,
+                     const size_t y_size,
+                     const size_t repetitions )
+{
+  MazeGenerator g( algorithm, 1 );
+  double seconds = 0;
+  for( size_t i = 0; i < repetitions; ++i )
+  {
+    Labyrinth l( x_size, y_size );
+    const auto start = std::chrono::steady_clock::now();
+    g.Generate( l );
+    seconds += SecondsSince( start );
+  }
+
+  const double rooms = static_cast<double>(x_size * y_size) * repetitions;
+  std::cout << "  " << name << ": " << seconds / repetitions * 1000
+            << " ms per maze, " << rooms / seconds / 1e6
+            << " million Rooms/s" << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  const bool large = ( argc == 2 && std::strcmp(argv[1], "large") == 0 );
+
+  std::cout << std::endl
+            << "BENCHMARKING MAZE GENERATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  struct Size
+  {
+    size_t x_size;
+    size_t y_size;
+    size_t repetitions;
+  };
+  const Size sizes[] =
+  {
+    { 32, 32, 1000 },
+    { 1000, 1000, 3 },
+    { 10000, 10000, 1 },
+  };
+  const size_t size_count = large ? 3 : 2;
+
+  try
+  {
+    for( size_t i = 0; i < size_count; ++i )
+    {
+      const Size& s = sizes[i];
+      std::cout << s.x_size << " x " << s.y_size << " ("
+                << s.x_size * s.y_size << " Rooms):" << std::endl;
+      BenchAlgorithm( MazeAlgorithm::kRecursiveBacktracker,
+                      "Recursive backtracker",
+                      s.x_size, s.y_size, s.repetitions );
+      BenchAlgorithm( MazeAlgorithm::kKruskal, "Kruskal",
+                      s.x_size, s.y_size, s.repetitions );
+      BenchAlgorithm( MazeAlgorithm::kPrim, "Prim",
+                      s.x_size, s.y_size, s.repetitions );
+      BenchAlgorithm( MazeAlgorithm::kWilson, "Wilson",
+                      s.x_size, s.y_size, s.repetitions );
+      std::cout << std::endl;
+    }
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
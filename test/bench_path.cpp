@@ -0,0 +1,232 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks path queries with a reused PathFinder against
+ * an A* search which allocates its own state for every query and checks
+ * one Wall at a time through Labyrinth::DirectionCheck().
+ *
+ * Usage: ./output [x_size y_size]
+ *   By default, Labyrinths of 1024 x 1024 Rooms are searched.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/path_finder.hpp"
+
+namespace
+{
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns the number of Rooms in a shortest path
+// between two Rooms, found by an A* search which allocates its own state
+// and checks Walls through DirectionCheck(), or 0 if there is none.
+size_t SimplePathLength( const Labyrinth& l,
+                         const Coordinate from,
+                         const Coordinate to );
+
+// This local function times queries between random pairs of Rooms at
+// most range Rooms apart along each axis, and prints the results.
+void BenchQueries( const Labyrinth& l,
+                   const char* const name,
+                   const size_t queries,
+                   const size_t range );
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// This local function returns the number of Rooms in a shortest path
+// between two Rooms, found by an A* search which allocates its own state
+// and checks Walls through DirectionCheck(), or 0 if there is none.
+size_t SimplePathLength( const Labyrinth& l,
+                         const Coordinate from,
+                         const Coordinate to )
+{
+  const Direction directions[] =
+    { Direction::kNorth, Direction::kEast, Direction::kSouth, Direction::kWest };
+  const int dx[] = { 0, 1, 0, -1 };
+  const int dy[] = { -1, 0, 1, 0 };
+  const size_t x_size = l.XSize();
+  const auto manhattan = [to]( const Coordinate c )
+  {
+    return ( c.x > to.x ? c.x - to.x : to.x - c.x ) +
+           ( c.y > to.y ? c.y - to.y : to.y - c.y );
+  };
+
+  std::vector<size_t> cost( x_size * l.YSize(), SIZE_MAX );
+  std::vector<size_t> parent( x_size * l.YSize() );
+  using Entry = std::pair<size_t, size_t>;  // f, Room index
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+  cost[from.y * x_size + from.x] = 0;
+  open.push( Entry(manhattan(from), from.y * x_size + from.x) );
+  while( !open.empty() )
+  {
+    const size_t i = open.top().second;
+    const size_t f = open.top().first;
+    open.pop();
+    const Coordinate c( i % x_size, i / x_size );
+    if( f != cost[i] + manhattan(c) )
+    {
+      continue;
+    }
+    if( c == to )
+    {
+      size_t length = 1;
+      for( size_t r = i; r != from.y * x_size + from.x; r = parent[r] )
+      {
+        ++length;
+      }
+      return length;
+    }
+    for( size_t d = 0; d < 4; ++d )
+    {
+      if( l.DirectionCheck(c, directions[d]) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      const Coordinate next( c.x + dx[d], c.y + dy[d] );
+      const size_t n = next.y * x_size + next.x;
+      if( cost[i] + 1 < cost[n] )
+      {
+        cost[n] = cost[i] + 1;
+        parent[n] = i;
+        open.push( Entry(cost[n] + manhattan(next), n) );
+      }
+    }
+  }
+  return 0;
+}
+
+// This local function times queries between random pairs of Rooms at
+// most range Rooms apart along each axis, and prints the results.
+void BenchQueries( const Labyrinth& l,
+                   const char* const name,
+                   const size_t queries,
+                   const size_t range )
+{
+  RandomGenerator rng( 1 );
+  std::vector<std::pair<Coordinate, Coordinate>> pairs;
+  for( size_t i = 0; i < queries; ++i )
+  {
+    const Coordinate from( rng.Below(l.XSize()), rng.Below(l.YSize()) );
+    const size_t x_low = from.x > range ? from.x - range : 0;
+    const size_t y_low = from.y > range ? from.y - range : 0;
+    const size_t x_high = std::min( l.XSize() - 1, from.x + range );
+    const size_t y_high = std::min( l.YSize() - 1, from.y + range );
+    const Coordinate to( x_low + rng.Below(x_high - x_low + 1),
+                         y_low + rng.Below(y_high - y_low + 1) );
+    pairs.push_back( std::make_pair(from, to) );
+  }
+
+  std::cout << name << " (" << queries << " queries):" << std::endl;
+
+  size_t simple_total = 0;
+  auto start = std::chrono::steady_clock::now();
+  for( const auto& p : pairs )
+  {
+    simple_total += SimplePathLength( l, p.first, p.second );
+  }
+  const double simple_ms = MillisecondsSince( start );
+  std::cout << "  Allocating A* with DirectionCheck(): "
+            << simple_ms * 1000 / queries << " us per query" << std::endl;
+
+  PathFinder finder;
+  size_t total = 0;
+  size_t expanded = 0;
+  start = std::chrono::steady_clock::now();
+  for( const auto& p : pairs )
+  {
+    total += finder.Path( l, p.first, p.second ).size();
+    expanded += finder.ExpandedCount();
+  }
+  const double finder_ms = MillisecondsSince( start );
+  std::cout << "  Reused PathFinder:                   "
+            << finder_ms * 1000 / queries << " us per query ("
+            << simple_ms / finder_ms << "x faster, "
+            << expanded / queries << " Rooms expanded per query)"
+            << std::endl
+            << "  Same total path length (should be 1): "
+            << ( total == simple_total ) << std::endl << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 1024;
+  size_t y_size = 1024;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING PATH QUERIES" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  try
+  {
+    // Caves: a maze with a third of the remaining Walls broken, where
+    // bots find many routes of similar length
+    Labyrinth l( x_size, y_size );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 1 );
+    g.Generate( l );
+    RandomGenerator rng( 2 );
+    for( size_t y = 0; y < y_size; ++y )
+    {
+      for( size_t x = 0; x < x_size; ++x )
+      {
+        if( x + 1 < x_size && rng.Below(3) == 0 )
+        {
+          l.TryConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+        }
+        if( y + 1 < y_size && rng.Below(3) == 0 )
+        {
+          l.TryConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+        }
+      }
+    }
+
+    BenchQueries( l, "Caves, Rooms up to 16 apart", 2000, 16 );
+    BenchQueries( l, "Caves, Rooms up to 128 apart", 200, 128 );
+    BenchQueries( l, "Caves, any two Rooms", 20, x_size + y_size );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks the RandomGenerator class against
+ * std::mt19937_64.
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+
+#include "../include/random_generator.hpp"
+
+namespace
+{
+
+// Numbers drawn by each benchmark
+constexpr size_t kDraws = 200000000;
+
+// This local function returns the number of nanoseconds elapsed since
+// the given time point, divided by the number of draws.
+double NanosecondsPerDraw( const std::chrono::steady_clock::time_point start );
+
+// This local function prints the result of a benchmark.
+void PrintResult( const char* const name,
+                  const double ns,
+                  const uint64_t checksum );
+
+// This local function returns the number of nanoseconds elapsed since
+// the given time point, divided by the number of draws.
+double NanosecondsPerDraw( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::nano>(elapsed).count() / kDraws;
+}
+
+// This local function prints the result of a benchmark.
+// The checksum is printed so that the draws cannot be optimized away.
+void PrintResult( const char* const name,
+                  const double ns,
+                  const uint64_t checksum )
+{
+  std::cout << "  " << name << ": " << ns << " ns per number ("
+            << 1000.0 / ns << " million/s, checksum " << checksum % 1000
+            << ")" << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "BENCHMARKING RANDOM NUMBER GENERATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "Drawing " << kDraws << " numbers each:" << std::endl;
+
+  {
+    std::mt19937_64 mt( 1 );
+    uint64_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kDraws; ++i )
+    {
+      sum += mt();
+    }
+    PrintResult( "std::mt19937_64, 64-bit numbers", NanosecondsPerDraw(start),
+                 sum );
+  }
+
+  {
+    RandomGenerator r( 1 );
+    uint64_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kDraws; ++i )
+    {
+      sum += r.Next();
+    }
+    PrintResult( "RandomGenerator, 64-bit numbers", NanosecondsPerDraw(start),
+                 sum );
+  }
+
+  {
+    std::mt19937_64 mt( 1 );
+    std::uniform_int_distribution<uint64_t> die( 0, 5 );
+    uint64_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kDraws; ++i )
+    {
+      sum += die( mt );
+    }
+    PrintResult( "std::mt19937_64 with uniform_int_distribution, 0 to 5",
+                 NanosecondsPerDraw(start), sum );
+  }
+
+  {
+    RandomGenerator r( 1 );
+    uint64_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for( size_t i = 0; i < kDraws; ++i )
+    {
+      sum += r.Below( 6 );
+    }
+    PrintResult( "RandomGenerator::Below(6)", NanosecondsPerDraw(start),
+                 sum );
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,147 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks stepping GameSessions with random actions
+ * through populated mazes (10,000,000 actions by default).
+ *
+ * Usage: ./output [action_count]
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/game_session.hpp"
+
+namespace
+{
+
+// The size of each maze, and the number of actions after which a game
+// which has not ended is abandoned for a new maze
+constexpr size_t kSize = 32;
+constexpr size_t kMaxActions = 20000;
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t action_count = 10000000;
+  if( argc == 2 )
+  {
+    action_count = std::strtoull( argv[1], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING GAME SESSIONS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "Playing " << action_count << " random actions in "
+            << kSize << " x " << kSize << " mazes:" << std::endl;
+
+  try
+  {
+    MazeGenerator g( MazeAlgorithm::kKruskal, 1 );
+    RandomGenerator rng( 2 );
+    LabyrinthPopulation population;
+    population.minotaurs = 20;
+    population.mirrors = 20;
+    population.bullets = 30;
+    population.treasure = true;
+    population.exclusion_radius = 1;
+    population.exclude_spawns = true;
+
+    const Direction directions[] = { Direction::kNorth, Direction::kEast,
+                                     Direction::kSouth, Direction::kWest };
+    size_t games = 0;
+    size_t wins = 0;
+    size_t losses = 0;
+    size_t steps = 0;
+    double seconds = 0;
+    size_t done = 0;
+    while( done < action_count )
+    {
+      // Mazes are built outside the timed loop
+      Labyrinth l( kSize, kSize );
+      g.Generate( l );
+      l.SetExit( Coordinate(kSize - 1, kSize - 1), Direction::kEast );
+      l.SetSpawn1( Coordinate(0, 0) );
+      l.SetSpawn2( Coordinate(kSize - 1, 0) );
+      l.Populate( population, rng );
+
+      GameSession s( l, 2 );
+      const auto start = std::chrono::steady_clock::now();
+      size_t actions = 0;
+      while( actions < kMaxActions && done + actions < action_count &&
+             ( s.State() == SessionState::kExploring ||
+               s.State() == SessionState::kEncounter ) )
+      {
+        const uint64_t r = rng.Next();
+        if( s.State() == SessionState::kEncounter )
+        {
+          if( r & 1 )
+          {
+            s.Shoot();
+          }
+          else
+          {
+            s.HoldFire();
+          }
+        }
+        else
+        {
+          s.Move( directions[r & 3] );
+        }
+        ++actions;
+      }
+      seconds += SecondsSince( start );
+
+      done += actions;
+      steps += s.Steps();
+      ++games;
+      wins += s.State() == SessionState::kWon;
+      losses += s.State() == SessionState::kLost;
+    }
+
+    std::cout << "  " << seconds * 1e3 << " ms (" << done / seconds / 1e6
+              << " million actions/s)" << std::endl
+              << "  " << games << " games: " << wins << " won, " << losses
+              << " lost, " << steps << " Rooms entered" << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks the BatchSimulator with each PlayerPolicy on a
+ * populated 32 x 32 level (10,000 games per policy by default), on one
+ * thread and on every hardware thread.
+ *
+ * Usage: ./output [game_count]
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/simulation_report.hpp"
+#include "../include/batch_simulator.hpp"
+
+namespace
+{
+
+// The size of the level, and the action limit of each game
+constexpr size_t kSize = 32;
+constexpr size_t kMaxActions = 10000;
+
+// This local function prints the report of one simulation.
+void PrintReport( const SimulationReport& r );
+
+// This local function prints the report of one simulation.
+void PrintReport( const SimulationReport& r )
+{
+  std::cout << "    " << r.thread_count << " thread(s): " << r.seconds * 1e3
+            << " ms (" << r.GamesPerSecond() << " games/s, "
+            << r.actions / r.seconds / 1e6 << " million actions/s)"
+            << std::endl
+            << "      Won " << r.won << ", lost " << r.lost
+            << ", abandoned " << r.abandoned << " (win rate "
+            << r.WinRate() << ")" << std::endl
+            << "      " << r.AverageBulletsUsed() << " bullets and "
+            << static_cast<double>(r.deaths) / r.games
+            << " deaths per game" << std::endl
+            << "      Deadliest Rooms:";
+  const size_t shown = std::min( r.death_rooms.size(), size_t(3) );
+  for( size_t i = 0; i < shown; ++i )
+  {
+    std::cout << " (" << r.death_rooms[i].room.x << ", "
+              << r.death_rooms[i].room.y << ") "
+              << r.death_rooms[i].deaths;
+  }
+  std::cout << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t game_count = 10000;
+  if( argc == 2 )
+  {
+    game_count = std::strtoull( argv[1], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING BATCH SIMULATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "Playing " << game_count << " games per policy of a "
+            << kSize << " x " << kSize << " level, with at most "
+            << kMaxActions << " actions each:" << std::endl;
+
+  try
+  {
+    Labyrinth l( kSize, kSize );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 1 );
+    g.Generate( l );
+    l.SetExit( Coordinate(kSize - 1, kSize - 1), Direction::kEast );
+    l.SetSpawn1( Coordinate(0, 0) );
+    l.SetSpawn2( Coordinate(kSize - 1, 0) );
+    RandomGenerator rng( 2 );
+    LabyrinthPopulation population;
+    population.minotaurs = 15;
+    population.mirrors = 15;
+    population.bullets = 20;
+    population.treasure = true;
+    population.exclusion_radius = 1;
+    population.exclude_spawns = true;
+    l.Populate( population, rng );
+
+    const PlayerPolicy policies[] = { PlayerPolicy::kRandomWalk,
+                                      PlayerPolicy::kWallFollower,
+                                      PlayerPolicy::kShortestPath };
+    const char* const names[] = { "Random walk", "Wall follower",
+                                  "Shortest path" };
+    for( size_t i = 0; i < 3; ++i )
+    {
+      std::cout << std::endl << "  " << names[i] << ":" << std::endl;
+      BatchSimulator one( policies[i], 3, 1 );
+      PrintReport( one.Run(l, game_count, 2, kMaxActions) );
+      BatchSimulator all( policies[i], 3 );
+      if( all.ThreadCount() > 1 )
+      {
+        PrintReport( all.Run(l, game_count, 2, kMaxActions) );
+      }
+    }
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks tiled maze generation with the
+ * TiledMazeGenerator class on an increasing number of threads
+ * (4,096 x 4,096 Rooms in 256 x 256 tiles by default).
+ *
+ * Usage: ./output [x_size y_size]
+ *
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <thread>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/tiled_maze_generator.hpp"
+
+namespace
+{
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns a hash of every Wall of the Labyrinth, so
+// that mazes can be compared.
+uint64_t HashWalls( const Labyrinth& l );
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+// This local function returns a hash of every Wall of the Labyrinth, so
+// that mazes can be compared.
+uint64_t HashWalls( const Labyrinth& l )
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      const Coordinate c(x, y);
+      const uint64_t walls =
+        ( l.DirectionCheckUnchecked(c, Direction::kEast) ==
+          RoomBorder::kRoom ) * 2 +
+        ( l.DirectionCheckUnchecked(c, Direction::kSouth) ==
+          RoomBorder::kRoom );
+      hash = ( hash ^ walls ) * 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 4096;
+  size_t y_size = 4096;
+  if( argc == 3 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+  }
+  const double rooms = static_cast<double>(x_size) * y_size;
+
+  std::cout << std::endl
+            << "BENCHMARKING TILED MAZE GENERATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "Generating a " << x_size << " x " << y_size << " maze ("
+            << rooms << " Rooms) with the recursive backtracker; "
+            << std::thread::hardware_concurrency()
+            << " hardware threads." << std::endl;
+
+  try
+  {
+    {
+      Labyrinth l( x_size, y_size );
+      MazeGenerator g( MazeAlgorithm::kRecursiveBacktracker, 1 );
+      const auto start = std::chrono::steady_clock::now();
+      g.Generate( l );
+      const double seconds = SecondsSince(start);
+      std::cout << "  Untiled, 1 thread: " << seconds << " s ("
+                << rooms / seconds / 1e6 << " million Rooms/s)"
+                << std::endl;
+    }
+
+    uint64_t first_hash = 0;
+    for( size_t threads = 1; threads <= 8; threads *= 2 )
+    {
+      Labyrinth l( x_size, y_size );
+      TiledMazeGenerator g( MazeAlgorithm::kRecursiveBacktracker,
+                            256, 256, 1, threads );
+      const auto start = std::chrono::steady_clock::now();
+      g.Generate( l );
+      const double seconds = SecondsSince(start);
+
+      const uint64_t hash = HashWalls( l );
+      if( threads == 1 )
+      {
+        first_hash = hash;
+      }
+      std::cout << "  Tiled, " << threads << " thread(s): " << seconds
+                << " s (" << rooms / seconds / 1e6 << " million Rooms/s), "
+                << "same maze as 1 thread: " << ( hash == first_hash )
+                << std::endl;
+      if( hash != first_hash )
+      {
+        std::cout << "Error: The maze depends on the thread count."
+                  << std::endl;
+        return 1;
+      }
+    }
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
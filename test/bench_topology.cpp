@@ -0,0 +1,260 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks many games of one 256 x 256 level, each played
+ * on a Labyrinth of its own, against the same games played on
+ * RoomOverlays of one shared LevelTopology (1,000 games by default).
+ *
+ * Usage: ./output [game_count]
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/room_cell.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_layout.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/level_topology.hpp"
+#include "../include/room_overlay.hpp"
+#include "../include/game_session.hpp"
+
+namespace
+{
+
+// The size of the level, and the number of actions in each game
+constexpr size_t kSize = 256;
+constexpr size_t kActions = 20000;
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns the number of bytes of Walls and Rooms in a
+// level of the benchmark size.
+size_t LevelBytes();
+
+// This local function plays up to kActions random actions in each game,
+// stopping early if the game ends, and returns the number of actions.
+size_t Play( std::vector<GameSession>& sessions, RandomGenerator& rng );
+
+// This local function returns the number of games which have ended.
+size_t CountEnded( const std::vector<GameSession>& sessions );
+
+// This local function returns the number of seconds elapsed since
+// the given time point.
+double SecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double>(elapsed).count();
+}
+
+// This local function returns the number of bytes of Walls and Rooms in a
+// level of the benchmark size.
+size_t LevelBytes()
+{
+  return kSize * kSize * sizeof(RoomCell) +
+         2 * kSize * WallGrid::WordsPerRow( kSize ) * sizeof(uint64_t);
+}
+
+// This local function plays up to kActions random actions in each game,
+// stopping early if the game ends, and returns the number of actions.
+size_t Play( std::vector<GameSession>& sessions, RandomGenerator& rng )
+{
+  const Direction directions[] = { Direction::kNorth, Direction::kEast,
+                                   Direction::kSouth, Direction::kWest };
+  size_t actions = 0;
+  for( GameSession& s : sessions )
+  {
+    for( size_t i = 0; i < kActions; ++i, ++actions )
+    {
+      const uint64_t r = rng.Next();
+      if( s.State() == SessionState::kEncounter )
+      {
+        if( r & 1 )
+        {
+          s.Shoot();
+        }
+        else
+        {
+          s.HoldFire();
+        }
+      }
+      else if( s.State() == SessionState::kExploring )
+      {
+        s.Move( directions[r & 3] );
+      }
+      else
+      {
+        break;
+      }
+    }
+  }
+  return actions;
+}
+
+// This local function returns the number of games which have ended.
+size_t CountEnded( const std::vector<GameSession>& sessions )
+{
+  size_t ended = 0;
+  for( const GameSession& s : sessions )
+  {
+    ended += s.State() == SessionState::kWon ||
+             s.State() == SessionState::kLost;
+  }
+  return ended;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t game_count = 1000;
+  if( argc == 2 )
+  {
+    game_count = std::strtoull( argv[1], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING GAMES OF A SHARED LEVEL" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "Playing " << game_count << " games of up to " << kActions
+            << " random actions in one " << kSize << " x " << kSize
+            << " level:" << std::endl << std::endl;
+
+  try
+  {
+    Labyrinth l( kSize, kSize );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 1 );
+    g.Generate( l );
+    l.SetExit( Coordinate(kSize - 1, kSize - 1), Direction::kEast );
+    l.SetSpawn1( Coordinate(0, 0) );
+    l.SetSpawn2( Coordinate(kSize - 1, 0) );
+    RandomGenerator rng_populate( 2 );
+    LabyrinthPopulation population;
+    population.minotaurs = 1000;
+    population.mirrors = 1000;
+    population.bullets = 2000;
+    population.treasure = true;
+    population.exclusion_radius = 1;
+    population.exclude_spawns = true;
+    l.Populate( population, rng_populate );
+
+    // Each game on a Labyrinth of its own copies the whole level
+    LabyrinthLayout layout;
+    layout.x_size = kSize;
+    layout.y_size = kSize;
+    const size_t words = kSize * WallGrid::WordsPerRow( kSize );
+    layout.east_walls.assign( l.Walls().EastRow(0),
+                              l.Walls().EastRow(0) + words );
+    layout.south_walls.assign( l.Walls().SouthRow(0),
+                               l.Walls().SouthRow(0) + words );
+    for( size_t i = 0; i < kSize * kSize; ++i )
+    {
+      layout.inhabitants.push_back( l.Cells()[i].GetInhabitant() );
+      layout.items.push_back( l.Cells()[i].GetItem() );
+    }
+
+    std::cout << "One Labyrinth per game:" << std::endl;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::unique_ptr<Labyrinth>> copies;
+    std::vector<GameSession> sessions_copied;
+    copies.reserve( game_count );
+    sessions_copied.reserve( game_count );
+    for( size_t i = 0; i < game_count; ++i )
+    {
+      copies.emplace_back( new Labyrinth(layout) );
+      copies.back()->SetExit( l.ExitRoom(), Direction::kEast );
+      copies.back()->SetSpawn1( l.Spawn1() );
+      copies.back()->SetSpawn2( l.Spawn2() );
+      sessions_copied.emplace_back( *copies.back(), 2 );
+    }
+    const double copy_seconds = SecondsSince( start );
+
+    RandomGenerator rng_copied( 3 );
+    start = std::chrono::steady_clock::now();
+    const size_t actions_copied = Play( sessions_copied, rng_copied );
+    const double play_copied_seconds = SecondsSince( start );
+    const size_t ended_copied = CountEnded( sessions_copied );
+    const size_t copied_bytes = game_count * ( sizeof(Labyrinth) +
+                                               LevelBytes() );
+
+    std::cout << "  Setup: " << copy_seconds * 1e3 << " ms" << std::endl
+              << "  Play: " << play_copied_seconds * 1e3 << " ms ("
+              << actions_copied / play_copied_seconds / 1e6
+              << " million actions/s, " << ended_copied << " games ended)"
+              << std::endl
+              << "  Memory: " << copied_bytes / 1024 << " KiB ("
+              << copied_bytes / game_count << " bytes per game)"
+              << std::endl << std::endl;
+    copies.clear();
+
+    std::cout << "One RoomOverlay per game:" << std::endl;
+    start = std::chrono::steady_clock::now();
+    const auto topology = std::make_shared<const LevelTopology>( l );
+    std::vector<RoomOverlay> overlays;
+    std::vector<GameSession> sessions_shared;
+    overlays.reserve( game_count );
+    sessions_shared.reserve( game_count );
+    for( size_t i = 0; i < game_count; ++i )
+    {
+      overlays.emplace_back( topology );
+      sessions_shared.emplace_back( overlays.back(), 2 );
+    }
+    const double share_seconds = SecondsSince( start );
+
+    RandomGenerator rng_shared( 3 );
+    start = std::chrono::steady_clock::now();
+    const size_t actions_shared = Play( sessions_shared, rng_shared );
+    const double play_shared_seconds = SecondsSince( start );
+    const size_t ended_shared = CountEnded( sessions_shared );
+    size_t shared_bytes = sizeof(LevelTopology) + LevelBytes();
+    size_t changed = 0;
+    for( const RoomOverlay& overlay : overlays )
+    {
+      shared_bytes += overlay.ByteSize();
+      changed += overlay.ChangedRoomCount();
+    }
+
+    std::cout << "  Setup: " << share_seconds * 1e3 << " ms" << std::endl
+              << "  Play: " << play_shared_seconds * 1e3 << " ms ("
+              << actions_shared / play_shared_seconds / 1e6
+              << " million actions/s, " << ended_shared << " games ended)"
+              << std::endl
+              << "  Memory: " << shared_bytes / 1024 << " KiB ("
+              << shared_bytes / game_count << " bytes per game, "
+              << static_cast<double>(changed) / game_count
+              << " Rooms changed per game)" << std::endl
+              << "  Same games (should be 1): "
+              << ( actions_shared == actions_copied &&
+                   ended_shared == ended_copied ) << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,217 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file benchmarks validating a batch of generated levels with a
+ * reused LevelValidator, against a union-find which checks one Wall at a
+ * time through Labyrinth::DirectionCheck(), and against checking only the
+ * special Rooms with a DistanceField from the primary spawn.
+ *
+ * Usage: ./output [x_size y_size levels]
+ *   By default, 20 levels of 512 x 512 Rooms are validated.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/level_report.hpp"
+#include "../include/level_validator.hpp"
+
+namespace
+{
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start );
+
+// This local function returns the number of regions of the Labyrinth,
+// found by a union-find which allocates its own arrays and checks Walls
+// through DirectionCheck().
+size_t SimpleRegionCount( const Labyrinth& l );
+
+// This local function returns the number of milliseconds elapsed since
+// the given time point.
+double MillisecondsSince( const std::chrono::steady_clock::time_point start )
+{
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count();
+}
+
+// This local function returns the number of regions of the Labyrinth,
+// found by a union-find which allocates its own arrays and checks Walls
+// through DirectionCheck().
+size_t SimpleRegionCount( const Labyrinth& l )
+{
+  const size_t x_size = l.XSize();
+  std::vector<size_t> parent( x_size * l.YSize() );
+  std::iota( parent.begin(), parent.end(), 0 );
+  const auto find = [&parent]( size_t i )
+  {
+    while( parent[i] != i )
+    {
+      i = parent[i] = parent[parent[i]];
+    }
+    return i;
+  };
+
+  size_t regions = parent.size();
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < x_size; ++x )
+    {
+      const Coordinate c( x, y );
+      if( l.DirectionCheck(c, Direction::kEast) == RoomBorder::kRoom )
+      {
+        const size_t a = find( y * x_size + x );
+        const size_t b = find( y * x_size + x + 1 );
+        regions -= a != b;
+        parent[a] = b;
+      }
+      if( l.DirectionCheck(c, Direction::kSouth) == RoomBorder::kRoom )
+      {
+        const size_t a = find( y * x_size + x );
+        const size_t b = find( (y + 1) * x_size + x );
+        regions -= a != b;
+        parent[a] = b;
+      }
+    }
+  }
+  return regions;
+}
+
+}  // Anonymous namespace
+
+int main( int argc, char* argv[] )
+{
+  size_t x_size = 512;
+  size_t y_size = 512;
+  size_t levels = 20;
+  if( argc == 4 )
+  {
+    x_size = std::strtoull( argv[1], nullptr, 10 );
+    y_size = std::strtoull( argv[2], nullptr, 10 );
+    levels = std::strtoull( argv[3], nullptr, 10 );
+  }
+
+  std::cout << std::endl
+            << "BENCHMARKING LEVEL VALIDATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+  try
+  {
+    // Each level is two mazes, one above the other, with a Wall in fifty
+    // broken at random within them; every other level joins the mazes,
+    // and the rest leave the second spawn unreachable
+    std::vector<std::unique_ptr<Labyrinth>> batch;
+    RandomGenerator rng( 1 );
+    for( size_t i = 0; i < levels; ++i )
+    {
+      batch.emplace_back( new Labyrinth(x_size, y_size) );
+      Labyrinth& l = *batch.back();
+      MazeGenerator g( MazeAlgorithm::kKruskal, i );
+      g.GenerateRegion( l, Coordinate(0, 0), x_size, y_size / 2 );
+      g.GenerateRegion( l, Coordinate(0, y_size / 2), x_size,
+                        y_size - y_size / 2 );
+      for( size_t j = 0; j < x_size * y_size / 50; ++j )
+      {
+        const Coordinate c( rng.Below(x_size), rng.Below(y_size - 1) );
+        if( c.y != y_size / 2 - 1 )
+        {
+          l.TryConnectRooms( c, Coordinate(c.x, c.y + 1) );
+        }
+      }
+      if( i % 2 == 0 )
+      {
+        l.ConnectRooms( Coordinate(0, y_size / 2 - 1),
+                        Coordinate(0, y_size / 2) );
+      }
+      l.SetSpawn2( Coordinate(x_size - 1, y_size - 1) );
+      l.SetExit( Coordinate(x_size - 1, 0), Direction::kEast );
+      LabyrinthPopulation population;
+      population.treasure = true;
+      l.Populate( population, rng );
+    }
+    const double rooms = double( levels ) * x_size * y_size;
+    std::cout << levels << " levels of " << x_size << " x " << y_size
+              << " Rooms:" << std::endl;
+
+    size_t simple_regions = 0;
+    auto start = std::chrono::steady_clock::now();
+    for( const auto& l : batch )
+    {
+      simple_regions += SimpleRegionCount( *l );
+    }
+    const double simple_ms = MillisecondsSince( start );
+    std::cout << "  Union-find with DirectionCheck():    "
+              << simple_ms / levels << " ms per level ("
+              << simple_ms * 1e6 / rooms << " ns per Room)" << std::endl;
+
+    DistanceField f;
+    size_t reachable = 0;
+    start = std::chrono::steady_clock::now();
+    for( const auto& l : batch )
+    {
+      f.Compute( *l, l->Spawn1() );
+      reachable += f.DistanceTo( l->Spawn2() ) != DistanceField::kUnreachable;
+    }
+    const double field_ms = MillisecondsSince( start );
+    std::cout << "  DistanceField from the spawn only:   "
+              << field_ms / levels << " ms per level ("
+              << field_ms * 1e6 / rooms << " ns per Room)" << std::endl;
+
+    LevelValidator v;
+    size_t regions = 0;
+    size_t playable = 0;
+    size_t reachable_spawns = 0;
+    start = std::chrono::steady_clock::now();
+    for( const auto& l : batch )
+    {
+      const LevelReport& report = v.Validate( *l );
+      regions += report.regions.size();
+      playable += report.Playable();
+      reachable_spawns += v.Connected( l->Spawn1(), l->Spawn2() );
+    }
+    const double validator_ms = MillisecondsSince( start );
+    std::cout << "  Reused LevelValidator:               "
+              << validator_ms / levels << " ms per level ("
+              << validator_ms * 1e6 / rooms << " ns per Room, "
+              << simple_ms / validator_ms << "x faster than "
+              << "DirectionCheck())" << std::endl
+              << "  Playable levels: " << playable << " of " << levels
+              << std::endl
+              << "  Same regions (should be 1): "
+              << ( regions == simple_regions ) << std::endl
+              << "  Same reachable spawns (should be 1): "
+              << ( reachable == reachable_spawns ) << std::endl
+              << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << "________________________________________________" << std::endl
+            << std::endl
+            << "All benchmarks completed." << std::endl
+            << std::endl;
+
+  return 0;
+}
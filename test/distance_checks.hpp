@@ -0,0 +1,39 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the checks which the tests of Labyrinth
+ * copies make of the distances between their Rooms.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_view.hpp"
+#include "../include/distance_field.hpp"
+
+// This function returns the number of Rooms whose distance from the
+// source differs between the two Labyrinths, which have the same size.
+inline size_t CountDifferentDistances( const LabyrinthView& l_1,
+                                       const LabyrinthView& l_2,
+                                       const Coordinate source )
+{
+  DistanceField f_1;
+  DistanceField f_2;
+  f_1.Compute( l_1, source );
+  f_2.Compute( l_2, source );
+  size_t different = 0;
+  for( size_t y = 0; y < l_1.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l_1.XSize(); ++x )
+    {
+      different += f_1.DistanceTo( Coordinate(x, y) ) !=
+                   f_2.DistanceTo( Coordinate(x, y) );
+    }
+  }
+  return different;
+}
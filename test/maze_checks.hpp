@@ -0,0 +1,92 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the checks which the maze generator tests
+ * make of the Walls of a generated Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+
+// This function returns the number of Walls which have been broken
+// between Rooms of the Labyrinth.
+inline size_t CountConnections( const Labyrinth& l )
+{
+  size_t connections = 0;
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      const Coordinate c(x, y);
+      connections +=
+        ( l.DirectionCheck(c, Direction::kEast) == RoomBorder::kRoom ) +
+        ( l.DirectionCheck(c, Direction::kSouth) == RoomBorder::kRoom );
+    }
+  }
+  return connections;
+}
+
+// This function returns the number of Rooms which can be reached
+// from (0, 0).
+inline size_t CountReachable( const Labyrinth& l )
+{
+  const Direction directions[] = { Direction::kNorth, Direction::kEast,
+                                   Direction::kSouth, Direction::kWest };
+  const int dx[] = { 0, 1, 0, -1 };
+  const int dy[] = { -1, 0, 1, 0 };
+
+  std::vector<bool> seen( l.XSize() * l.YSize(), false );
+  std::vector<Coordinate> stack( 1, Coordinate(0, 0) );
+  seen[0] = true;
+  size_t reached = 0;
+  while( !stack.empty() )
+  {
+    const Coordinate c = stack.back();
+    stack.pop_back();
+    ++reached;
+    for( size_t i = 0; i < 4; ++i )
+    {
+      if( l.DirectionCheck(c, directions[i]) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      const Coordinate next( c.x + dx[i], c.y + dy[i] );
+      if( !seen[next.y * l.XSize() + next.x] )
+      {
+        seen[next.y * l.XSize() + next.x] = true;
+        stack.push_back( next );
+      }
+    }
+  }
+  return reached;
+}
+
+// This function returns true if the two Labyrinths have the same
+// Walls, and false otherwise.
+inline bool SameWalls( const Labyrinth& l_1, const Labyrinth& l_2 )
+{
+  for( size_t y = 0; y < l_1.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l_1.XSize(); ++x )
+    {
+      const Coordinate c(x, y);
+      if( l_1.DirectionCheck(c, Direction::kEast) !=
+            l_2.DirectionCheck(c, Direction::kEast) ||
+          l_1.DirectionCheck(c, Direction::kSouth) !=
+            l_2.DirectionCheck(c, Direction::kSouth) )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
@@ -0,0 +1,84 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the checks which the path finding tests
+ * make of the paths found between Rooms of a Labyrinth.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/distance_field.hpp"
+
+// This function returns true if each step of the path passes through a
+// broken Wall between adjacent Rooms, and false otherwise.
+inline bool IsWalkable( const Labyrinth& l,
+                        const std::vector<Coordinate>& path )
+{
+  for( size_t i = 1; i < path.size(); ++i )
+  {
+    const Coordinate a = path[i - 1];
+    const Coordinate b = path[i];
+    Direction d = Direction::kNone;
+    if( b.x == a.x + 1 && b.y == a.y )
+    {
+      d = Direction::kEast;
+    }
+    else if( a.x == b.x + 1 && b.y == a.y )
+    {
+      d = Direction::kWest;
+    }
+    else if( b.y == a.y + 1 && b.x == a.x )
+    {
+      d = Direction::kSouth;
+    }
+    else if( a.y == b.y + 1 && b.x == a.x )
+    {
+      d = Direction::kNorth;
+    }
+    if( d == Direction::kNone || l.DirectionCheck(a, d) != RoomBorder::kRoom )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// This function returns the number of random pairs of Rooms whose path,
+// as returned by find_path( from, to ), has a different length from
+// their distance in a DistanceField, or is not walkable.
+template <typename FindPath>
+size_t CountWrongPathsOf( const Labyrinth& l,
+                          const size_t pairs,
+                          const uint64_t seed,
+                          FindPath find_path )
+{
+  RandomGenerator rng( seed );
+  DistanceField f;
+  size_t wrong = 0;
+  for( size_t i = 0; i < pairs; ++i )
+  {
+    const Coordinate from( rng.Below(l.XSize()), rng.Below(l.YSize()) );
+    const Coordinate to( rng.Below(l.XSize()), rng.Below(l.YSize()) );
+    f.Compute( l, from );
+    const std::vector<Coordinate>& path = find_path( from, to );
+    const uint32_t d = f.DistanceTo( to );
+    const bool right =
+      d == DistanceField::kUnreachable ?
+        path.empty() :
+        ( path.size() == d + 1 && path.front() == from &&
+          path.back() == to && IsWalkable(l, path) );
+    wrong += !right;
+  }
+  return wrong;
+}
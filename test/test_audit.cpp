@@ -0,0 +1,273 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the LabyrinthAudit class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/room.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/labyrinth_audit.hpp"
+
+namespace
+{
+
+// This local function returns the Rooms of the Labyrinth as a row-major
+// grid of packed Rooms, each holding both sides of its Walls.
+std::vector<Room> RoomsOf( const Labyrinth& l );
+
+// This local function returns the number of violations of the given check.
+size_t CountCheck( const std::vector<AuditViolation>& violations,
+                   const AuditCheck check );
+
+// This local function returns true if the two lists of violations are the
+// same, and false otherwise.
+bool SameViolations( const std::vector<AuditViolation>& v_1,
+                     const std::vector<AuditViolation>& v_2 );
+
+// This local function returns the Rooms of the Labyrinth as a row-major
+// grid of packed Rooms, each holding both sides of its Walls.
+std::vector<Room> RoomsOf( const Labyrinth& l )
+{
+  std::vector<Room> rooms;
+  rooms.reserve( l.XSize() * l.YSize() );
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      const Coordinate c( x, y );
+      Direction exit = Direction::kNone;
+      bool walls[4];
+      const Direction directions[] = { Direction::kNorth, Direction::kEast,
+                                        Direction::kSouth, Direction::kWest };
+      for( size_t i = 0; i < 4; ++i )
+      {
+        const RoomBorder b = l.DirectionCheck( c, directions[i] );
+        walls[i] = b == RoomBorder::kWall;
+        if( b == RoomBorder::kExit )
+        {
+          exit = directions[i];
+        }
+      }
+      rooms.push_back( Room(l.GetInhabitantUnchecked(c),
+                            l.ItemAtUnchecked(c),
+                            exit,
+                            walls[0], walls[1], walls[2], walls[3]) );
+    }
+  }
+  return rooms;
+}
+
+// This local function returns the number of violations of the given check.
+size_t CountCheck( const std::vector<AuditViolation>& violations,
+                   const AuditCheck check )
+{
+  size_t count = 0;
+  for( const AuditViolation& v : violations )
+  {
+    count += v.check == check;
+  }
+  return count;
+}
+
+// This local function returns true if the two lists of violations are the
+// same, and false otherwise.
+bool SameViolations( const std::vector<AuditViolation>& v_1,
+                     const std::vector<AuditViolation>& v_2 )
+{
+  if( v_1.size() != v_2.size() )
+  {
+    return false;
+  }
+  for( size_t i = 0; i < v_1.size(); ++i )
+  {
+    if( !(v_1[i].room == v_2[i].room) ||
+        v_1[i].check != v_2[i].check ||
+        v_1[i].direction != v_2[i].direction )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LABYRINTH_AUDIT.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  Labyrinth l( 40, 30 );
+  MazeGenerator g( MazeAlgorithm::kWilson, 2015 );
+  g.Generate( l );
+  l.SetExit( Coordinate(39, 12), Direction::kEast );
+  l.SetItem( Coordinate(5, 5), Item::kTreasure );
+
+  LabyrinthAudit a( 4 );
+  std::cout << "Auditing a 40 x 30 maze with an exit and a Treasure:"
+            << std::endl
+            << "  Violations of the Labyrinth (should be 0): "
+            << a.Audit( l ).size() << std::endl;
+  std::vector<Room> rooms = RoomsOf( l );
+  std::cout << "  Violations of its Rooms (should be 0): "
+            << a.Audit( rooms.data(), 40, 30 ).size() << std::endl
+            << std::endl;
+
+  // The first intact east Wall of row 3 is broken on one side only
+  size_t x_broken = 0;
+  while( rooms[3 * 40 + x_broken].DirectionCheck(Direction::kEast) !=
+         RoomBorder::kWall )
+  {
+    ++x_broken;
+  }
+  std::cout << "Breaking the east Wall of (" << x_broken << ", 3) but not "
+            << "the west Wall of its neighbour:" << std::endl;
+  rooms[3 * 40 + x_broken].BreakWall( Direction::kEast );
+  const std::vector<AuditViolation>& violations =
+    a.Audit( rooms.data(), 40, 30 );
+  std::cout << "  Violations (should be 1): " << violations.size()
+            << std::endl
+            << "  Asymmetric Walls (should be 1): "
+            << CountCheck( violations, AuditCheck::kAsymmetricWall )
+            << std::endl
+            << "  At that Room to the east (should be 1): "
+            << ( violations[0].room == Coordinate(x_broken, 3) &&
+                 violations[0].direction == Direction::kEast ) << std::endl
+            << std::endl;
+
+  std::cout << "Adding a second exit, an interior exit, a second Treasure, "
+            << "a missing outer Wall, and an invalid Inhabitant:"
+            << std::endl;
+  rooms[29 * 40 + 0].CreateExit( Direction::kSouth );
+  for( const Direction d : { Direction::kNorth, Direction::kEast,
+                             Direction::kSouth, Direction::kWest } )
+  {
+    if( rooms[15 * 40 + 20].DirectionCheck(d) == RoomBorder::kWall )
+    {
+      rooms[15 * 40 + 20].CreateExit( d );
+      break;
+    }
+  }
+  rooms[20 * 40 + 7].SetItem( Item::kTreasure );
+  rooms[0 * 40 + 10].BreakWall( Direction::kNorth );
+  rooms[25 * 40 + 25].SetInhabitant( static_cast<Inhabitant>(7) );
+  a.Audit( rooms.data(), 40, 30 );
+  std::cout << "  Extra exits (should be 2): "
+            << CountCheck( violations, AuditCheck::kExtraExit ) << std::endl
+            << "  Interior exits (should be 1): "
+            << CountCheck( violations, AuditCheck::kInteriorExit )
+            << std::endl
+            << "  Extra Treasures (should be 1): "
+            << CountCheck( violations, AuditCheck::kExtraTreasure )
+            << std::endl
+            << "  Missing outer Walls (should be 1): "
+            << CountCheck( violations, AuditCheck::kMissingOuterWall )
+            << std::endl
+            << "  Invalid Inhabitants (should be 1): "
+            << CountCheck( violations, AuditCheck::kInvalidInhabitant )
+            << std::endl
+            << "  Asymmetric Walls (should be 1): "
+            << CountCheck( violations, AuditCheck::kAsymmetricWall )
+            << std::endl
+            << "  First violation is the outer Wall of (10, 0) "
+            << "(should be 1): "
+            << ( violations[0].room == Coordinate(10, 0) &&
+                 violations[0].check == AuditCheck::kMissingOuterWall )
+            << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING THREADS:"
+            << std::endl << std::endl;
+
+  Labyrinth l_large( 700, 400 );
+  MazeGenerator g_large( MazeAlgorithm::kKruskal, 7 );
+  g_large.Generate( l_large );
+  std::vector<Room> rooms_large = RoomsOf( l_large );
+  for( size_t i = 0; i < rooms_large.size(); i += 997 )
+  {
+    rooms_large[i].SetItem( Item::kTreasure );
+    if( i % 5 == 0 &&
+        rooms_large[i].DirectionCheck(Direction::kSouth) == RoomBorder::kWall )
+    {
+      rooms_large[i].BreakWall( Direction::kSouth );
+    }
+  }
+
+  LabyrinthAudit a_single( 1 );
+  LabyrinthAudit a_many( 8 );
+  const std::vector<AuditViolation> single =
+    a_single.Audit( rooms_large.data(), 700, 400 );
+  std::cout << "  Violations on one thread (should be more than 300): "
+            << single.size() << std::endl
+            << "  Same violations on eight threads (should be 1): "
+            << SameViolations( single,
+                               a_many.Audit(rooms_large.data(), 700, 400) )
+            << std::endl
+            << "  Violations of the Labyrinth on eight threads "
+            << "(should be 0): " << a_many.Audit( l_large ).size()
+            << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  std::cout << "Auditing null Rooms (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    a.Audit( nullptr, 1, 1 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Auditing an empty grid of Rooms (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    a.Audit( rooms.data(), 0, 30 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
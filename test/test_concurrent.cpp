@@ -0,0 +1,273 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the ConcurrentLabyrinth class implementation.
+ *
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_status.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/concurrent_labyrinth.hpp"
+
+namespace
+{
+
+// The number of threads which race in each test
+constexpr size_t kThreads = 8;
+
+// This local function starts kThreads threads which each call
+// work( thread ), and waits for them to finish.
+template <typename Work>
+void RunThreads( const Work& work );
+
+// This local function starts kThreads threads which each call
+// work( thread ), and waits for them to finish.
+template <typename Work>
+void RunThreads( const Work& work )
+{
+  std::vector<std::thread> threads;
+  for( size_t t = 0; t < kThreads; ++t )
+  {
+    threads.emplace_back( work, t );
+  }
+  for( std::thread& t : threads )
+  {
+    t.join();
+  }
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING CONCURRENT_LABYRINTH.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Copying a 3 x 2 Labyrinth:" << std::endl;
+  Labyrinth l( 3, 2 );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l.SetExit( Coordinate(2, 1), Direction::kSouth );
+  l.SetSpawn2( Coordinate(2, 0) );
+  l.SetInhabitant( Coordinate(1, 0), Inhabitant::kMinotaur );
+  l.SetInhabitant( Coordinate(2, 0), Inhabitant::kMirror );
+  l.SetItem( Coordinate(0, 1), Item::kBullet );
+  l.SetItem( Coordinate(1, 1), Item::kTreasure );
+  ConcurrentLabyrinth c( l );
+  std::cout << "  Same Rooms (should be 1): "
+            << ( c.GetInhabitant(Coordinate(1, 0)) == Inhabitant::kMinotaur &&
+                 c.GetInhabitant(Coordinate(2, 0)) == Inhabitant::kMirror &&
+                 c.ItemAt(Coordinate(0, 1)) == Item::kBullet &&
+                 c.ItemAt(Coordinate(1, 1)) == Item::kTreasure &&
+                 c.HasTreasure() ) << std::endl
+            << "  Same spawns and exit (should be 1): "
+            << ( c.Spawn2() == Coordinate(2, 0) && c.HasExit() &&
+                 c.ExitRoom() == Coordinate(2, 1) ) << std::endl
+            << "  Same borders (should be 1): "
+            << ( c.DirectionCheckUnchecked(Coordinate(0, 0),
+                                           Direction::kEast) ==
+                   RoomBorder::kRoom &&
+                 c.DirectionCheckUnchecked(Coordinate(0, 0),
+                                           Direction::kSouth) ==
+                   RoomBorder::kWall &&
+                 c.DirectionCheckUnchecked(Coordinate(2, 1),
+                                           Direction::kSouth) ==
+                   RoomBorder::kExit ) << std::endl;
+
+  const LabyrinthStatus second_exit =
+    c.TrySetExit( Coordinate(0, 0), Direction::kNorth );
+  std::cout << "  Setting a second exit (should be 1): "
+            << ( second_exit == LabyrinthStatus::kExitAlreadySet )
+            << std::endl
+            << std::endl;
+
+  std::cout << "Playing on one thread:" << std::endl;
+  const LabyrinthResult<Inhabitant> attack =
+    c.TryAttackEnemy( Coordinate(1, 0) );
+  const LabyrinthResult<Inhabitant> second_attack =
+    c.TryAttackEnemy( Coordinate(1, 0) );
+  std::cout << "  Killing the Minotaur (should be 1): "
+            << ( attack.Ok() && attack.value == Inhabitant::kMinotaur &&
+                 c.GetInhabitant(Coordinate(1, 0)) ==
+                   Inhabitant::kMinotaurDead ) << std::endl
+            << "  Killing it again (should be 1): "
+            << ( second_attack.status == LabyrinthStatus::kNoEnemy &&
+                 second_attack.value == Inhabitant::kMinotaurDead )
+            << std::endl;
+
+  const LabyrinthResult<Item> take = c.TryTakeItem( Coordinate(1, 1) );
+  std::cout << "  Taking the Treasure (should be 1): "
+            << ( take.Ok() && take.value == Item::kTreasure &&
+                 c.ItemAt(Coordinate(1, 1)) == Item::kTreasureGone &&
+                 !c.HasTreasure() ) << std::endl;
+
+  const LabyrinthStatus drop = c.TryDropTreasure( Coordinate(0, 1) );
+  const LabyrinthStatus second_drop = c.TryDropTreasure( Coordinate(0, 0) );
+  const LabyrinthStatus drop_outside = c.TryDropTreasure( Coordinate(3, 0) );
+  std::cout << "  Dropping it over the bullet in (0, 1) (should be 1): "
+            << ( drop == LabyrinthStatus::kOk &&
+                 c.ItemAt(Coordinate(0, 1)) == Item::kTreasure &&
+                 c.HasTreasure() ) << std::endl
+            << "  Dropping a second Treasure (should be 1): "
+            << ( second_drop == LabyrinthStatus::kTreasureAlreadySet )
+            << std::endl
+            << "  Dropping outside the Labyrinth (should be 1): "
+            << ( drop_outside == LabyrinthStatus::kOutOfBounds ) << std::endl
+            << "  Original Labyrinth unchanged (should be 1): "
+            << ( l.GetInhabitant(Coordinate(1, 0)) == Inhabitant::kMinotaur &&
+                 l.ItemAt(Coordinate(1, 1)) == Item::kTreasure )
+            << std::endl;
+
+  try
+  {
+    c.GetInhabitant( Coordinate(0, 2) );
+    std::cout << "  Error: No exception was thrown for a Room outside "
+              << "the Labyrinth." << std::endl;
+  }
+  catch( const std::domain_error& e )
+  {
+    std::cout << "  Room outside the Labyrinth (should be an error):"
+              << std::endl
+              << "    " << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING RACES BETWEEN " << kThreads << " THREADS:"
+            << std::endl << std::endl;
+
+  std::cout << "Setting the exit:" << std::endl;
+  Labyrinth l_open( kThreads, 1 );
+  ConcurrentLabyrinth c_exit( l_open );
+  std::atomic<size_t> exits_set( 0 );
+  std::atomic<size_t> winner( 0 );
+  RunThreads( [&]( const size_t t )
+  {
+    if( c_exit.TrySetExit(Coordinate(t, 0), Direction::kNorth) ==
+          LabyrinthStatus::kOk )
+    {
+      ++exits_set;
+      winner = t;
+    }
+  } );
+  std::cout << "  Exits set (should be 1): " << exits_set << std::endl
+            << "  Exit in the winner's Room (should be 1): "
+            << ( c_exit.ExitRoom() == Coordinate(winner, 0) ) << std::endl
+            << std::endl;
+
+  std::cout << "Taking and dropping one Treasure 10,000 times per thread:"
+            << std::endl;
+  std::atomic<size_t> holders( 0 );
+  std::atomic<size_t> most_holders( 0 );
+  std::atomic<size_t> takes( 0 );
+  std::atomic<size_t> failed_drops( 0 );
+  RunThreads( [&]( const size_t )
+  {
+    for( size_t i = 0; i < 10000; ++i )
+    {
+      if( c.TryTakeItem(Coordinate(0, 1)).Ok() )
+      {
+        const size_t held = ++holders;
+        size_t most = most_holders;
+        while( held > most && !most_holders.compare_exchange_weak(most, held) )
+        {
+        }
+        ++takes;
+        --holders;
+        failed_drops += c.TryDropTreasure( Coordinate(0, 1) ) !=
+                        LabyrinthStatus::kOk;
+      }
+    }
+  } );
+  std::cout << "  Most threads holding the Treasure at once (should be 1): "
+            << most_holders << std::endl
+            << "  Some Treasures taken (should be 1): " << ( takes > 0 )
+            << std::endl
+            << "  Drops which failed (should be 0): " << failed_drops
+            << std::endl
+            << "  Treasure back in (0, 1) (should be 1): "
+            << ( c.HasTreasure() &&
+                 c.ItemAt(Coordinate(0, 1)) == Item::kTreasure ) << std::endl
+            << std::endl;
+
+  std::cout << "Attacking every Room and taking every Item of a populated "
+            << "maze on every thread:" << std::endl;
+  try
+  {
+    Labyrinth l_maze( 64, 64 );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 2015 );
+    g.Generate( l_maze );
+    RandomGenerator rng( 2015 );
+    LabyrinthPopulation population;
+    population.minotaurs = 500;
+    population.mirrors = 500;
+    population.bullets = 800;
+    population.treasure = true;
+    l_maze.Populate( population, rng );
+    ConcurrentLabyrinth c_maze( l_maze );
+
+    std::atomic<size_t> attacked( 0 );
+    std::atomic<size_t> bullets( 0 );
+    std::atomic<size_t> treasures( 0 );
+    RunThreads( [&]( const size_t t )
+    {
+      // Each thread starts at a different Room
+      const size_t rooms = 64 * 64;
+      for( size_t i = 0; i < rooms; ++i )
+      {
+        const size_t index = ( i + t * rooms / kThreads ) % rooms;
+        const Coordinate rm( index % 64, index / 64 );
+        attacked += c_maze.AttackEnemyUnchecked( rm ).Ok();
+        const LabyrinthResult<Item> taken = c_maze.TakeItemUnchecked( rm );
+        bullets += taken.Ok() && taken.value == Item::kBullet;
+        treasures += taken.Ok() && taken.value == Item::kTreasure;
+      }
+    } );
+    std::cout << "  Enemies attacked (should be 1000): " << attacked
+              << std::endl
+              << "  Bullets taken (should be 800): " << bullets << std::endl
+              << "  Treasures taken (should be 1): " << treasures
+              << std::endl
+              << "  No Treasure left (should be 1): " << !c_maze.HasTreasure()
+              << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  Error: An exception was thrown:" << std::endl
+              << "    " << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,336 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the DistanceField class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/distance_field.hpp"
+
+namespace
+{
+
+// This local function returns the distance of every Room from the given
+// Room, found one Room at a time through DirectionCheck().
+std::vector<uint32_t> SimpleDistances( const Labyrinth& l,
+                                       const Coordinate source );
+
+// This local function returns true if two Rooms joined by a broken Wall
+// always differ in distance by exactly 1, and false otherwise.
+bool NeighboursDifferByOne( const Labyrinth& l, const DistanceField& f );
+
+// This local function returns true if every distance of the DistanceField
+// is the same as found through DirectionCheck() from the given Room, and
+// false otherwise.
+bool SameAsSimple( const Labyrinth& l,
+                   const DistanceField& f,
+                   const Coordinate source );
+
+// This local function returns the distance of every Room from the given
+// Room, found one Room at a time through DirectionCheck().
+std::vector<uint32_t> SimpleDistances( const Labyrinth& l,
+                                       const Coordinate source )
+{
+  const Direction directions[] =
+    { Direction::kNorth, Direction::kEast, Direction::kSouth, Direction::kWest };
+  const int dx[] = { 0, 1, 0, -1 };
+  const int dy[] = { -1, 0, 1, 0 };
+
+  std::vector<uint32_t> d( l.XSize() * l.YSize(),
+                           DistanceField::kUnreachable );
+  std::vector<Coordinate> queue( 1, source );
+  d[source.y * l.XSize() + source.x] = 0;
+  for( size_t front = 0; front < queue.size(); ++front )
+  {
+    const Coordinate c = queue[front];
+    for( size_t i = 0; i < 4; ++i )
+    {
+      if( l.DirectionCheck(c, directions[i]) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      const Coordinate next( c.x + dx[i], c.y + dy[i] );
+      if( d[next.y * l.XSize() + next.x] == DistanceField::kUnreachable )
+      {
+        d[next.y * l.XSize() + next.x] = d[c.y * l.XSize() + c.x] + 1;
+        queue.push_back( next );
+      }
+    }
+  }
+  return d;
+}
+
+// This local function returns true if two Rooms joined by a broken Wall
+// always differ in distance by exactly 1, and false otherwise.
+bool NeighboursDifferByOne( const Labyrinth& l, const DistanceField& f )
+{
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      const Coordinate c(x, y);
+      const uint32_t d = f.DistanceTo( c );
+      if( l.DirectionCheck(c, Direction::kEast) == RoomBorder::kRoom )
+      {
+        const uint32_t d_east = f.DistanceTo( Coordinate(x + 1, y) );
+        if( d_east != d + 1 && d != d_east + 1 )
+        {
+          return false;
+        }
+      }
+      if( l.DirectionCheck(c, Direction::kSouth) == RoomBorder::kRoom )
+      {
+        const uint32_t d_south = f.DistanceTo( Coordinate(x, y + 1) );
+        if( d_south != d + 1 && d != d_south + 1 )
+        {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// This local function returns true if every distance of the DistanceField
+// is the same as found through DirectionCheck() from the given Room, and
+// false otherwise.
+bool SameAsSimple( const Labyrinth& l,
+                   const DistanceField& f,
+                   const Coordinate source )
+{
+  const std::vector<uint32_t> d = SimpleDistances( l, source );
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      if( f.DistanceTo(Coordinate(x, y)) != d[y * l.XSize() + x] )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING DISTANCE_FIELD.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  // The 3 x 3 Labyrinth used below:
+  //   (0, 0) - (1, 0) - (2, 0)
+  //                       |
+  //   (0, 1) - (1, 1) - (2, 1)
+  //
+  //   (0, 2) - (1, 2)   (2, 2)
+  Labyrinth l( 3, 3 );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  l.ConnectRooms( Coordinate(2, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 2), Coordinate(1, 2) );
+
+  DistanceField f;
+  std::cout << "A new DistanceField holds no distances (should be 1): "
+            << ( f.Distances() == nullptr ) << std::endl;
+  std::cout << "Distance before computing (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    f.DistanceTo( Coordinate(0, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Computing distances from (0, 0):" << std::endl;
+  f.Compute( l, Coordinate(0, 0) );
+  std::cout << "  (2, 0) (should be 2): " << f.DistanceTo( Coordinate(2, 0) )
+            << std::endl
+            << "  (0, 1) (should be 5): " << f.DistanceTo( Coordinate(0, 1) )
+            << std::endl
+            << "  (0, 2) is unreachable (should be 1): "
+            << ( f.DistanceTo( Coordinate(0, 2) ) ==
+                 DistanceField::kUnreachable ) << std::endl
+            << "  Greatest distance (should be 5): " << f.MaxDistance()
+            << std::endl
+            << "  Reachable Rooms (should be 6): " << f.ReachableCount()
+            << std::endl << std::endl;
+
+  std::cout << "Computing distances from (0, 0), (0, 1), and (0, 0) again:"
+            << std::endl;
+  f.Compute( l, std::vector<Coordinate>{ Coordinate(0, 0),
+                                         Coordinate(0, 1),
+                                         Coordinate(0, 0) } );
+  std::cout << "  (1, 1) (should be 1): " << f.DistanceTo( Coordinate(1, 1) )
+            << std::endl
+            << "  (2, 1) (should be 2): " << f.DistanceTo( Coordinate(2, 1) )
+            << std::endl
+            << "  Greatest distance (should be 2): " << f.MaxDistance()
+            << std::endl
+            << "  Reachable Rooms (should be 6): " << f.ReachableCount()
+            << std::endl << std::endl;
+
+  std::cout << "Computing distances from the exit north of (2, 0):"
+            << std::endl;
+  l.SetExit( Coordinate(2, 0), Direction::kNorth );
+  f.ComputeFromExit( l );
+  std::cout << "  (0, 0) (should be 2): " << f.DistanceTo( Coordinate(0, 0) )
+            << std::endl
+            << "  (0, 1) (should be 3): " << f.DistanceTo( Coordinate(0, 1) )
+            << std::endl << std::endl;
+
+  std::cout << "Computing distances from the Treasure in (1, 2):"
+            << std::endl;
+  l.SetItem( Coordinate(1, 2), Item::kTreasure );
+  f.ComputeFromTreasure( l );
+  std::cout << "  (0, 2) (should be 1): " << f.DistanceTo( Coordinate(0, 2) )
+            << std::endl
+            << "  Reachable Rooms (should be 2): " << f.ReachableCount()
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING A GENERATED MAZE:"
+            << std::endl << std::endl;
+
+  std::cout << "Computing distances from (17, 9) of a 64 x 48 maze:"
+            << std::endl;
+  Labyrinth l_maze( 64, 48 );
+  MazeGenerator g( MazeAlgorithm::kRecursiveBacktracker, 2015 );
+  g.Generate( l_maze );
+  f.Compute( l_maze, Coordinate(17, 9) );
+  std::cout << "  Reachable Rooms (should be 3072): " << f.ReachableCount()
+            << std::endl
+            << "  Same as a search through DirectionCheck() (should be 1): "
+            << ( std::vector<uint32_t>( f.Distances(),
+                                        f.Distances() + 64 * 48 ) ==
+                 SimpleDistances(l_maze, Coordinate(17, 9)) ) << std::endl
+            << "  Connected Rooms differ by 1 (should be 1): "
+            << NeighboursDifferByOne(l_maze, f) << std::endl << std::endl;
+
+  std::cout << "Computing the same distances in Morton order:" << std::endl;
+  DistanceField f_morton( RoomOrder::kMorton );
+  f_morton.Compute( l_maze, Coordinate(17, 9) );
+  std::cout << "  Reachable Rooms (should be 3072): "
+            << f_morton.ReachableCount() << std::endl
+            << "  Same as a search through DirectionCheck() (should be 1): "
+            << SameAsSimple( l_maze, f_morton, Coordinate(17, 9) ) << std::endl
+            << "  Greatest distance is the same (should be 1): "
+            << ( f_morton.MaxDistance() == f.MaxDistance() ) << std::endl
+            << "  Order is Morton (should be 1): "
+            << ( f_morton.Order() == RoomOrder::kMorton ) << std::endl
+            << std::endl;
+
+  std::cout << "Reusing the DistanceField for the 3 x 3 Labyrinth:"
+            << std::endl;
+  f.Compute( l, Coordinate(2, 2) );
+  std::cout << "  Size (should be 3 x 3): " << f.XSize() << " x " << f.YSize()
+            << std::endl
+            << "  Reachable Rooms (should be 1): " << f.ReachableCount()
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  std::cout << "Computing from a Room outside the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    f.Compute( l, Coordinate(3, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "  The previous distances are kept (should be 1): "
+            << f.ReachableCount() << std::endl << std::endl;
+
+  std::cout << "Computing from no Rooms (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    f.Compute( l, std::vector<Coordinate>() );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Computing from the exit of a Labyrinth without one "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    f.ComputeFromExit( l_maze );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Computing from the Treasure of a Labyrinth without it "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    f.ComputeFromTreasure( l_maze );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Distance of a Room outside the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    f.DistanceTo( Coordinate(0, 3) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,204 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the EllerGenerator, MazeStreamWriter, and
+ * MazeStreamReader class implementations.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth_layout.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/maze_stream.hpp"
+#include "../include/eller_generator.hpp"
+
+#include "maze_checks.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING ELLER_GENERATOR.CPP AND MAZE_STREAM.CPP "
+            << "IMPLEMENTATIONS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Generating a 70 x 9 maze into a stream." << std::endl;
+  EllerGenerator g( 70, 9, 2015 );
+  std::stringstream stream;
+  MazeStreamWriter writer( stream, 70, 9 );
+  g.Generate( writer );
+  std::cout << "  Rows written (should be 9): " << writer.RowsWritten()
+            << std::endl
+            << "  Stream size in bytes (should be 312): "
+            << stream.str().size() << std::endl << std::endl;
+
+  std::cout << "Reading the stream into a Labyrinth." << std::endl;
+  MazeStreamReader reader( stream );
+  std::cout << "  Size (should be 70 x 9): " << reader.XSize() << " x "
+            << reader.YSize() << std::endl;
+  Labyrinth l( reader.ReadLayout() );
+  std::cout << "  Connections (should be 629): " << CountConnections(l)
+            << std::endl
+            << "  Rooms reachable from (0, 0) (should be 630): "
+            << CountReachable(l) << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING GENERATION INTO A CALLBACK:"
+            << std::endl << std::endl;
+
+  std::cout << "Generating 8 x 5 mazes with the same seed into callbacks."
+            << std::endl;
+  EllerGenerator g_1( 8, 5, 7 );
+  EllerGenerator g_2( 8, 5, 7 );
+  std::vector<uint64_t> rows_1;
+  std::vector<uint64_t> rows_2;
+  size_t next_y = 0;
+  g_1.Generate( [&rows_1, &next_y]( const size_t y,
+                                    const uint64_t* const east,
+                                    const uint64_t* const south )
+  {
+    next_y += ( y == next_y );
+    rows_1.push_back( east[0] );
+    rows_1.push_back( south[0] );
+  } );
+  g_2.Generate( [&rows_2]( const size_t y,
+                           const uint64_t* const east,
+                           const uint64_t* const south )
+  {
+    (void)(y);
+    rows_2.push_back( east[0] );
+    rows_2.push_back( south[0] );
+  } );
+  std::cout << "  Rows given in order (should be 5): " << next_y
+            << std::endl
+            << "  Same seed gives the same maze (should be 1): "
+            << ( rows_1 == rows_2 ) << std::endl << std::endl;
+
+  LabyrinthLayout layout;
+  layout.x_size = 8;
+  layout.y_size = 5;
+  for( size_t i = 0; i < rows_1.size(); i += 2 )
+  {
+    layout.east_walls.push_back( rows_1[i] );
+    layout.south_walls.push_back( rows_1[i + 1] );
+  }
+  Labyrinth l_small( layout );
+  LabyrinthMap m( &l_small, 8, 5 );
+  m.Display();
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING INVALID STREAMS:"
+            << std::endl << std::endl;
+
+  std::cout << "Reading a stream which is not a maze "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    std::stringstream not_a_maze( "This is not a maze stream." );
+    MazeStreamReader r( not_a_maze );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Reading a 2^34 x 2^36 stream, whose Room count overflows "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    // The header is the magic followed by the little-endian sizes
+    std::string header( "LABYROW1" );
+    const uint64_t sizes[2] = { uint64_t(1) << 34, uint64_t(1) << 36 };
+    for( const uint64_t size : sizes )
+    {
+      for( size_t i = 0; i < 8; ++i )
+      {
+        header += static_cast<char>( (size >> (i * 8)) & 0xFF );
+      }
+    }
+    std::stringstream oversized( header );
+    MazeStreamReader r( oversized );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Reading a stream which ends after 8 rows "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    const std::string full = stream.str();
+    std::stringstream truncated( full.substr(0, full.size() - 32) );
+    MazeStreamReader r( truncated );
+    r.ReadLayout();
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Writing a 10th row to a 70 x 9 stream "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    const uint64_t row[2] = { ~uint64_t(0), ~uint64_t(0) };
+    writer.WriteRow( row, row );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Generating into a writer of another size "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    std::stringstream other;
+    MazeStreamWriter w_other( other, 9, 70 );
+    g.Generate( w_other );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
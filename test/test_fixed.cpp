@@ -0,0 +1,218 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the FixedLabyrinth class template implementation,
+ * and the algorithms which it shares with Labyrinth through LabyrinthView.
+ *
+ */
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_view.hpp"
+#include "../include/fixed_labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/flood_fill.hpp"
+#include "../include/path_finder.hpp"
+#include "../include/level_report.hpp"
+#include "../include/level_validator.hpp"
+
+#include "distance_checks.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING FIXED_LABYRINTH.HPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  // The 3 x 3 Labyrinth used below:
+  //   (0, 0) - (1, 0) - (2, 0)
+  //                       |
+  //   (0, 1) - (1, 1) - (2, 1)
+  //     |
+  //   (0, 2) - (1, 2) - (2, 2) -> exit to the east
+  FixedLabyrinth<3, 3> l;
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  l.ConnectRooms( Coordinate(2, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 1), Coordinate(0, 2) );
+  l.ConnectRooms( Coordinate(0, 2), Coordinate(1, 2) );
+  l.ConnectRooms( Coordinate(1, 2), Coordinate(2, 2) );
+  l.SetExit( Coordinate(2, 2), Direction::kEast );
+  l.SetSpawn2( Coordinate(2, 2) );
+  l.SetItem( Coordinate(1, 1), Item::kTreasure );
+  l.SetInhabitant( Coordinate(0, 2), Inhabitant::kMinotaur );
+
+  std::cout << "Building a serpentine 3 x 3 FixedLabyrinth:" << std::endl
+            << "  Size is a constant (should be 9): "
+            << std::integral_constant<size_t,
+                 FixedLabyrinth<3, 3>::XSize() *
+                 FixedLabyrinth<3, 3>::YSize()>::value << std::endl
+            << "  Stored inline (should be 1): "
+            << ( sizeof(FixedLabyrinth<3, 3>) >= 9 + 2 * 3 * 8 ) << std::endl
+            << "  East of (0, 0) is a Room (should be 1): "
+            << ( l.DirectionCheck(Coordinate(0, 0), Direction::kEast) ==
+                 RoomBorder::kRoom ) << std::endl
+            << "  West of (1, 0) is a Room (should be 1): "
+            << ( l.DirectionCheck(Coordinate(1, 0), Direction::kWest) ==
+                 RoomBorder::kRoom ) << std::endl
+            << "  South of (0, 0) is a Wall (should be 1): "
+            << ( l.DirectionCheck(Coordinate(0, 0), Direction::kSouth) ==
+                 RoomBorder::kWall ) << std::endl
+            << "  North of (0, 0) is a Wall (should be 1): "
+            << ( l.DirectionCheck(Coordinate(0, 0), Direction::kNorth) ==
+                 RoomBorder::kWall ) << std::endl
+            << "  East of (2, 2) is the exit (should be 1): "
+            << ( l.DirectionCheck(Coordinate(2, 2), Direction::kEast) ==
+                 RoomBorder::kExit ) << std::endl
+            << "  Item at (1, 1) is the Treasure (should be 1): "
+            << ( l.ItemAt(Coordinate(1, 1)) == Item::kTreasure ) << std::endl
+            << "  Inhabitant at (0, 2) is a Minotaur (should be 1): "
+            << ( l.GetInhabitant(Coordinate(0, 2)) == Inhabitant::kMinotaur )
+            << std::endl;
+  const LabyrinthStatus first_try =
+    l.TryConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  const LabyrinthStatus second_try =
+    l.TryConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  std::cout << "  Connecting (0, 0) and (0, 1) twice (should be 1): "
+            << ( first_try == LabyrinthStatus::kOk &&
+                 second_try == LabyrinthStatus::kAlreadyConnected )
+            << std::endl
+            << std::endl;
+
+  std::cout << "Running the shared algorithms on it, with (0, 0) and "
+            << "(0, 1) connected:" << std::endl;
+  DistanceField f;
+  f.ComputeFromExit( l );
+  std::cout << "  Distance from the exit to (0, 0) (should be 4): "
+            << f.DistanceTo( Coordinate(0, 0) ) << std::endl;
+  PathFinder p;
+  std::cout << "  Path from (0, 0) to (2, 2) (should be 5 Rooms): "
+            << p.Path( l, Coordinate(0, 0), Coordinate(2, 2) ).size()
+            << " Rooms" << std::endl;
+  LevelValidator v;
+  std::cout << "  Playable (should be 1): " << v.Validate( l ).Playable()
+            << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING AGAINST LABYRINTH:"
+            << std::endl << std::endl;
+
+  Labyrinth l_maze( 70, 40 );
+  MazeGenerator g( MazeAlgorithm::kKruskal, 2015 );
+  g.Generate( l_maze );
+  l_maze.SetExit( Coordinate(0, 39), Direction::kSouth );
+  l_maze.SetSpawn2( Coordinate(69, 0) );
+
+  FixedLabyrinth<70, 40> l_fixed( l_maze );
+  std::cout << "  Rooms at different distances from (35, 20) "
+            << "(should be 0): "
+            << CountDifferentDistances( l_maze, l_fixed, Coordinate(35, 20) )
+            << std::endl;
+
+  FloodFill fill;
+  fill.Fill( l_fixed, Coordinate(0, 0) );
+  std::cout << "  Rooms reached by a flood fill (should be 2800): "
+            << fill.ReachableCount() << std::endl;
+
+  PathFinder p_maze;
+  const size_t maze_length =
+    p_maze.Path( l_maze, Coordinate(0, 0), Coordinate(69, 39) ).size();
+  std::cout << "  Same path length (should be 1): "
+            << ( p.Path(l_fixed, Coordinate(0, 0), Coordinate(69, 39))
+                   .size() == maze_length ) << std::endl
+            << "  Exit in the same Room (should be 1): "
+            << ( l_fixed.DirectionCheck(Coordinate(0, 39), Direction::kSouth)
+                 == RoomBorder::kExit ) << std::endl
+            << "  Same spawn (should be 1): "
+            << ( l_fixed.Spawn2() == l_maze.Spawn2() ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  std::cout << "Connecting a Room outside the Labyrinth (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    l.ConnectRooms( Coordinate(2, 2), Coordinate(3, 2) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Connecting Rooms through the exit (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    FixedLabyrinth<2, 1> l_exit;
+    l_exit.SetExit( Coordinate(0, 0), Direction::kEast );
+    l_exit.ConnectRooms( Coordinate(1, 0), Coordinate(0, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Placing a second Treasure (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    l.SetItem( Coordinate(0, 0), Item::kTreasure );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Copying a Labyrinth of another size (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    FixedLabyrinth<3, 4> l_wrong( l_maze );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,269 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the FloodFill class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/flood_fill.hpp"
+
+namespace
+{
+
+// This local function returns whether each Room can be reached from the
+// given Rooms, found one Room at a time through DirectionCheck().
+std::vector<bool> SimpleReachable( const Labyrinth& l,
+                                   const std::vector<Coordinate>& sources );
+
+// This local function returns true if the FloodFill agrees with
+// SimpleReachable() for every Room, and false otherwise.
+bool SameAsSimple( const Labyrinth& l,
+                   const FloodFill& f,
+                   const std::vector<Coordinate>& sources );
+
+// This local function breaks each Wall between Rooms of the Labyrinth
+// with probability one half.
+void BreakRandomWalls( Labyrinth& l, const uint64_t seed );
+
+// This local function returns whether each Room can be reached from the
+// given Rooms, found one Room at a time through DirectionCheck().
+std::vector<bool> SimpleReachable( const Labyrinth& l,
+                                   const std::vector<Coordinate>& sources )
+{
+  const Direction directions[] =
+    { Direction::kNorth, Direction::kEast, Direction::kSouth, Direction::kWest };
+  const int dx[] = { 0, 1, 0, -1 };
+  const int dy[] = { -1, 0, 1, 0 };
+
+  std::vector<bool> seen( l.XSize() * l.YSize(), false );
+  std::vector<Coordinate> stack;
+  for( const Coordinate c : sources )
+  {
+    seen[c.y * l.XSize() + c.x] = true;
+    stack.push_back( c );
+  }
+  while( !stack.empty() )
+  {
+    const Coordinate c = stack.back();
+    stack.pop_back();
+    for( size_t i = 0; i < 4; ++i )
+    {
+      if( l.DirectionCheck(c, directions[i]) != RoomBorder::kRoom )
+      {
+        continue;
+      }
+      const Coordinate next( c.x + dx[i], c.y + dy[i] );
+      if( !seen[next.y * l.XSize() + next.x] )
+      {
+        seen[next.y * l.XSize() + next.x] = true;
+        stack.push_back( next );
+      }
+    }
+  }
+  return seen;
+}
+
+// This local function returns true if the FloodFill agrees with
+// SimpleReachable() for every Room, and false otherwise.
+bool SameAsSimple( const Labyrinth& l,
+                   const FloodFill& f,
+                   const std::vector<Coordinate>& sources )
+{
+  const std::vector<bool> seen = SimpleReachable( l, sources );
+  size_t count = 0;
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      const bool reachable = seen[y * l.XSize() + x];
+      count += reachable;
+      if( f.IsReachable( Coordinate(x, y) ) != reachable )
+      {
+        return false;
+      }
+    }
+  }
+  return count == f.ReachableCount();
+}
+
+// This local function breaks each Wall between Rooms of the Labyrinth
+// with probability one half.
+void BreakRandomWalls( Labyrinth& l, const uint64_t seed )
+{
+  RandomGenerator rng( seed );
+  for( size_t y = 0; y < l.YSize(); ++y )
+  {
+    for( size_t x = 0; x < l.XSize(); ++x )
+    {
+      if( x + 1 < l.XSize() && rng.Bit() )
+      {
+        l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < l.YSize() && rng.Bit() )
+      {
+        l.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING FLOOD_FILL.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Filling a 200 x 2 Labyrinth whose first row is one "
+            << "corridor:" << std::endl;
+  Labyrinth l_row( 200, 2 );
+  for( size_t x = 0; x + 1 < 200; ++x )
+  {
+    l_row.ConnectRooms( Coordinate(x, 0), Coordinate(x + 1, 0) );
+  }
+  l_row.ConnectRooms( Coordinate(130, 0), Coordinate(130, 1) );
+  FloodFill f;
+  std::cout << "  A new FloodFill holds no Rooms (should be 0): "
+            << f.XSize() << std::endl;
+  f.Fill( l_row, Coordinate(199, 0) );
+  std::cout << "  Reachable Rooms from (199, 0) (should be 201): "
+            << f.ReachableCount() << std::endl
+            << "  (0, 0) can be reached (should be 1): "
+            << f.IsReachable( Coordinate(0, 0) ) << std::endl
+            << "  (130, 1) can be reached (should be 1): "
+            << f.IsReachable( Coordinate(130, 1) ) << std::endl
+            << "  (131, 1) can be reached (should be 0): "
+            << f.IsReachable( Coordinate(131, 1) ) << std::endl;
+  f.Fill( l_row, Coordinate(5, 1) );
+  std::cout << "  Reachable Rooms from (5, 1) (should be 1): "
+            << f.ReachableCount() << std::endl
+            << "  Padding bits are clear (should be 0): "
+            << ( f.Row(0)[3] >> 8 ) << std::endl << std::endl;
+
+  std::cout << "Filling a 64 x 48 maze from spawn 1 at (40, 30):"
+            << std::endl;
+  Labyrinth l_maze( 64, 48 );
+  MazeGenerator g( MazeAlgorithm::kWilson, 2015 );
+  g.Generate( l_maze );
+  l_maze.SetSpawn1( Coordinate(40, 30) );
+  l_maze.SetExit( Coordinate(0, 0), Direction::kNorth );
+  f.Fill( l_maze, l_maze.Spawn1() );
+  std::cout << "  Reachable Rooms (should be 3072): " << f.ReachableCount()
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING AGAINST A SEARCH THROUGH DIRECTIONCHECK():"
+            << std::endl << std::endl;
+
+  const size_t sizes[][2] = { { 1, 1 }, { 1, 70 }, { 63, 5 }, { 64, 64 },
+                              { 65, 9 }, { 150, 40 }, { 300, 3 } };
+  for( const auto& size : sizes )
+  {
+    Labyrinth l( size[0], size[1] );
+    BreakRandomWalls( l, size[0] * 1000 + size[1] );
+
+    const std::vector<Coordinate> one{ Coordinate(size[0] / 2,
+                                                  size[1] / 2) };
+    const std::vector<Coordinate> three{ Coordinate(0, 0),
+                                         Coordinate(size[0] - 1, 0),
+                                         Coordinate(size[0] - 1,
+                                                    size[1] - 1) };
+    f.Fill( l, one );
+    const bool one_same = SameAsSimple( l, f, one );
+    f.Fill( l, three );
+    const bool three_same = SameAsSimple( l, f, three );
+    std::cout << "  " << size[0] << " x " << size[1] << " with random Walls, "
+              << "one and three sources (should be 1 1): " << one_same
+              << " " << three_same << std::endl;
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  std::cout << "Filling from a Room outside the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    f.Fill( l_row, Coordinate(0, 2) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Filling from no Rooms (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    f.Fill( l_row, std::vector<Coordinate>() );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Checking a Room outside the filled Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    f.IsReachable( Coordinate(300, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Checking a Room before filling "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    FloodFill f_empty;
+    f_empty.IsReachable( Coordinate(0, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
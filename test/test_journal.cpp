@@ -0,0 +1,403 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the CommandJournal, JournaledGame, and
+ * JournalReplayer class implementations.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/game_session.hpp"
+#include "../include/command_journal.hpp"
+#include "../include/journaled_game.hpp"
+#include "../include/journal_replayer.hpp"
+
+#include "test_level.hpp"
+
+namespace
+{
+
+// This local function returns true if the two games have the same Walls,
+// Rooms, spawns, exit, and Player, and false otherwise.
+bool SameGame( const Labyrinth& l_1,
+               const GameSession& s_1,
+               const Labyrinth& l_2,
+               const GameSession& s_2 );
+
+// This local function plays random actions, restarting the game whenever
+// it ends.
+void PlayRandomly( JournaledGame& game,
+                   RandomGenerator& rng,
+                   const size_t actions );
+
+// This local function returns true if the two games have the same Walls,
+// Rooms, spawns, exit, and Player, and false otherwise.
+bool SameGame( const Labyrinth& l_1,
+               const GameSession& s_1,
+               const Labyrinth& l_2,
+               const GameSession& s_2 )
+{
+  if( l_1.XSize() != l_2.XSize() || l_1.YSize() != l_2.YSize() ||
+      !( l_1.Spawn1() == l_2.Spawn1() ) ||
+      !( l_1.Spawn2() == l_2.Spawn2() ) ||
+      l_1.HasExit() != l_2.HasExit() ||
+      ( l_1.HasExit() && ( !( l_1.ExitRoom() == l_2.ExitRoom() ) ||
+                           l_1.ExitDirection() != l_2.ExitDirection() ) ) )
+  {
+    return false;
+  }
+
+  const size_t words = l_1.Walls().WordsPerRow() * l_1.YSize();
+  const size_t rooms = l_1.XSize() * l_1.YSize();
+  if( std::memcmp( l_1.Walls().EastRow(0), l_2.Walls().EastRow(0),
+                   words * sizeof(uint64_t) ) != 0 ||
+      std::memcmp( l_1.Walls().SouthRow(0), l_2.Walls().SouthRow(0),
+                   words * sizeof(uint64_t) ) != 0 ||
+      std::memcmp( l_1.Cells(), l_2.Cells(), rooms ) != 0 )
+  {
+    return false;
+  }
+
+  return s_1.Position() == s_2.Position() &&
+         s_1.Bullets() == s_2.Bullets() && s_1.Lives() == s_2.Lives() &&
+         s_1.HasTreasure() == s_2.HasTreasure() &&
+         s_1.State() == s_2.State() && s_1.Steps() == s_2.Steps();
+}
+
+// This local function plays random actions, restarting the game whenever
+// it ends.
+void PlayRandomly( JournaledGame& game,
+                   RandomGenerator& rng,
+                   const size_t actions )
+{
+  const Direction directions[] = { Direction::kNorth, Direction::kEast,
+                                   Direction::kSouth, Direction::kWest };
+  for( size_t i = 0; i < actions; ++i )
+  {
+    switch( game.Session().State() )
+    {
+      case SessionState::kExploring:
+        game.Move( directions[rng.Below(4)] );
+        break;
+
+      case SessionState::kEncounter:
+        if( rng.Bit() )
+        {
+          game.Shoot();
+        }
+        else
+        {
+          game.HoldFire();
+        }
+        break;
+
+      default:
+        game.Restart();
+        break;
+    }
+  }
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING COMMAND_JOURNAL.CPP, JOURNALED_GAME.CPP, AND "
+            << "JOURNAL_REPLAYER.CPP IMPLEMENTATIONS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Recording a game of a 4 x 2 level:" << std::endl;
+  JournaledGame game( 4, 2, 0 );
+  BuildLevel( game );
+  game.Restart();
+  const size_t setup_commands = game.Journal().Size();
+  std::cout << "  Setup commands (should be 16): " << setup_commands
+            << std::endl;
+
+  const size_t bytes_before = game.Journal().ByteSize();
+  const SessionStatus wall = game.Move( Direction::kNorth );
+  std::cout << "  Moving into a Wall is not recorded (should be 1): "
+            << ( wall == SessionStatus::kWall &&
+                 game.Journal().Size() == setup_commands ) << std::endl;
+  try
+  {
+    game.SetItem( Coordinate(1, 0), Item::kBullet );
+    std::cout << "  Error: No exception was thrown for a second Item."
+              << std::endl;
+  }
+  catch( const std::logic_error& e )
+  {
+    std::cout << "  A call which throws is not recorded (should be 1): "
+              << ( game.Journal().Size() == setup_commands ) << std::endl;
+  }
+
+  game.Move( Direction::kEast );
+  std::cout << "  A Move takes one byte (should be 1): "
+            << ( game.Journal().ByteSize() == bytes_before + 1 )
+            << std::endl;
+  game.Move( Direction::kEast );
+  game.Shoot();
+  game.Move( Direction::kEast );
+  game.Move( Direction::kSouth );
+  game.Move( Direction::kNorth );
+  game.Move( Direction::kEast );
+  std::cout << "  Game won (should be 1): "
+            << ( game.Session().State() == SessionState::kWon )
+            << std::endl
+            << "  Commands (should be 23): " << game.Journal().Size()
+            << std::endl;
+
+  std::stringstream stream;
+  game.Journal().Write( stream );
+  const CommandJournal journal( stream );
+  std::cout << "  Same journal after writing and reading (should be 1): "
+            << ( journal.Size() == game.Journal().Size() &&
+                 journal.ByteSize() == game.Journal().ByteSize() &&
+                 journal.XSize() == 4 && journal.YSize() == 2 &&
+                 journal.Bullets() == 0 ) << std::endl;
+
+  size_t offset = 0;
+  const JournalEntry first = journal.Decode( offset );
+  std::cout << "  First command (should be 1): "
+            << ( first.command == JournalCommand::kConnectRooms &&
+                 first.room == Coordinate(0, 0) &&
+                 first.direction == Direction::kEast && offset == 3 )
+            << std::endl;
+
+  JournalReplayer replay( journal, 4 );
+  replay.Seek( journal.Size() );
+  std::cout << "  Same game after replaying (should be 1): "
+            << SameGame( replay.Level(), replay.Session(), game.Level(),
+                         game.Session() ) << std::endl;
+
+  replay.Seek( setup_commands + 2 );
+  std::cout << "  Encounter with the Mirror at step 18 (should be 1): "
+            << ( replay.Session().State() == SessionState::kEncounter &&
+                 replay.Session().Position() == Coordinate(2, 0) &&
+                 replay.Session().Bullets() == 1 &&
+                 replay.Level().ItemAt(Coordinate(1, 0)) == Item::kNone )
+            << std::endl;
+  replay.Seek( 0 );
+  std::cout << "  Empty Labyrinth at step 0 (should be 1): "
+            << ( !replay.Level().HasExit() &&
+                 replay.Level().DirectionCheck(Coordinate(0, 0),
+                                               Direction::kEast) ==
+                   RoomBorder::kWall ) << std::endl
+            << "  Snapshots (should be 6): " << replay.SnapshotCount()
+            << std::endl << std::endl;
+
+  std::cout << "Journaling a populated 24 x 24 maze:" << std::endl;
+  try
+  {
+    Labyrinth l( 24, 24 );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 2015 );
+    g.Generate( l );
+    l.SetExit( Coordinate(23, 23), Direction::kSouth );
+    l.SetSpawn1( Coordinate(0, 0) );
+    l.SetSpawn2( Coordinate(23, 0) );
+    RandomGenerator rng( 2015 );
+    LabyrinthPopulation population;
+    population.minotaurs = 40;
+    population.mirrors = 40;
+    population.bullets = 60;
+    population.treasure = true;
+    l.Populate( population, rng );
+
+    JournaledGame maze( l, 2 );
+    const size_t copy_commands = maze.Journal().Size();
+    JournalReplayer copy( maze.Journal() );
+    copy.Seek( copy_commands );
+    std::cout << "  Same level after replaying the copy (should be 1): "
+              << SameGame( copy.Level(), copy.Session(), l,
+                           maze.Session() ) << std::endl;
+
+    PlayRandomly( maze, rng, 5000 );
+    JournalReplayer seeker( maze.Journal(), 64 );
+    JournalReplayer linear( maze.Journal(), maze.Journal().Size() + 1 );
+    linear.Seek( maze.Journal().Size() );
+    std::cout << "  Same game after replaying random play (should be 1): "
+              << SameGame( linear.Level(), linear.Session(), maze.Level(),
+                           maze.Session() ) << std::endl;
+
+    // Seeking with snapshots must rebuild what replaying from the start
+    // rebuilds, wherever it seeks
+    bool same = true;
+    size_t most_replayed = 0;
+    for( size_t i = 0; i < 50; ++i )
+    {
+      const size_t step = rng.Below( maze.Journal().Size() + 1 );
+      const size_t replayed = seeker.CommandsReplayed();
+      const bool all_saved =
+        seeker.SnapshotCount() > maze.Journal().Size() / 64;
+      seeker.Seek( step );
+      if( all_saved )
+      {
+        most_replayed = std::max( most_replayed,
+                                  seeker.CommandsReplayed() - replayed );
+      }
+      JournalReplayer reference( maze.Journal(),
+                                 maze.Journal().Size() + 1 );
+      reference.Seek( step );
+      same &= seeker.Step() == step &&
+              SameGame( seeker.Level(), seeker.Session(),
+                        reference.Level(), reference.Session() );
+    }
+    std::cout << "  Same game at 50 random steps (should be 1): " << same
+              << std::endl
+              << "  At most 63 commands per seek once every snapshot is "
+              << "saved (should be 1): " << ( most_replayed <= 63 )
+              << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  Error: An exception was thrown:" << std::endl
+              << "    " << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  try
+  {
+    std::stringstream not_a_journal( "LABYROW1 and then some bytes" );
+    CommandJournal invalid( not_a_journal );
+    std::cout << "  Error: No exception was thrown for a stream which is "
+              << "not a journal." << std::endl;
+  }
+  catch( const std::runtime_error& e )
+  {
+    std::cout << "  Stream which is not a journal (should be an error):"
+              << std::endl
+              << "    " << e.what();
+  }
+
+  try
+  {
+    std::stringstream full;
+    journal.Write( full );
+    const std::string bytes = full.str();
+    // A TakeItem command without its Room
+    std::stringstream truncated(
+      bytes + char(JournalCommand::kTakeItem) );
+    CommandJournal invalid( truncated );
+    std::cout << "  Error: No exception was thrown for a journal which "
+              << "ends in the middle of a command." << std::endl;
+  }
+  catch( const std::runtime_error& e )
+  {
+    std::cout << "  Journal which ends in a command (should be an error):"
+              << std::endl
+              << "    " << e.what();
+  }
+
+  try
+  {
+    CommandJournal invalid( 4, 2, 1 );
+    JournalEntry entry;
+    entry.command = JournalCommand::kTakeItem;
+    entry.room = Coordinate( 4, 0 );
+    invalid.Append( entry );
+    std::cout << "  Error: No exception was thrown for a Room outside the "
+              << "Labyrinth." << std::endl;
+  }
+  catch( const std::domain_error& e )
+  {
+    std::cout << "  Room outside the Labyrinth (should be an error):"
+              << std::endl
+              << "    " << e.what();
+  }
+
+  try
+  {
+    JournaledGame invalid( 4, 2 );
+    invalid.Apply( first );
+    invalid.Apply( first );
+    std::cout << "  Error: No exception was thrown for a command which "
+              << "cannot be replayed." << std::endl;
+  }
+  catch( const std::logic_error& e )
+  {
+    std::cout << "  Command which cannot be replayed (should be an error):"
+              << std::endl
+              << "    " << e.what();
+  }
+
+  try
+  {
+    replay.Seek( journal.Size() + 1 );
+    std::cout << "  Error: No exception was thrown for a step beyond the "
+              << "journal." << std::endl;
+  }
+  catch( const std::out_of_range& e )
+  {
+    std::cout << "  Step beyond the journal (should be an error):"
+              << std::endl
+              << "    " << e.what();
+  }
+
+  try
+  {
+    game.Restore( game.Save() );
+    std::cout << "  Error: No exception was thrown for restoring a game "
+              << "which is recording." << std::endl;
+  }
+  catch( const std::logic_error& e )
+  {
+    std::cout << "  Restoring a game which is recording (should be an "
+              << "error):" << std::endl
+              << "    " << e.what();
+  }
+
+  try
+  {
+    JournalReplayer invalid( journal, 0 );
+    std::cout << "  Error: No exception was thrown for a snapshot interval "
+              << "of 0." << std::endl;
+  }
+  catch( const std::invalid_argument& e )
+  {
+    std::cout << "  Snapshot interval of 0 (should be an error):"
+              << std::endl
+              << "    " << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
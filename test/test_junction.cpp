@@ -0,0 +1,304 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the JunctionGraph class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/labyrinth_status.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/junction_graph.hpp"
+
+#include "path_checks.hpp"
+
+namespace
+{
+
+// This local function returns the number of random pairs of Rooms whose
+// path from the JunctionGraph is wrong, as counted by CountWrongPathsOf().
+size_t CountWrongPaths( const Labyrinth& l,
+                        JunctionGraph& j,
+                        const size_t pairs,
+                        const uint64_t seed );
+
+// This local function breaks random Walls of the Labyrinth one at a
+// time, updating the JunctionGraph after each, and returns the number of
+// Walls broken.
+size_t BreakRandomWalls( Labyrinth& l,
+                         JunctionGraph& j,
+                         const size_t attempts,
+                         const uint64_t seed );
+
+// This local function returns the number of random pairs of Rooms whose
+// path from the JunctionGraph is wrong, as counted by CountWrongPathsOf().
+size_t CountWrongPaths( const Labyrinth& l,
+                        JunctionGraph& j,
+                        const size_t pairs,
+                        const uint64_t seed )
+{
+  return CountWrongPathsOf( l, pairs, seed,
+    [&]( const Coordinate from, const Coordinate to )
+      -> const std::vector<Coordinate>&
+    {
+      return j.Path( from, to );
+    } );
+}
+
+// This local function breaks random Walls of the Labyrinth one at a
+// time, updating the JunctionGraph after each, and returns the number of
+// Walls broken.
+size_t BreakRandomWalls( Labyrinth& l,
+                         JunctionGraph& j,
+                         const size_t attempts,
+                         const uint64_t seed )
+{
+  RandomGenerator rng( seed );
+  size_t broken = 0;
+  for( size_t i = 0; i < attempts; ++i )
+  {
+    const Coordinate rm_1( rng.Below(l.XSize()), rng.Below(l.YSize()) );
+    const Coordinate rm_2 = rng.Below( 2 ) == 0 ?
+      Coordinate( rm_1.x + 1, rm_1.y ) :
+      Coordinate( rm_1.x, rm_1.y + 1 );
+    if( l.TryConnectRooms(rm_1, rm_2) == LabyrinthStatus::kOk )
+    {
+      j.Update( rm_1, rm_2 );
+      ++broken;
+    }
+  }
+  return broken;
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING JUNCTION_GRAPH.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  // The 3 x 3 Labyrinth used below:
+  //   (0, 0) - (1, 0) - (2, 0)
+  //                       |
+  //   (0, 1) - (1, 1) - (2, 1)
+  //     |
+  //   (0, 2) - (1, 2)   (2, 2)
+  Labyrinth l( 3, 3 );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  l.ConnectRooms( Coordinate(2, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 1), Coordinate(0, 2) );
+  l.ConnectRooms( Coordinate(0, 2), Coordinate(1, 2) );
+  l.SetExit( Coordinate(0, 0), Direction::kWest );
+
+  std::cout << "Indexing a 3 x 3 Labyrinth made of one corridor:"
+            << std::endl;
+  JunctionGraph j( &l );
+  std::cout << "  Nodes (should be 3): " << j.NodeCount() << std::endl
+            << "  Edges (should be 1): " << j.EdgeCount() << std::endl
+            << std::endl;
+
+  std::cout << "Finding a path from (1, 0) to (0, 2):" << std::endl;
+  const std::vector<Coordinate>& path = j.Path( Coordinate(1, 0),
+                                                Coordinate(0, 2) );
+  std::cout << "  Path:";
+  for( const Coordinate c : path )
+  {
+    std::cout << " (" << c.x << ", " << c.y << ")";
+  }
+  std::cout << std::endl
+            << "  Rooms in the path (should be 6): " << path.size()
+            << std::endl
+            << "  The path is walkable (should be 1): " << IsWalkable(l, path)
+            << std::endl
+            << "  Nodes expanded (should be 1): " << j.ExpandedCount()
+            << std::endl << std::endl;
+
+  std::cout << "Finding a path from (1, 2) to (0, 0):" << std::endl;
+  j.Path( Coordinate(1, 2), Coordinate(0, 0) );
+  std::cout << "  Rooms in the path (should be 8): " << path.size()
+            << std::endl
+            << "  The path is walkable (should be 1): " << IsWalkable(l, path)
+            << std::endl << std::endl;
+
+  std::cout << "Finding a path from (0, 0) to (2, 2), which cannot be "
+            << "reached:" << std::endl;
+  j.Path( Coordinate(0, 0), Coordinate(2, 2) );
+  std::cout << "  Rooms in the path (should be 0): " << path.size()
+            << std::endl << std::endl;
+
+  std::cout << "Connecting (1, 1) to (1, 2) and updating:" << std::endl;
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(1, 2) );
+  j.Update( Coordinate(1, 1), Coordinate(1, 2) );
+  std::cout << "  Nodes (should be 3): " << j.NodeCount() << std::endl
+            << "  Edges (should be 2): " << j.EdgeCount() << std::endl;
+  j.Path( Coordinate(1, 0), Coordinate(1, 2) );
+  std::cout << "  Rooms in the path from (1, 0) to (1, 2) (should be 5): "
+            << path.size() << std::endl
+            << "  The path is walkable (should be 1): " << IsWalkable(l, path)
+            << std::endl << std::endl;
+
+  std::cout << "Indexing a 2 x 2 Labyrinth made of one loop:" << std::endl;
+  Labyrinth l_loop( 2, 2 );
+  l_loop.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l_loop.ConnectRooms( Coordinate(1, 0), Coordinate(1, 1) );
+  l_loop.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+  l_loop.ConnectRooms( Coordinate(0, 1), Coordinate(0, 0) );
+  JunctionGraph j_loop( &l_loop );
+  std::cout << "  Nodes (should be 1): " << j_loop.NodeCount() << std::endl
+            << "  Edges (should be 1): " << j_loop.EdgeCount() << std::endl
+            << "  Rooms in the path from (1, 0) to (0, 1) (should be 3): "
+            << j_loop.Path( Coordinate(1, 0), Coordinate(0, 1) ).size()
+            << std::endl
+            << "  Wrong paths, of 50 (should be 0): "
+            << CountWrongPaths( l_loop, j_loop, 50, 1 )
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING AGAINST DISTANCE FIELDS:"
+            << std::endl << std::endl;
+
+  Labyrinth l_maze( 80, 60 );
+  MazeGenerator g( MazeAlgorithm::kPrim, 2015 );
+  g.Generate( l_maze );
+  JunctionGraph j_maze( &l_maze );
+  std::cout << "  Nodes of an 80 x 60 maze are fewer than its Rooms "
+            << "(should be 1): " << ( j_maze.NodeCount() < 80 * 60 )
+            << std::endl
+            << "  Wrong paths in the maze, of 300 (should be 0): "
+            << CountWrongPaths( l_maze, j_maze, 300, 2 ) << std::endl;
+
+  RandomGenerator rng( 3 );
+  Labyrinth l_caves( 70, 50 );
+  for( size_t y = 0; y < 50; ++y )
+  {
+    for( size_t x = 0; x < 70; ++x )
+    {
+      if( x + 1 < 70 && rng.Below(5) < 3 )
+      {
+        l_caves.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 50 && rng.Below(5) < 3 )
+      {
+        l_caves.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  JunctionGraph j_caves( &l_caves );
+  std::cout << "  Wrong paths in 70 x 50 caves, of 300 (should be 0): "
+            << CountWrongPaths( l_caves, j_caves, 300, 4 ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING UPDATES:"
+            << std::endl << std::endl;
+
+  std::cout << "Breaking Walls of the maze one at a time:" << std::endl;
+  size_t broken = BreakRandomWalls( l_maze, j_maze, 400, 5 );
+  std::cout << "  Walls broken (should be more than 0): " << broken
+            << std::endl
+            << "  Wrong paths, of 300 (should be 0): "
+            << CountWrongPaths( l_maze, j_maze, 300, 6 ) << std::endl;
+  const size_t updated_edges = j_maze.EdgeCount();
+  j_maze.Rebuild();
+  std::cout << "  Wrong paths after Rebuild(), of 300 (should be 0): "
+            << CountWrongPaths( l_maze, j_maze, 300, 6 ) << std::endl
+            << "  Same number of edges as the updates (should be 1): "
+            << ( updated_edges == j_maze.EdgeCount() ) << std::endl
+            << std::endl;
+
+  std::cout << "Breaking Walls of a closed 40 x 30 Labyrinth one at a time:"
+            << std::endl;
+  Labyrinth l_closed( 40, 30 );
+  JunctionGraph j_closed( &l_closed );
+  std::cout << "  Nodes before (should be 1200): " << j_closed.NodeCount()
+            << std::endl;
+  size_t wrong = 0;
+  for( uint64_t round = 0; round < 10; ++round )
+  {
+    BreakRandomWalls( l_closed, j_closed, 300, 10 + round );
+    wrong += CountWrongPaths( l_closed, j_closed, 50, 20 + round );
+  }
+  std::cout << "  Wrong paths over 10 rounds of updates, of 500 "
+            << "(should be 0): " << wrong << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  std::cout << "Indexing a null Labyrinth (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    JunctionGraph j_null( nullptr );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Finding a path to a Room outside the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    j.Path( Coordinate(0, 0), Coordinate(3, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Updating a Room outside the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    j.Update( Coordinate(2, 2), Coordinate(2, 3) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -1,7 +1,7 @@
 /*
  *
  * Author: Jeffrey Leung
- * Last edited: 2016-01-15
+ * Last edited: 2026-10-18
  *
  * This C++ file tests the Labyrinth class implementation.
  *
@@ -13,6 +13,9 @@
 
 #include "../include/room_properties.hpp"
 #include "../include/coordinate.hpp"
+#include "../include/labyrinth_layout.hpp"
+#include "../include/labyrinth_population.hpp"
+#include "../include/random_generator.hpp"
 #include "../include/labyrinth.hpp"
 
 int main()
@@ -212,6 +215,233 @@ int main()
 
 
 
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING NON-THROWING METHODS:"
+            << std::endl << std::endl;
+
+  std::cout << "Status codes are printed as integers (0 is kOk)."
+            << std::endl << std::endl;
+
+  std::cout << "Connecting already-connected rooms (0, 0) and (1, 0) "
+            << "(kAlreadyConnected, 9): "
+            << static_cast<int>( l1.TryConnectRooms(c_0_0, c_1_0) )
+            << std::endl;
+  std::cout << "Connecting non-adjacent rooms (0, 0) and (2, 1) "
+            << "(kNotAdjacent, 7): "
+            << static_cast<int>( l1.TryConnectRooms(c_0_0, c_2_1) )
+            << std::endl;
+  std::cout << "Connecting adjacent rooms (1, 1) and (2, 1) (kOk, 0): "
+            << static_cast<int>( l1.TryConnectRooms(c_1_1, c_2_1) )
+            << std::endl;
+  std::cout << "Taking an Item from empty room (2, 1) (kNoItem, 14): "
+            << static_cast<int>( l1.TryTakeItem(c_2_1) )
+            << std::endl;
+  std::cout << "Checking the border west of room (2, 1) "
+            << "(kOk, 0; kRoom, 1): ";
+  const auto rb = l1.TryDirectionCheck( c_2_1, Direction::kWest );
+  std::cout << static_cast<int>( rb.status ) << "; "
+            << static_cast<int>( rb.value ) << std::endl;
+  std::cout << "Checking the Inhabitant of room (3, 0) "
+            << "(kOutOfBounds, 1): "
+            << static_cast<int>( l1.TryGetInhabitant(Coordinate(3, 0)).status )
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING CONSTRUCTION FROM A LABYRINTHLAYOUT:"
+            << std::endl << std::endl;
+
+  // A 3 x 2 snake: (0, 0) - (0, 1) - (1, 1) - (1, 0) - (2, 0) - (2, 1)
+  LabyrinthLayout layout;
+  layout.x_size = 3;
+  layout.y_size = 2;
+  layout.east_walls  = { 0x5, 0x6 };  // Rows 0 and 1 (bits are x)
+  layout.south_walls = { 0x0, 0x7 };
+  layout.inhabitants = { Inhabitant::kMinotaur, Inhabitant::kNone,
+                         Inhabitant::kNone, Inhabitant::kNone,
+                         Inhabitant::kNone, Inhabitant::kMirror };
+  layout.items = { Item::kNone, Item::kBullet, Item::kNone,
+                   Item::kNone, Item::kTreasure, Item::kNone };
+
+  std::cout << "Creating a 3 x 2 snake Labyrinth from a layout." << std::endl;
+  try
+  {
+    Labyrinth l_layout( layout );
+    std::cout << "Completed." << std::endl
+              << "  (0, 0) opens south (should be 1): "
+              << ( l_layout.DirectionCheck( c_0_0, Direction::kSouth ) ==
+                   RoomBorder::kRoom ) << std::endl
+              << "  (0, 0) opens east (should be 0): "
+              << ( l_layout.DirectionCheck( c_0_0, Direction::kEast ) ==
+                   RoomBorder::kRoom ) << std::endl
+              << "  (1, 0) opens south (should be 1): "
+              << ( l_layout.DirectionCheck( c_1_0, Direction::kSouth ) ==
+                   RoomBorder::kRoom ) << std::endl
+              << "  (1, 1) opens north (should be 1): "
+              << ( l_layout.DirectionCheck( c_1_1, Direction::kNorth ) ==
+                   RoomBorder::kRoom ) << std::endl
+              << "  (2, 1) opens north (should be 1): "
+              << ( l_layout.DirectionCheck( c_2_1, Direction::kNorth ) ==
+                   RoomBorder::kRoom ) << std::endl
+              << "  (0, 0) has a Minotaur (should be 1): "
+              << ( l_layout.GetInhabitant( c_0_0 ) == Inhabitant::kMinotaur )
+              << std::endl
+              << "  (1, 1) has the Treasure (should be 1): "
+              << ( l_layout.ItemAt( c_1_1 ) == Item::kTreasure )
+              << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Creating a Labyrinth from a layout missing an outer Wall "
+            << "(An error should be thrown):" << std::endl;
+  layout.east_walls[1] = 0x2;
+  try
+  {
+    Labyrinth l_layout( layout );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating a Labyrinth from a layout with two Treasures "
+            << "(An error should be thrown):" << std::endl;
+  layout.east_walls[1] = 0x6;
+  layout.items[0] = Item::kTreasure;
+  try
+  {
+    Labyrinth l_layout( layout );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING POPULATE():"
+            << std::endl << std::endl;
+
+  Labyrinth l_pop( 10, 10 );
+  l_pop.SetSpawn1( Coordinate(0, 0) );
+  l_pop.SetSpawn2( Coordinate(9, 9) );
+  l_pop.SetExit( Coordinate(5, 0), Direction::kNorth );
+  std::cout << "Setting the exit to the north of (5, 0):" << std::endl
+            << "  Exit Room and direction (should be 1): "
+            << ( l_pop.ExitRoom() == Coordinate(5, 0) &&
+                 l_pop.ExitDirection() == Direction::kNorth ) << std::endl
+            << std::endl;
+
+  LabyrinthPopulation population;
+  population.minotaurs = 10;
+  population.mirrors = 5;
+  population.bullets = 20;
+  population.treasure = true;
+  population.exclusion_radius = 1;
+  population.exclude_spawns = true;
+  population.exclude_exit = true;
+
+  // Counts the contents of l_pop, and those inside the exclusion zones
+  // (the 2 x 2 corners at the spawns and the 3 x 2 area at the exit)
+  const auto count_contents = [&l_pop]( size_t& inhabitants,
+                                        size_t& items,
+                                        size_t& excluded )
+  {
+    inhabitants = 0;
+    items = 0;
+    excluded = 0;
+    for( size_t y = 0; y < 10; ++y )
+    {
+      for( size_t x = 0; x < 10; ++x )
+      {
+        const Coordinate c(x, y);
+        const bool filled = l_pop.GetInhabitant(c) != Inhabitant::kNone ||
+                            l_pop.ItemAt(c) != Item::kNone;
+        inhabitants += ( l_pop.GetInhabitant(c) != Inhabitant::kNone );
+        items += ( l_pop.ItemAt(c) != Item::kNone );
+        excluded += filled && ( ( x <= 1 && y <= 1 ) ||
+                                ( x >= 8 && y >= 8 ) ||
+                                ( x >= 4 && x <= 6 && y <= 1 ) );
+      }
+    }
+  };
+
+  std::cout << "Populating a 10 x 10 Labyrinth with 10 Minotaurs, 5 Mirrors, "
+            << "20 Bullets, and the Treasure, keeping 1 Room clear around "
+            << "the spawns and exit." << std::endl;
+  RandomGenerator rng( 2015 );
+  size_t inhabitants = 0;
+  size_t items = 0;
+  size_t excluded = 0;
+  try
+  {
+    l_pop.Populate( population, rng );
+    count_contents( inhabitants, items, excluded );
+    std::cout << "Completed." << std::endl
+              << "  Inhabitants placed (should be 15): " << inhabitants
+              << std::endl
+              << "  Items placed (should be 21): " << items << std::endl
+              << "  Rooms filled in the exclusion zones (should be 0): "
+              << excluded << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Populating the Labyrinth with the Treasure again "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    l_pop.Populate( population, rng );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Populating the Labyrinth with 80 more Minotaurs, for which "
+            << "there is no room (An error should be thrown):" << std::endl;
+  population.treasure = false;
+  population.minotaurs = 80;
+  population.mirrors = 0;
+  population.bullets = 0;
+  try
+  {
+    l_pop.Populate( population, rng );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  count_contents( inhabitants, items, excluded );
+  std::cout << "Done." << std::endl
+            << "  Inhabitants (should still be 15): " << inhabitants
+            << std::endl << std::endl;
+
+  std::cout << "Populating the Labyrinth with 70 more Minotaurs." << std::endl;
+  population.minotaurs = 70;
+  l_pop.Populate( population, rng );
+  count_contents( inhabitants, items, excluded );
+  std::cout << "  Inhabitants (should be 85): " << inhabitants << std::endl
+            << "  Rooms filled in the exclusion zones (should be 0): "
+            << excluded << std::endl << std::endl;
+
+
+
   std::cout << "________________________________________________" << std::endl;
   std::cout << std::endl;
   std::cout << "All tests completed." << std::endl;
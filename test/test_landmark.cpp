@@ -0,0 +1,269 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the LandmarkIndex class implementation, and paths
+ * found by a PathFinder guided by one.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/landmark_index.hpp"
+#include "../include/path_finder.hpp"
+
+#include "path_checks.hpp"
+
+namespace
+{
+
+// This local function returns the number of Rooms whose distance from a
+// landmark in the index differs from a DistanceField of the landmark.
+size_t CountWrongDistances( const Labyrinth& l, const LandmarkIndex& index );
+
+// This local function returns the number of random pairs of Rooms whose
+// landmark-guided path is wrong, as counted by CountWrongPathsOf(), and
+// adds the Rooms expanded with and without the landmarks to the totals.
+size_t CountWrongPaths( const Labyrinth& l,
+                        const LandmarkIndex& index,
+                        const size_t pairs,
+                        const uint64_t seed,
+                        size_t& guided_expanded,
+                        size_t& plain_expanded );
+
+// This local function returns the number of Rooms whose distance from a
+// landmark in the index differs from a DistanceField of the landmark.
+size_t CountWrongDistances( const Labyrinth& l, const LandmarkIndex& index )
+{
+  DistanceField f;
+  const size_t count = index.LandmarkCount();
+  const size_t rooms = l.XSize() * l.YSize();
+  size_t wrong = 0;
+  for( size_t k = 0; k < count; ++k )
+  {
+    f.Compute( l, index.Landmark(k) );
+    for( size_t i = 0; i < rooms; ++i )
+    {
+      wrong += index.Distances()[i * count + k] != f.Distances()[i];
+    }
+  }
+  return wrong;
+}
+
+// This local function returns the number of random pairs of Rooms whose
+// landmark-guided path is wrong, as counted by CountWrongPathsOf(), and
+// adds the Rooms expanded with and without the landmarks to the totals.
+size_t CountWrongPaths( const Labyrinth& l,
+                        const LandmarkIndex& index,
+                        const size_t pairs,
+                        const uint64_t seed,
+                        size_t& guided_expanded,
+                        size_t& plain_expanded )
+{
+  PathFinder p;
+  return CountWrongPathsOf( l, pairs, seed,
+    [&]( const Coordinate from, const Coordinate to )
+      -> const std::vector<Coordinate>&
+    {
+      p.Path( l, from, to );
+      plain_expanded += p.ExpandedCount();
+      const std::vector<Coordinate>& path = p.Path( l, index, from, to );
+      guided_expanded += p.ExpandedCount();
+      return path;
+    } );
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LANDMARK_INDEX.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  // The 3 x 3 Labyrinth used below, of two parts:
+  //   (0, 0) - (1, 0) - (2, 0)
+  //                       |
+  //   (0, 1) - (1, 1) - (2, 1)
+  //
+  //   (0, 2) - (1, 2) - (2, 2)
+  Labyrinth l( 3, 3 );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  l.ConnectRooms( Coordinate(2, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 2), Coordinate(1, 2) );
+  l.ConnectRooms( Coordinate(1, 2), Coordinate(2, 2) );
+
+  LandmarkIndex index;
+  std::cout << "Before building:" << std::endl
+            << "  Landmarks (should be 0): " << index.LandmarkCount()
+            << std::endl
+            << "  Distances are null (should be 1): "
+            << ( index.Distances() == nullptr ) << std::endl << std::endl;
+
+  std::cout << "Building 3 landmarks in a 3 x 3 Labyrinth of two parts:"
+            << std::endl;
+  index.Build( l, 3 );
+  std::cout << "  Landmarks (should be 3): " << index.LandmarkCount()
+            << std::endl;
+  for( size_t k = 0; k < index.LandmarkCount(); ++k )
+  {
+    const Coordinate c = index.Landmark( k );
+    std::cout << "  Landmark " << k << ": (" << c.x << ", " << c.y << ")"
+              << std::endl;
+  }
+  std::cout << "  First landmark (should be (0, 0)): ("
+            << index.Landmark(0).x << ", " << index.Landmark(0).y << ")"
+            << std::endl
+            << "  Second landmark is in the lower part (should be 1): "
+            << ( index.Landmark(1).y == 2 ) << std::endl
+            << "  Wrong distances (should be 0): "
+            << CountWrongDistances( l, index ) << std::endl
+            << "  Memory holds every distance (should be 1): "
+            << ( index.MemoryUsage() >= 9 * 3 * sizeof(uint32_t) )
+            << std::endl << std::endl;
+
+  PathFinder p;
+  std::cout << "Finding a path between the two parts:" << std::endl;
+  const std::vector<Coordinate>& path = p.Path( l, index, Coordinate(0, 0),
+                                                Coordinate(2, 2) );
+  std::cout << "  Rooms in the path (should be 0): " << path.size()
+            << std::endl
+            << "  Rooms expanded (should be 0): " << p.ExpandedCount()
+            << std::endl << std::endl;
+
+  std::cout << "Finding a path from (0, 0) to (0, 1):" << std::endl;
+  p.Path( l, index, Coordinate(0, 0), Coordinate(0, 1) );
+  std::cout << "  Rooms in the path (should be 6): " << path.size()
+            << std::endl
+            << "  Rooms expanded (should be 5): " << p.ExpandedCount()
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING AGAINST DISTANCE FIELDS:"
+            << std::endl << std::endl;
+
+  Labyrinth l_maze( 80, 60 );
+  MazeGenerator g( MazeAlgorithm::kRecursiveBacktracker, 2015 );
+  g.Generate( l_maze );
+  index.Build( l_maze, 8 );
+  size_t guided = 0;
+  size_t plain = 0;
+  std::cout << "  Wrong distances in an 80 x 60 maze (should be 0): "
+            << CountWrongDistances( l_maze, index ) << std::endl
+            << "  Wrong paths in the maze, of 300 (should be 0): "
+            << CountWrongPaths( l_maze, index, 300, 1, guided, plain )
+            << std::endl
+            << "  Fewer Rooms expanded with landmarks (should be 1): "
+            << ( guided < plain ) << std::endl;
+
+  RandomGenerator rng( 2 );
+  Labyrinth l_caves( 70, 50 );
+  for( size_t y = 0; y < 50; ++y )
+  {
+    for( size_t x = 0; x < 70; ++x )
+    {
+      if( x + 1 < 70 && rng.Below(5) < 2 )
+      {
+        l_caves.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 50 && rng.Below(5) < 2 )
+      {
+        l_caves.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  index.Build( l_caves, 5 );
+  std::cout << "  Wrong paths in 70 x 50 caves of many parts, of 300 "
+            << "(should be 0): "
+            << CountWrongPaths( l_caves, index, 300, 3, guided, plain )
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  std::cout << "Building 0 landmarks (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    index.Build( l, 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Building 17 landmarks (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    index.Build( l, LandmarkIndex::kMaxLandmarks + 1 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "  The index is unchanged (should be 5): "
+            << index.LandmarkCount() << std::endl << std::endl;
+
+  std::cout << "Getting landmark 5 of 5 (An error should be thrown):"
+            << std::endl;
+  try
+  {
+    index.Landmark( 5 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Finding a path with the index of another Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    p.Path( l, index, Coordinate(0, 0), Coordinate(1, 1) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the RowMajorLayout and MortonLayout classes and the
+ * PackedCoordinate struct.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/coordinate.hpp"
+#include "../include/packed_coordinate.hpp"
+#include "../include/room_layout.hpp"
+
+namespace
+{
+
+// This local function returns true if every Room of the grid has its own
+// index below the capacity, At() undoes Index(), and the neighbours of
+// every Room are found at their own indices; and false otherwise.
+template <typename Layout>
+bool Consistent( const Layout& layout,
+                 const uint32_t x_size,
+                 const uint32_t y_size );
+
+// This local function returns true if every Room of the grid has its own
+// index below the capacity, At() undoes Index(), and the neighbours of
+// every Room are found at their own indices; and false otherwise.
+template <typename Layout>
+bool Consistent( const Layout& layout,
+                 const uint32_t x_size,
+                 const uint32_t y_size )
+{
+  std::vector<bool> used( layout.Capacity(), false );
+  for( uint32_t y = 0; y < y_size; ++y )
+  {
+    for( uint32_t x = 0; x < x_size; ++x )
+    {
+      const size_t i = layout.Index( x, y );
+      if( i >= layout.Capacity() || used[i] ||
+          !(layout.At(i) == PackedCoordinate(x, y)) )
+      {
+        return false;
+      }
+      used[i] = true;
+
+      if( ( x + 1 < x_size && layout.East(i) != layout.Index(x + 1, y) ) ||
+          ( y + 1 < y_size && layout.South(i) != layout.Index(x, y + 1) ) ||
+          ( x > 0 && layout.West(i) != layout.Index(x - 1, y) ) ||
+          ( y > 0 && layout.North(i) != layout.Index(x, y - 1) ) )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING ROOM_LAYOUT.HPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Packing Coordinates:" << std::endl;
+  const PackedCoordinate c( Coordinate(70, 3) );
+  std::cout << "  Size in bytes (should be 8): " << sizeof(PackedCoordinate)
+            << std::endl
+            << "  (70, 3) is kept (should be 1): "
+            << ( c.ToCoordinate() == Coordinate(70, 3) ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ROWMAJORLAYOUT:"
+            << std::endl << std::endl;
+
+  const RowMajorLayout r( 5, 3 );
+  std::cout << "  Capacity of 5 x 3 (should be 15): " << r.Capacity()
+            << std::endl
+            << "  Index of (2, 1) (should be 7): " << r.Index( 2, 1 )
+            << std::endl
+            << "  Consistent in 5 x 3 (should be 1): "
+            << Consistent( r, 5, 3 ) << std::endl
+            << "  Consistent in 70 x 33 (should be 1): "
+            << Consistent( RowMajorLayout(70, 33), 70, 33 ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING MORTONLAYOUT:"
+            << std::endl << std::endl;
+
+  const MortonLayout m( 4, 4 );
+  std::cout << "  Capacity of 4 x 4 (should be 16): " << m.Capacity()
+            << std::endl
+            << "  Index of (1, 0) (should be 1): " << m.Index( 1, 0 )
+            << std::endl
+            << "  Index of (0, 1) (should be 2): " << m.Index( 0, 1 )
+            << std::endl
+            << "  Index of (3, 3) (should be 15): " << m.Index( 3, 3 )
+            << std::endl
+            << "  Index of (2, 1) (should be 6): " << m.Index( 2, 1 )
+            << std::endl
+            << "  Capacity of 5 x 3 (should be 32): "
+            << MortonLayout( 5, 3 ).Capacity() << std::endl
+            << "  Capacity of 1 x 1 (should be 1): "
+            << MortonLayout( 1, 1 ).Capacity() << std::endl
+            << "  Consistent in 4 x 4 (should be 1): "
+            << Consistent( m, 4, 4 ) << std::endl
+            << "  Consistent in 5 x 3 (should be 1): "
+            << Consistent( MortonLayout(5, 3), 5, 3 ) << std::endl
+            << "  Consistent in 3 x 70 (should be 1): "
+            << Consistent( MortonLayout(3, 70), 3, 70 ) << std::endl
+            << "  Consistent in 70 x 33 (should be 1): "
+            << Consistent( MortonLayout(70, 33), 70, 33 ) << std::endl
+            << "  Consistent in 1 x 9 (should be 1): "
+            << Consistent( MortonLayout(1, 9), 1, 9 ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  std::cout << "Creating a MortonLayout of 2^32 x 2^32 Rooms (An error "
+            << "should be thrown):" << std::endl;
+  try
+  {
+    MortonLayout m_large( size_t(1) << 32, size_t(1) << 32 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
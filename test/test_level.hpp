@@ -0,0 +1,49 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ header file contains the small level which the game tests play.
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+
+// This function builds the level used by the game tests into a 4 x 2
+// Labyrinth, or anything else with the same methods to build a level:
+//   (0, 0) - (1, 0) - (2, 0) - (3, 0) -> exit to the east
+//     |                          |
+//   (0, 1) - (1, 1) - (2, 1) - (3, 1)
+// with the given eyes (a Mirror by default) in (2, 0), a Minotaur in
+// (2, 1), the Treasure in (3, 1), and a bullet in (1, 0) unless none is
+// requested. The spawns are (0, 0) and (0, 1).
+template <typename Level>
+void BuildLevel( Level& l,
+                 const Inhabitant eyes = Inhabitant::kMirror,
+                 const bool bullet = true )
+{
+  for( size_t y = 0; y < 2; ++y )
+  {
+    for( size_t x = 0; x < 3; ++x )
+    {
+      l.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+    }
+  }
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(3, 0), Coordinate(3, 1) );
+  l.SetExit( Coordinate(3, 0), Direction::kEast );
+  l.SetSpawn1( Coordinate(0, 0) );
+  l.SetSpawn2( Coordinate(0, 1) );
+  if( bullet )
+  {
+    l.SetItem( Coordinate(1, 0), Item::kBullet );
+  }
+  l.SetInhabitant( Coordinate(2, 0), eyes );
+  l.SetInhabitant( Coordinate(2, 1), Inhabitant::kMinotaur );
+  l.SetItem( Coordinate(3, 1), Item::kTreasure );
+}
@@ -0,0 +1,127 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the MazeGenerator class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_map.hpp"
+#include "../include/maze_generator.hpp"
+
+#include "maze_checks.hpp"
+
+namespace
+{
+
+// This local function generates a maze with the given algorithm and prints
+// whether it is perfect.
+void TestAlgorithm( const MazeAlgorithm algorithm, const char* const name );
+
+// This local function generates a maze with the given algorithm and prints
+// whether it is perfect.
+void TestAlgorithm( const MazeAlgorithm algorithm, const char* const name )
+{
+  std::cout << "Generating a 37 x 23 maze with " << name << ":" << std::endl;
+
+  Labyrinth l( 37, 23 );
+  MazeGenerator g( algorithm, 2015 );
+  g.Generate( l );
+  std::cout << "  Connections (should be 850): " << CountConnections(l)
+            << std::endl
+            << "  Rooms reachable from (0, 0) (should be 851): "
+            << CountReachable(l) << std::endl;
+
+  Labyrinth l_same( 37, 23 );
+  MazeGenerator g_same( algorithm, 2015 );
+  g_same.Generate( l_same );
+  std::cout << "  Same seed gives the same maze (should be 1): "
+            << SameWalls(l, l_same) << std::endl;
+
+  Labyrinth l_other( 37, 23 );
+  MazeGenerator g_other( algorithm, 2016 );
+  g_other.Generate( l_other );
+  std::cout << "  Another seed gives the same maze (should be 0): "
+            << SameWalls(l, l_other) << std::endl;
+
+  Labyrinth l_line( 1, 9 );
+  g.Generate( l_line );
+  std::cout << "  1 x 9 maze connections (should be 8): "
+            << CountConnections(l_line) << std::endl << std::endl;
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING MAZE_GENERATOR.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  TestAlgorithm( MazeAlgorithm::kRecursiveBacktracker,
+                 "the recursive backtracker" );
+  TestAlgorithm( MazeAlgorithm::kKruskal, "Kruskal's algorithm" );
+  TestAlgorithm( MazeAlgorithm::kPrim, "Prim's algorithm" );
+  TestAlgorithm( MazeAlgorithm::kWilson, "Wilson's algorithm" );
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING A GENERATED MAZE WITH AN EXIT:"
+            << std::endl << std::endl;
+
+  std::cout << "Generating a 6 x 4 maze with the exit already set east "
+            << "of (2, 1):" << std::endl;
+  Labyrinth l_exit( 6, 4 );
+  l_exit.SetExit( Coordinate(2, 1), Direction::kEast );
+  MazeGenerator g_exit( MazeAlgorithm::kRecursiveBacktracker, 7 );
+  g_exit.Generate( l_exit );
+  std::cout << "  East of (2, 1) is the exit (should be 1): "
+            << ( l_exit.DirectionCheck( Coordinate(2, 1), Direction::kEast )
+                 == RoomBorder::kExit ) << std::endl << std::endl;
+
+  LabyrinthMap m( &l_exit, 6, 4 );
+  m.Display();
+  std::cout << std::endl;
+
+
+
+  std::cout << "Generating with an invalid algorithm "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    Labyrinth l_invalid( 2, 2 );
+    MazeGenerator g_invalid( static_cast<MazeAlgorithm>(9), 0 );
+    g_invalid.Generate( l_invalid );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
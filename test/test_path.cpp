@@ -0,0 +1,215 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the PathFinder class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/path_finder.hpp"
+
+#include "path_checks.hpp"
+
+namespace
+{
+
+// This local function returns the number of random pairs of Rooms whose
+// path from the PathFinder is wrong, as counted by CountWrongPathsOf().
+size_t CountWrongPaths( const Labyrinth& l,
+                        PathFinder& p,
+                        const size_t pairs,
+                        const uint64_t seed );
+
+// This local function returns the number of random pairs of Rooms whose
+// path from the PathFinder is wrong, as counted by CountWrongPathsOf().
+size_t CountWrongPaths( const Labyrinth& l,
+                        PathFinder& p,
+                        const size_t pairs,
+                        const uint64_t seed )
+{
+  return CountWrongPathsOf( l, pairs, seed,
+    [&]( const Coordinate from, const Coordinate to )
+      -> const std::vector<Coordinate>&
+    {
+      return p.Path( l, from, to );
+    } );
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING PATH_FINDER.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  // The 3 x 3 Labyrinth used below:
+  //   (0, 0) - (1, 0) - (2, 0)
+  //                       |
+  //   (0, 1) - (1, 1) - (2, 1)
+  //
+  //   (0, 2) - (1, 2)   (2, 2)
+  Labyrinth l( 3, 3 );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  l.ConnectRooms( Coordinate(2, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 2), Coordinate(1, 2) );
+  l.SetExit( Coordinate(0, 0), Direction::kWest );
+
+  PathFinder p;
+  std::cout << "Finding a path from (0, 0) to (0, 1):" << std::endl;
+  const std::vector<Coordinate>& path = p.Path( l, Coordinate(0, 0),
+                                                Coordinate(0, 1) );
+  std::cout << "  Path:";
+  for( const Coordinate c : path )
+  {
+    std::cout << " (" << c.x << ", " << c.y << ")";
+  }
+  std::cout << std::endl
+            << "  Rooms in the path (should be 6): " << path.size()
+            << std::endl
+            << "  The path is walkable (should be 1): " << IsWalkable(l, path)
+            << std::endl << std::endl;
+
+  std::cout << "Finding a path from (1, 1) to itself:" << std::endl;
+  p.Path( l, Coordinate(1, 1), Coordinate(1, 1) );
+  std::cout << "  Rooms in the path (should be 1): " << path.size()
+            << std::endl << std::endl;
+
+  std::cout << "Finding a path from (0, 0) to (1, 2), which cannot be "
+            << "reached:" << std::endl;
+  p.Path( l, Coordinate(0, 0), Coordinate(1, 2) );
+  std::cout << "  Rooms in the path (should be 0): " << path.size()
+            << std::endl
+            << "  Rooms expanded (should be 6): " << p.ExpandedCount()
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING AGAINST DISTANCE FIELDS:"
+            << std::endl << std::endl;
+
+  Labyrinth l_maze( 80, 60 );
+  MazeGenerator g( MazeAlgorithm::kPrim, 2015 );
+  g.Generate( l_maze );
+  std::cout << "  Wrong paths in an 80 x 60 maze, of 300 (should be 0): "
+            << CountWrongPaths( l_maze, p, 300, 1 ) << std::endl;
+
+  RandomGenerator rng( 2 );
+  Labyrinth l_caves( 70, 50 );
+  for( size_t y = 0; y < 50; ++y )
+  {
+    for( size_t x = 0; x < 70; ++x )
+    {
+      if( x + 1 < 70 && rng.Below(5) < 3 )
+      {
+        l_caves.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 50 && rng.Below(5) < 3 )
+      {
+        l_caves.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  std::cout << "  Wrong paths in 70 x 50 caves, of 300 (should be 0): "
+            << CountWrongPaths( l_caves, p, 300, 3 ) << std::endl;
+
+  PathFinder p_morton( RoomOrder::kMorton );
+  std::cout << "  Wrong paths in the maze in Morton order, of 300 "
+            << "(should be 0): " << CountWrongPaths( l_maze, p_morton, 300, 1 )
+            << std::endl
+            << "  Wrong paths in the caves in Morton order, of 300 "
+            << "(should be 0): " << CountWrongPaths( l_caves, p_morton, 300, 3 )
+            << std::endl;
+
+  std::cout << "  Wrong paths in the 3 x 3 Labyrinth after reuse, of 50 "
+            << "(should be 0): " << CountWrongPaths( l, p, 50, 4 )
+            << std::endl << std::endl;
+
+  std::cout << "Finding a path across an open 100 x 100 Labyrinth:"
+            << std::endl;
+  Labyrinth l_open( 100, 100 );
+  for( size_t y = 0; y < 100; ++y )
+  {
+    for( size_t x = 0; x < 100; ++x )
+    {
+      if( x + 1 < 100 )
+      {
+        l_open.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 100 )
+      {
+        l_open.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  p.Path( l_open, Coordinate(10, 20), Coordinate(70, 50) );
+  std::cout << "  Rooms in the path (should be 91): " << path.size()
+            << std::endl
+            << "  Rooms expanded (should be 90): " << p.ExpandedCount()
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  std::cout << "Finding a path to a Room outside the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    p.Path( l, Coordinate(0, 0), Coordinate(3, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Finding a path from a Room outside the Labyrinth "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    p.Path( l, Coordinate(0, 3), Coordinate(0, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the RandomGenerator class implementation.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "../include/random_generator.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING RANDOM_GENERATOR.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Creating two RandomGenerators with seed 2015 and one with "
+            << "seed 2016." << std::endl;
+  RandomGenerator r_1( 2015 );
+  RandomGenerator r_2( 2015 );
+  RandomGenerator r_other( 2016 );
+  bool same = true;
+  bool other_same = true;
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    const uint64_t n = r_1.Next();
+    same = same && ( n == r_2.Next() );
+    other_same = other_same && ( n == r_other.Next() );
+  }
+  std::cout << "  The same seed gives the same numbers (should be 1): "
+            << same << std::endl
+            << "  Another seed gives the same numbers (should be 0): "
+            << other_same << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING BELOW(), BIT(), AND REAL():"
+            << std::endl << std::endl;
+
+  RandomGenerator r( 7 );
+  size_t counts[6] = { 0, 0, 0, 0, 0, 0 };
+  bool below_in_range = true;
+  for( size_t i = 0; i < 60000; ++i )
+  {
+    const uint64_t n = r.Below( 6 );
+    below_in_range = below_in_range && ( n < 6 );
+    counts[n < 6 ? n : 0]++;
+  }
+  std::cout << "Rolling a die 60000 times:" << std::endl
+            << "  Every roll is below 6 (should be 1): " << below_in_range
+            << std::endl
+            << "  Every face comes up 9000 to 11000 times (should be 1): "
+            << std::all_of( counts, counts + 6, []( const size_t c )
+                            { return c > 9000 && c < 11000; } )
+            << std::endl;
+
+  size_t ones = 0;
+  bool real_in_range = true;
+  for( size_t i = 0; i < 10000; ++i )
+  {
+    ones += r.Bit();
+    const double d = r.Real();
+    real_in_range = real_in_range && d >= 0.0 && d < 1.0;
+  }
+  std::cout << "  10000 bits have 4800 to 5200 ones (should be 1): "
+            << ( ones > 4800 && ones < 5200 ) << std::endl
+            << "  10000 reals are in [0, 1) (should be 1): "
+            << real_in_range << std::endl
+            << "  Below(1) (should be 0): " << r.Below( 1 ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING STREAMS:"
+            << std::endl << std::endl;
+
+  const RandomGenerator root( 42 );
+  RandomGenerator s_0 = root.Stream( 0 );
+  RandomGenerator s_0_again = root.Stream( 0 );
+  RandomGenerator s_1 = root.Stream( 1 );
+  const uint64_t first = s_0.Next();
+  std::cout << "  Stream 0 is reproducible (should be 1): "
+            << ( first == s_0_again.Next() ) << std::endl
+            << "  Streams 0 and 1 differ (should be 1): "
+            << ( first != s_1.Next() ) << std::endl;
+
+  RandomGenerator splitter( 42 );
+  RandomGenerator split_1 = splitter.Split();
+  RandomGenerator split_2 = splitter.Split();
+  std::cout << "  Two Split() generators differ (should be 1): "
+            << ( split_1.Next() != split_2.Next() ) << std::endl;
+
+  RandomGenerator jumped( 42 );
+  RandomGenerator not_jumped( 42 );
+  jumped.Jump();
+  std::cout << "  Jump() changes the sequence (should be 1): "
+            << ( jumped.Next() != not_jumped.Next() ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING USE WITH THE STANDARD LIBRARY:"
+            << std::endl << std::endl;
+
+  std::vector<int> v( 10 );
+  std::iota( v.begin(), v.end(), 0 );
+  RandomGenerator shuffler( 3 );
+  std::shuffle( v.begin(), v.end(), shuffler );
+  std::cout << "Shuffling 0 to 9:" << std::endl << " ";
+  for( const int i : v )
+  {
+    std::cout << " " << i;
+  }
+  std::sort( v.begin(), v.end() );
+  std::cout << std::endl
+            << "  Still holds 0 to 9 (should be 1): "
+            << ( v == std::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 } )
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the GameSession class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/game_session.hpp"
+
+#include "test_level.hpp"
+
+namespace
+{
+
+// This local function returns true if the GameSession is in the given
+// Room with the given bullets and lives, and false otherwise.
+bool IsAt( const GameSession& s,
+           const Coordinate rm,
+           const uint32_t bullets,
+           const uint32_t lives );
+
+// This local function returns true if the GameSession is in the given
+// Room with the given bullets and lives, and false otherwise.
+bool IsAt( const GameSession& s,
+           const Coordinate rm,
+           const uint32_t bullets,
+           const uint32_t lives )
+{
+  return s.Position() == rm && s.Bullets() == bullets && s.Lives() == lives;
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING GAME_SESSION.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Winning a game with one bullet:" << std::endl;
+  Labyrinth l_win( 4, 2 );
+  BuildLevel( l_win );
+  GameSession s( l_win );
+  std::cout << "  Starts in (0, 0) with 1 bullet and 2 lives (should be 1): "
+            << IsAt( s, Coordinate(0, 0), 1, 2 ) << std::endl;
+  SessionStatus status = s.Move( Direction::kNorth );
+  std::cout << "  Moving north into a Wall (should be 1): "
+            << ( status == SessionStatus::kWall ) << std::endl;
+  status = s.Move( Direction::kNone );
+  std::cout << "  Moving nowhere (should be 1): "
+            << ( status == SessionStatus::kInvalidDirection ) << std::endl;
+  status = s.Shoot();
+  std::cout << "  Shooting without eyes (should be 1): "
+            << ( status == SessionStatus::kNoEncounter ) << std::endl;
+
+  s.Move( Direction::kEast );
+  std::cout << "  Bullet taken in (1, 0) (should be 1): "
+            << ( IsAt(s, Coordinate(1, 0), 2, 2) &&
+                 l_win.ItemAt(Coordinate(1, 0)) == Item::kNone )
+            << std::endl;
+
+  s.Move( Direction::kEast );
+  std::cout << "  Eyes in (2, 0) (should be 1): "
+            << ( s.State() == SessionState::kEncounter ) << std::endl;
+  status = s.Move( Direction::kEast );
+  std::cout << "  Moving during the encounter (should be 1): "
+            << ( status == SessionStatus::kNotExploring ) << std::endl;
+  status = s.Shoot();
+  std::cout << "  Shooting the Mirror (should be 1): "
+            << ( status == SessionStatus::kOk &&
+                 s.State() == SessionState::kExploring &&
+                 s.Bullets() == 1 &&
+                 l_win.GetInhabitant(Coordinate(2, 0)) ==
+                   Inhabitant::kMirrorCracked ) << std::endl;
+
+  s.Move( Direction::kEast );
+  status = s.Move( Direction::kEast );
+  std::cout << "  Leaving without the Treasure (should be 1): "
+            << ( status == SessionStatus::kNoTreasure &&
+                 s.State() == SessionState::kExploring ) << std::endl;
+
+  s.Move( Direction::kSouth );
+  std::cout << "  Treasure taken in (3, 1) (should be 1): "
+            << ( s.HasTreasure() &&
+                 l_win.ItemAt(Coordinate(3, 1)) == Item::kTreasureGone )
+            << std::endl;
+
+  s.Move( Direction::kWest );
+  status = s.Shoot();
+  std::cout << "  Shooting the Minotaur in (2, 1) (should be 1): "
+            << ( status == SessionStatus::kOk && s.Bullets() == 0 &&
+                 l_win.GetInhabitant(Coordinate(2, 1)) ==
+                   Inhabitant::kMinotaurDead ) << std::endl;
+
+  s.Move( Direction::kEast );
+  s.Move( Direction::kNorth );
+  status = s.Move( Direction::kEast );
+  std::cout << "  Leaving with the Treasure (should be 1): "
+            << ( status == SessionStatus::kOk &&
+                 s.State() == SessionState::kWon ) << std::endl;
+  status = s.Move( Direction::kWest );
+  std::cout << "  Moving after winning (should be 1): "
+            << ( status == SessionStatus::kNotExploring ) << std::endl
+            << "  Steps taken (should be 7): " << s.Steps() << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING LIVES:"
+            << std::endl << std::endl;
+
+  std::cout << "Losing a game without bullets:" << std::endl;
+  Labyrinth l_lose( 4, 2 );
+  BuildLevel( l_lose );
+  GameSession s_lose( l_lose, 0 );
+  s_lose.Move( Direction::kSouth );
+  s_lose.Move( Direction::kEast );
+  s_lose.Move( Direction::kEast );
+  status = s_lose.Shoot();
+  std::cout << "  Shooting without bullets (should be 1): "
+            << ( status == SessionStatus::kNoBullets &&
+                 s_lose.State() == SessionState::kEncounter ) << std::endl;
+  status = s_lose.HoldFire();
+  std::cout << "  Holding fire at the Minotaur (should be 1): "
+            << ( status == SessionStatus::kOk ) << std::endl
+            << "  Respawned in (0, 1) with 1 life (should be 1): "
+            << ( IsAt(s_lose, Coordinate(0, 1), 0, 1) &&
+                 s_lose.State() == SessionState::kExploring ) << std::endl;
+  s_lose.Move( Direction::kEast );
+  s_lose.Move( Direction::kEast );
+  s_lose.HoldFire();
+  std::cout << "  Lost after the second life (should be 1): "
+            << ( s_lose.State() == SessionState::kLost &&
+                 s_lose.Lives() == 0 ) << std::endl;
+  status = s_lose.HoldFire();
+  std::cout << "  Holding fire after losing (should be 1): "
+            << ( status == SessionStatus::kNoEncounter ) << std::endl
+            << std::endl;
+
+  std::cout << "Dying with the Treasure:" << std::endl;
+  Labyrinth l_drop( 4, 2 );
+  BuildLevel( l_drop );
+  GameSession s_drop( l_drop );
+  s_drop.Move( Direction::kEast );
+  s_drop.Move( Direction::kEast );
+  status = s_drop.HoldFire();
+  std::cout << "  Holding fire at the Mirror (should be 1): "
+            << ( status == SessionStatus::kOk &&
+                 s_drop.State() == SessionState::kExploring &&
+                 l_drop.GetInhabitant(Coordinate(2, 0)) ==
+                   Inhabitant::kMirror ) << std::endl;
+  s_drop.Move( Direction::kEast );
+  s_drop.Move( Direction::kSouth );
+  s_drop.Move( Direction::kWest );
+  s_drop.HoldFire();
+  std::cout << "  Treasure dropped in (2, 1) (should be 1): "
+            << ( !s_drop.HasTreasure() &&
+                 l_drop.ItemAt(Coordinate(2, 1)) == Item::kTreasure )
+            << std::endl
+            << "  Respawned in (0, 1) with 3 bullets (should be 1): "
+            << IsAt( s_drop, Coordinate(0, 1), 3, 1 ) << std::endl;
+  s_drop.Move( Direction::kEast );
+  s_drop.Move( Direction::kEast );
+  s_drop.Shoot();
+  std::cout << "  Treasure taken back after shooting (should be 1): "
+            << ( s_drop.HasTreasure() && s_drop.Bullets() == 2 ) << std::endl;
+  s_drop.Restart();
+  std::cout << "  Restarted in (0, 0) (should be 1): "
+            << ( IsAt(s_drop, Coordinate(0, 0), 1, 2) &&
+                 !s_drop.HasTreasure() && s_drop.Steps() == 0 ) << std::endl
+            << std::endl;
+
+  std::cout << "Dying with the Treasure in a Room with a bullet:"
+            << std::endl;
+  Labyrinth l_full( 4, 2 );
+  BuildLevel( l_full );
+  l_full.SetItem( Coordinate(2, 1), Item::kBullet );
+  GameSession s_full( l_full, 0 );
+  s_full.Move( Direction::kEast );
+  s_full.Move( Direction::kEast );
+  s_full.Shoot();
+  s_full.Move( Direction::kEast );
+  s_full.Move( Direction::kSouth );
+  s_full.Move( Direction::kWest );
+  std::cout << "  Treasure held with 0 bullets (should be 1): "
+            << ( s_full.HasTreasure() && s_full.Bullets() == 0 &&
+                 s_full.State() == SessionState::kEncounter ) << std::endl;
+  s_full.HoldFire();
+  std::cout << "  Treasure dropped in (2, 1) (should be 1): "
+            << ( !s_full.HasTreasure() &&
+                 l_full.ItemAt(Coordinate(2, 1)) == Item::kTreasure )
+            << std::endl
+            << "  Bullet taken before the drop (should be 1): "
+            << IsAt( s_full, Coordinate(0, 1), 1, 1 ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,196 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the BatchSimulator class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/simulation_report.hpp"
+#include "../include/batch_simulator.hpp"
+
+#include "test_level.hpp"
+
+namespace
+{
+
+// This local function returns true if the two reports count the same
+// games, and false otherwise.
+bool SameGames( const SimulationReport& r_1, const SimulationReport& r_2 );
+
+// This local function returns true if the two reports count the same
+// games, and false otherwise.
+bool SameGames( const SimulationReport& r_1, const SimulationReport& r_2 )
+{
+  if( r_1.games != r_2.games || r_1.won != r_2.won ||
+      r_1.lost != r_2.lost || r_1.abandoned != r_2.abandoned ||
+      r_1.actions != r_2.actions || r_1.bullets_used != r_2.bullets_used ||
+      r_1.deaths != r_2.deaths ||
+      r_1.death_rooms.size() != r_2.death_rooms.size() )
+  {
+    return false;
+  }
+  for( size_t i = 0; i < r_1.death_rooms.size(); ++i )
+  {
+    if( !( r_1.death_rooms[i].room == r_2.death_rooms[i].room ) ||
+        r_1.death_rooms[i].deaths != r_2.death_rooms[i].deaths )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING BATCH_SIMULATOR.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Shortest paths through a 4 x 2 level with a Mirror:"
+            << std::endl;
+  Labyrinth l_mirror( 4, 2 );
+  BuildLevel( l_mirror, Inhabitant::kMirror, true );
+  BatchSimulator shortest( PlayerPolicy::kShortestPath, 1, 4 );
+  const SimulationReport& r_mirror = shortest.Run( l_mirror, 1000 );
+  std::cout << "  Games played (should be 1000): " << r_mirror.games
+            << std::endl
+            << "  Win rate (should be 1): " << r_mirror.WinRate()
+            << std::endl
+            << "  Bullets used per game (should be 1): "
+            << r_mirror.AverageBulletsUsed() << std::endl
+            << "  Actions (should be 7000): " << r_mirror.actions
+            << std::endl
+            << "  Deaths (should be 0): " << r_mirror.deaths << std::endl
+            << std::endl;
+
+  std::cout << "Shortest paths through a 4 x 2 level with two Minotaurs "
+            << "and no bullets:" << std::endl;
+  Labyrinth l_deadly( 4, 2 );
+  BuildLevel( l_deadly, Inhabitant::kMinotaur, false );
+  const SimulationReport& r_deadly = shortest.Run( l_deadly, 1000, 0 );
+  std::cout << "  Games lost (should be 1000): " << r_deadly.lost
+            << std::endl
+            << "  Actions (should be 6000): " << r_deadly.actions
+            << std::endl
+            << "  Deaths (should be 2000): " << r_deadly.deaths << std::endl
+            << "  Rooms with deaths (should be 2): "
+            << r_deadly.death_rooms.size() << std::endl
+            << "  1000 deaths in (2, 0) and in (2, 1) (should be 1): "
+            << ( r_deadly.death_rooms.size() == 2 &&
+                 r_deadly.death_rooms[0].room == Coordinate(2, 0) &&
+                 r_deadly.death_rooms[0].deaths == 1000 &&
+                 r_deadly.death_rooms[1].room == Coordinate(2, 1) &&
+                 r_deadly.death_rooms[1].deaths == 1000 ) << std::endl
+            << std::endl;
+
+  std::cout << "Random walks through a 4 x 2 level with no bullets:"
+            << std::endl;
+  BatchSimulator random_1( PlayerPolicy::kRandomWalk, 2015, 1 );
+  BatchSimulator random_4( PlayerPolicy::kRandomWalk, 2015, 4 );
+  const SimulationReport r_1 = random_1.Run( l_mirror, 5000, 0, 50 );
+  const SimulationReport& r_4 = random_4.Run( l_mirror, 5000, 0, 50 );
+  std::cout << "  Every game counted (should be 1): "
+            << ( r_1.won + r_1.lost + r_1.abandoned == 5000 ) << std::endl
+            << "  Some games won, lost, and abandoned (should be 1): "
+            << ( r_1.won > 0 && r_1.lost > 0 && r_1.abandoned > 0 )
+            << std::endl
+            << "  Threads used (should be 1 and 4): " << r_1.thread_count
+            << " and " << r_4.thread_count << std::endl
+            << "  Same games on 1 and 4 threads (should be 1): "
+            << SameGames( r_1, r_4 ) << std::endl;
+  const SimulationReport& r_again = random_1.Run( l_mirror, 5000, 0, 50 );
+  std::cout << "  Different games from the next run (should be 1): "
+            << !SameGames( r_1, r_again ) << std::endl
+            << std::endl;
+
+  std::cout << "Wall followers through a 70 x 40 maze:" << std::endl;
+  try
+  {
+    Labyrinth l_maze( 70, 40 );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 2015 );
+    g.Generate( l_maze );
+    l_maze.SetExit( Coordinate(0, 39), Direction::kSouth );
+    l_maze.SetItem( Coordinate(35, 20), Item::kTreasure );
+    BatchSimulator follower( PlayerPolicy::kWallFollower, 3, 2 );
+    const SimulationReport& r_maze = follower.Run( l_maze, 100 );
+    std::cout << "  Win rate (should be 1): " << r_maze.WinRate()
+              << std::endl
+              << "  Same actions in every game (should be 1): "
+              << ( r_maze.actions % 100 == 0 ) << std::endl;
+
+    BatchSimulator shortest_maze( PlayerPolicy::kShortestPath, 3, 2 );
+    const SimulationReport& r_shortest = shortest_maze.Run( l_maze, 100 );
+    std::cout << "  Shortest paths take fewer actions (should be 1): "
+              << ( r_shortest.WinRate() == 1 &&
+                   r_shortest.actions < r_maze.actions ) << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  Error: An exception was thrown:" << std::endl
+              << "    " << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  try
+  {
+    BatchSimulator invalid( static_cast<PlayerPolicy>(7), 1 );
+    invalid.Run( l_mirror, 1 );
+    std::cout << "  Error: No exception was thrown for an invalid "
+              << "PlayerPolicy." << std::endl;
+  }
+  catch( const std::invalid_argument& e )
+  {
+    std::cout << "  Invalid PlayerPolicy (should be an error):" << std::endl
+              << "    " << e.what();
+  }
+
+  try
+  {
+    Labyrinth l_empty( 4, 2 );
+    shortest.Run( l_empty, 1 );
+    std::cout << "  Error: No exception was thrown for shortest paths "
+              << "without a Treasure." << std::endl;
+  }
+  catch( const std::logic_error& e )
+  {
+    std::cout << "  Shortest paths without a Treasure (should be an "
+              << "error):" << std::endl
+              << "    " << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the TiledMazeGenerator class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/tiled_maze_generator.hpp"
+
+#include "maze_checks.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING TILED_MAZE_GENERATOR.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Generating a 200 x 75 maze in 64 x 32 tiles (12 tiles, "
+            << "some partial) on 1 thread:" << std::endl;
+  Labyrinth l_1( 200, 75 );
+  TiledMazeGenerator g_1( MazeAlgorithm::kRecursiveBacktracker, 64, 32,
+                          2015, 1 );
+  g_1.Generate( l_1 );
+  std::cout << "  Connections (should be 14999): " << CountConnections(l_1)
+            << std::endl
+            << "  Rooms reachable from (0, 0) (should be 15000): "
+            << CountReachable(l_1) << std::endl << std::endl;
+
+  std::cout << "Generating the same maze on 3 and 16 threads:" << std::endl;
+  Labyrinth l_3( 200, 75 );
+  TiledMazeGenerator g_3( MazeAlgorithm::kRecursiveBacktracker, 64, 32,
+                          2015, 3 );
+  g_3.Generate( l_3 );
+  Labyrinth l_16( 200, 75 );
+  TiledMazeGenerator g_16( MazeAlgorithm::kRecursiveBacktracker, 64, 32,
+                           2015, 16 );
+  g_16.Generate( l_16 );
+  std::cout << "  Threads used (should be 3 and 16): " << g_3.ThreadCount()
+            << " and " << g_16.ThreadCount() << std::endl
+            << "  3 threads give the same maze (should be 1): "
+            << SameWalls(l_1, l_3) << std::endl
+            << "  16 threads give the same maze (should be 1): "
+            << SameWalls(l_1, l_16) << std::endl << std::endl;
+
+  std::cout << "Generating a second maze with the same generator:"
+            << std::endl;
+  Labyrinth l_next( 200, 75 );
+  g_1.Generate( l_next );
+  std::cout << "  Connections (should be 14999): "
+            << CountConnections(l_next) << std::endl
+            << "  Same as the first maze (should be 0): "
+            << SameWalls(l_1, l_next) << std::endl << std::endl;
+
+  std::cout << "Generating 130 x 40 mazes with Wilson's algorithm in "
+            << "64 x 7 tiles:" << std::endl;
+  Labyrinth l_w1( 130, 40 );
+  Labyrinth l_w4( 130, 40 );
+  TiledMazeGenerator( MazeAlgorithm::kWilson, 64, 7, 9, 1 ).Generate( l_w1 );
+  TiledMazeGenerator( MazeAlgorithm::kWilson, 64, 7, 9, 4 ).Generate( l_w4 );
+  std::cout << "  Connections (should be 5199): " << CountConnections(l_w4)
+            << std::endl
+            << "  Rooms reachable from (0, 0) (should be 5200): "
+            << CountReachable(l_w4) << std::endl
+            << "  1 and 4 threads give the same maze (should be 1): "
+            << SameWalls(l_w1, l_w4) << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING INVALID TILES:"
+            << std::endl << std::endl;
+
+  std::cout << "Creating a generator with a tile x size of 50 "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    TiledMazeGenerator g( MazeAlgorithm::kPrim, 50, 50, 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Creating a generator with a tile y size of 0 "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    TiledMazeGenerator g( MazeAlgorithm::kPrim, 64, 0, 0 );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Generating with an invalid algorithm on 4 threads "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    Labyrinth l_invalid( 256, 256 );
+    TiledMazeGenerator g( static_cast<MazeAlgorithm>(9), 64, 64, 0, 4 );
+    g.Generate( l_invalid );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,298 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the LevelTopology and RoomOverlay class
+ * implementations, and GameSessions which share a level.
+ *
+ */
+
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/labyrinth_status.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/level_validator.hpp"
+#include "../include/level_topology.hpp"
+#include "../include/room_overlay.hpp"
+#include "../include/game_session.hpp"
+
+#include "distance_checks.hpp"
+#include "test_level.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LEVEL_TOPOLOGY.CPP AND ROOM_OVERLAY.CPP "
+            << "IMPLEMENTATIONS" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Copying a 4 x 2 level:" << std::endl;
+  Labyrinth l( 4, 2 );
+  BuildLevel( l );
+  const auto topology = std::make_shared<const LevelTopology>( l );
+  std::cout << "  Size 4 x 2 (should be 1): "
+            << ( topology->XSize() == 4 && topology->YSize() == 2 )
+            << std::endl
+            << "  Same spawns and exit (should be 1): "
+            << ( topology->Spawn1() == Coordinate(0, 0) &&
+                 topology->Spawn2() == Coordinate(0, 1) &&
+                 topology->HasExit() &&
+                 topology->ExitRoom() == Coordinate(3, 0) ) << std::endl
+            << "  Exit to the east of (3, 0) (should be 1): "
+            << ( topology->DirectionCheck(Coordinate(3, 0), Direction::kEast)
+                   == RoomBorder::kExit ) << std::endl
+            << "  Wall to the south of (1, 0) (should be 1): "
+            << ( topology->DirectionCheck(Coordinate(1, 0),
+                                          Direction::kSouth) ==
+                   RoomBorder::kWall ) << std::endl
+            << "  Minotaur and Treasure in (2, 1) and (3, 1) (should be 1): "
+            << ( topology->GetInhabitantUnchecked(Coordinate(2, 1)) ==
+                   Inhabitant::kMinotaur &&
+                 topology->ItemAtUnchecked(Coordinate(3, 1)) ==
+                   Item::kTreasure && topology->HasTreasure() ) << std::endl;
+
+  l.SetItem( Coordinate(0, 1), Item::kBullet );
+  std::cout << "  Unchanged by the Labyrinth afterwards (should be 1): "
+            << ( topology->ItemAtUnchecked(Coordinate(0, 1)) == Item::kNone )
+            << std::endl;
+
+  try
+  {
+    topology->DirectionCheck( Coordinate(4, 0), Direction::kNorth );
+    std::cout << "  Error: No exception was thrown for a Room outside "
+              << "the level." << std::endl;
+  }
+  catch( const std::domain_error& e )
+  {
+    std::cout << "  Room outside the level (should be an error):" << std::endl
+              << "    " << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ROOM OVERLAYS:"
+            << std::endl << std::endl;
+
+  std::cout << "Two overlays of the same level:" << std::endl;
+  RoomOverlay overlay_1( topology );
+  RoomOverlay overlay_2( topology );
+  std::cout << "  No Rooms changed (should be 0): "
+            << overlay_1.ChangedRoomCount() << std::endl
+            << "  Minotaur read through (2, 1) (should be 1): "
+            << ( overlay_1.GetInhabitant(Coordinate(2, 1)) ==
+                 Inhabitant::kMinotaur ) << std::endl;
+
+  const LabyrinthStatus attack =
+    overlay_1.AttackEnemyUnchecked( Coordinate(2, 1) );
+  const LabyrinthStatus take =
+    overlay_1.TakeItemUnchecked( Coordinate(3, 1) );
+  std::cout << "  Killing the Minotaur in the first (should be 1): "
+            << ( attack == LabyrinthStatus::kOk &&
+                 overlay_1.GetInhabitant(Coordinate(2, 1)) ==
+                   Inhabitant::kMinotaurDead ) << std::endl
+            << "  Taking the Treasure in the first (should be 1): "
+            << ( take == LabyrinthStatus::kOk &&
+                 overlay_1.ItemAt(Coordinate(3, 1)) == Item::kTreasureGone )
+            << std::endl
+            << "  Rooms changed in the first (should be 2): "
+            << overlay_1.ChangedRoomCount() << std::endl
+            << "  Second unchanged (should be 1): "
+            << ( overlay_2.GetInhabitant(Coordinate(2, 1)) ==
+                   Inhabitant::kMinotaur &&
+                 overlay_2.ItemAt(Coordinate(3, 1)) == Item::kTreasure &&
+                 overlay_2.ChangedRoomCount() == 0 ) << std::endl
+            << "  Topology unchanged (should be 1): "
+            << ( topology->GetInhabitantUnchecked(Coordinate(2, 1)) ==
+                   Inhabitant::kMinotaur &&
+                 topology->ItemAtUnchecked(Coordinate(3, 1)) ==
+                   Item::kTreasure ) << std::endl;
+
+  const LabyrinthStatus second_attack =
+    overlay_1.AttackEnemyUnchecked( Coordinate(2, 1) );
+  const LabyrinthStatus drop_held =
+    overlay_1.TryDropTreasure( Coordinate(0, 0) );
+  const LabyrinthStatus drop_set =
+    overlay_2.TryDropTreasure( Coordinate(0, 0) );
+  const LabyrinthStatus drop_outside =
+    overlay_1.TryDropTreasure( Coordinate(0, 2) );
+  std::cout << "  Killing the dead Minotaur (should be 1): "
+            << ( second_attack == LabyrinthStatus::kNoEnemy ) << std::endl
+            << "  Dropping the held Treasure in (0, 0) (should be 1): "
+            << ( drop_held == LabyrinthStatus::kOk &&
+                 overlay_1.ItemAt(Coordinate(0, 0)) == Item::kTreasure &&
+                 overlay_1.ChangedRoomCount() == 3 ) << std::endl
+            << "  Dropping a second Treasure (should be 1): "
+            << ( drop_set == LabyrinthStatus::kTreasureAlreadySet )
+            << std::endl
+            << "  Dropping outside the level (should be 1): "
+            << ( drop_outside == LabyrinthStatus::kOutOfBounds ) << std::endl;
+
+  overlay_1.Clear();
+  std::cout << "  Cleared (should be 1): "
+            << ( overlay_1.ChangedRoomCount() == 0 &&
+                 overlay_1.GetInhabitant(Coordinate(2, 1)) ==
+                   Inhabitant::kMinotaur &&
+                 overlay_1.ItemAt(Coordinate(0, 0)) == Item::kNone )
+            << std::endl;
+
+  try
+  {
+    overlay_1.ItemAt( Coordinate(0, 2) );
+    std::cout << "  Error: No exception was thrown for a Room outside "
+              << "the level." << std::endl;
+  }
+  catch( const std::domain_error& e )
+  {
+    std::cout << "  Room outside the level (should be an error):" << std::endl
+              << "    " << e.what();
+  }
+
+  try
+  {
+    RoomOverlay overlay_null( nullptr );
+    std::cout << "  Error: No exception was thrown for a null topology."
+              << std::endl;
+  }
+  catch( const std::invalid_argument& e )
+  {
+    std::cout << "  Null topology (should be an error):" << std::endl
+              << "    " << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING SHARED GAMES:"
+            << std::endl << std::endl;
+
+  std::cout << "Two GameSessions on overlays of the same level:"
+            << std::endl;
+  RoomOverlay overlay_win( topology );
+  RoomOverlay overlay_lose( topology );
+  GameSession s_win( overlay_win );
+  GameSession s_lose( overlay_lose, 0 );
+
+  s_win.Move( Direction::kEast );
+  s_win.Move( Direction::kEast );
+  s_win.Shoot();
+  s_win.Move( Direction::kEast );
+  s_win.Move( Direction::kSouth );
+  s_win.Move( Direction::kWest );
+  s_win.Shoot();
+  s_win.Move( Direction::kEast );
+  s_win.Move( Direction::kNorth );
+  const SessionStatus status = s_win.Move( Direction::kEast );
+  std::cout << "  First game won (should be 1): "
+            << ( status == SessionStatus::kOk &&
+                 s_win.State() == SessionState::kWon ) << std::endl;
+
+  s_lose.Move( Direction::kSouth );
+  s_lose.Move( Direction::kEast );
+  s_lose.Move( Direction::kEast );
+  std::cout << "  Minotaur alive in the second (should be 1): "
+            << ( s_lose.State() == SessionState::kEncounter ) << std::endl;
+  s_lose.HoldFire();
+  std::cout << "  Respawned in (0, 1) (should be 1): "
+            << ( s_lose.Position() == Coordinate(0, 1) &&
+                 s_lose.Lives() == 1 ) << std::endl;
+  s_lose.Move( Direction::kEast );
+  s_lose.Move( Direction::kEast );
+  s_lose.HoldFire();
+  std::cout << "  Second game lost (should be 1): "
+            << ( s_lose.State() == SessionState::kLost ) << std::endl
+            << "  Rooms changed by the first game (should be 4): "
+            << overlay_win.ChangedRoomCount() << std::endl
+            << "  Rooms changed by the second game (should be 0): "
+            << overlay_lose.ChangedRoomCount() << std::endl;
+
+  overlay_win.Clear();
+  s_win.Restart();
+  s_win.Move( Direction::kEast );
+  std::cout << "  Bullet taken again after clearing (should be 1): "
+            << ( s_win.Bullets() == 2 ) << std::endl
+            << std::endl;
+
+  std::cout << "Dying with the Treasure in a Room with a bullet:"
+            << std::endl;
+  Labyrinth l_full( 4, 2 );
+  BuildLevel( l_full );
+  l_full.SetItem( Coordinate(2, 1), Item::kBullet );
+  const auto topology_full = std::make_shared<const LevelTopology>( l_full );
+  RoomOverlay overlay_full( topology_full );
+  GameSession s_full( overlay_full, 0 );
+  s_full.Move( Direction::kEast );
+  s_full.Move( Direction::kEast );
+  s_full.Shoot();
+  s_full.Move( Direction::kEast );
+  s_full.Move( Direction::kSouth );
+  s_full.Move( Direction::kWest );
+  s_full.HoldFire();
+  std::cout << "  Treasure dropped in (2, 1) (should be 1): "
+            << ( !s_full.HasTreasure() &&
+                 overlay_full.ItemAt(Coordinate(2, 1)) ==
+                   Item::kTreasure ) << std::endl
+            << "  Bullet taken before the drop (should be 1): "
+            << ( s_full.Position() == Coordinate(0, 1) &&
+                 s_full.Bullets() == 1 ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING THE SHARED ALGORITHMS:"
+            << std::endl << std::endl;
+
+  std::cout << "Copying a 70 x 40 maze:" << std::endl;
+  try
+  {
+    Labyrinth l_maze( 70, 40 );
+    MazeGenerator g( MazeAlgorithm::kKruskal, 2015 );
+    g.Generate( l_maze );
+    l_maze.SetExit( Coordinate(0, 39), Direction::kSouth );
+    l_maze.SetSpawn2( Coordinate(69, 0) );
+    l_maze.SetItem( Coordinate(35, 20), Item::kTreasure );
+    const LevelTopology topology_maze( l_maze );
+    std::cout << "  Rooms at different distances from (35, 20) "
+              << "(should be 0): "
+              << CountDifferentDistances( l_maze, topology_maze,
+                                          Coordinate(35, 20) ) << std::endl;
+    LevelValidator v;
+    std::cout << "  Playable (should be 1): "
+              << v.Validate( topology_maze ).Playable() << std::endl;
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << "  Error: An exception was thrown:" << std::endl
+              << "    " << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,245 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the LevelValidator class implementation.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/labyrinth.hpp"
+#include "../include/maze_generator.hpp"
+#include "../include/random_generator.hpp"
+#include "../include/distance_field.hpp"
+#include "../include/level_report.hpp"
+#include "../include/level_validator.hpp"
+
+namespace
+{
+
+// This local function prints the regions and special Rooms of a report.
+void PrintReport( const LevelReport& report );
+
+// This local function returns the name of a special Room.
+const char* SpecialRoomName( const SpecialRoom s );
+
+// This local function returns the number of regions of the report whose
+// size differs from the number of Rooms reached by a DistanceField from
+// their Room.
+size_t CountWrongRegions( const Labyrinth& l, const LevelReport& report );
+
+// This local function prints the regions and special Rooms of a report.
+void PrintReport( const LevelReport& report )
+{
+  std::cout << "  Regions:";
+  for( const LevelRegion& r : report.regions )
+  {
+    std::cout << " " << r.size << " at (" << r.room.x << ", " << r.room.y
+              << ")";
+  }
+  std::cout << std::endl << "  Missing:";
+  for( const SpecialRoom s : report.missing )
+  {
+    std::cout << " " << SpecialRoomName( s );
+  }
+  std::cout << std::endl << "  Unreachable:";
+  for( const SpecialRoom s : report.unreachable )
+  {
+    std::cout << " " << SpecialRoomName( s );
+  }
+  std::cout << std::endl;
+}
+
+// This local function returns the name of a special Room.
+const char* SpecialRoomName( const SpecialRoom s )
+{
+  switch( s )
+  {
+    case SpecialRoom::kSpawn1:
+      return "spawn 1";
+    case SpecialRoom::kSpawn2:
+      return "spawn 2";
+    case SpecialRoom::kTreasure:
+      return "treasure";
+    case SpecialRoom::kExit:
+      return "exit";
+  }
+  return "";
+}
+
+// This local function returns the number of regions of the report whose
+// size differs from the number of Rooms reached by a DistanceField from
+// their Room.
+size_t CountWrongRegions( const Labyrinth& l, const LevelReport& report )
+{
+  DistanceField f;
+  size_t wrong = 0;
+  size_t total = 0;
+  for( const LevelRegion& r : report.regions )
+  {
+    f.Compute( l, r.room );
+    wrong += f.ReachableCount() != r.size;
+    total += r.size;
+  }
+  return wrong + ( total != l.XSize() * l.YSize() );
+}
+
+}  // Anonymous namespace
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING LEVEL_VALIDATOR.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  // The 3 x 3 Labyrinth used below, of three regions:
+  //   (0, 0) - (1, 0) - (2, 0)
+  //                       |
+  //   (0, 1) - (1, 1) - (2, 1)
+  //
+  //   (0, 2) - (1, 2)   (2, 2)
+  Labyrinth l( 3, 3 );
+  l.ConnectRooms( Coordinate(0, 0), Coordinate(1, 0) );
+  l.ConnectRooms( Coordinate(1, 0), Coordinate(2, 0) );
+  l.ConnectRooms( Coordinate(2, 0), Coordinate(2, 1) );
+  l.ConnectRooms( Coordinate(2, 1), Coordinate(1, 1) );
+  l.ConnectRooms( Coordinate(1, 1), Coordinate(0, 1) );
+  l.ConnectRooms( Coordinate(0, 2), Coordinate(1, 2) );
+  l.SetSpawn2( Coordinate(2, 2) );
+  l.SetItem( Coordinate(1, 2), Item::kTreasure );
+
+  LevelValidator v;
+  std::cout << "Validating a 3 x 3 Labyrinth of three regions with no exit:"
+            << std::endl;
+  const LevelReport& report = v.Validate( l );
+  PrintReport( report );
+  std::cout << "  Regions (should be 3): " << report.regions.size()
+            << std::endl
+            << "  Largest region (should be 6): " << report.regions[0].size
+            << std::endl
+            << "  Isolated Rooms (should be 1): " << report.isolated_rooms
+            << std::endl
+            << "  Missing special Rooms (should be 1): "
+            << report.missing.size() << std::endl
+            << "  Unreachable special Rooms (should be 2): "
+            << report.unreachable.size() << std::endl
+            << "  Playable (should be 0): " << report.Playable() << std::endl
+            << "  (0, 0) is connected to (0, 1) (should be 1): "
+            << v.Connected( Coordinate(0, 0), Coordinate(0, 1) ) << std::endl
+            << "  (0, 1) is connected to (0, 2) (should be 0): "
+            << v.Connected( Coordinate(0, 1), Coordinate(0, 2) ) << std::endl
+            << std::endl;
+
+  std::cout << "Joining the regions and setting the exit:" << std::endl;
+  l.ConnectRooms( Coordinate(0, 1), Coordinate(0, 2) );
+  l.ConnectRooms( Coordinate(1, 2), Coordinate(2, 2) );
+  l.SetExit( Coordinate(2, 2), Direction::kEast );
+  v.Validate( l );
+  PrintReport( report );
+  std::cout << "  Regions (should be 1): " << report.regions.size()
+            << std::endl
+            << "  Isolated Rooms (should be 0): " << report.isolated_rooms
+            << std::endl
+            << "  Playable (should be 1): " << report.Playable() << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING AGAINST DISTANCE FIELDS:"
+            << std::endl << std::endl;
+
+  Labyrinth l_maze( 130, 70 );
+  MazeGenerator g( MazeAlgorithm::kWilson, 2015 );
+  g.Generate( l_maze );
+  v.Validate( l_maze );
+  std::cout << "  Regions of a 130 x 70 maze (should be 1): "
+            << report.regions.size() << std::endl
+            << "  Rooms of its region (should be 9100): "
+            << report.regions[0].size << std::endl;
+
+  RandomGenerator rng( 1 );
+  Labyrinth l_caves( 130, 70 );
+  for( size_t y = 0; y < 70; ++y )
+  {
+    for( size_t x = 0; x < 130; ++x )
+    {
+      if( x + 1 < 130 && rng.Below(2) == 0 )
+      {
+        l_caves.ConnectRooms( Coordinate(x, y), Coordinate(x + 1, y) );
+      }
+      if( y + 1 < 70 && rng.Below(2) == 0 )
+      {
+        l_caves.ConnectRooms( Coordinate(x, y), Coordinate(x, y + 1) );
+      }
+    }
+  }
+  v.Validate( l_caves );
+  std::cout << "  Regions of 130 x 70 caves (should be more than 1): "
+            << report.regions.size() << std::endl
+            << "  Wrong regions (should be 0): "
+            << CountWrongRegions( l_caves, report ) << std::endl;
+
+  Labyrinth l_closed( 20, 10 );
+  v.Validate( l_closed );
+  std::cout << "  Isolated Rooms of a closed 20 x 10 Labyrinth after reuse "
+            << "(should be 200): " << report.isolated_rooms << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING ERRORS:"
+            << std::endl << std::endl;
+
+  std::cout << "Checking Rooms before validating (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    LevelValidator v_new;
+    v_new.Connected( Coordinate(0, 0), Coordinate(0, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+  std::cout << "Checking a Room outside the Labyrinth (An error should be "
+            << "thrown):" << std::endl;
+  try
+  {
+    v.Connected( Coordinate(0, 0), Coordinate(20, 0) );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}
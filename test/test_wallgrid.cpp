@@ -0,0 +1,132 @@
+/*
+ *
+ * Author: Jeffrey Leung
+ * Last edited: 2026-10-18
+ *
+ * This C++ file tests the WallGrid class implementation.
+ *
+ */
+
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+#include "../include/room_properties.hpp"
+#include "../include/coordinate.hpp"
+#include "../include/wall_grid.hpp"
+
+int main()
+{
+  std::cout << std::endl
+            << "TESTING WALL_GRID.CPP IMPLEMENTATION" << std::endl
+            << "________________________________________________" << std::endl
+            << std::endl;
+
+
+
+  std::cout << "Creating a WallGrid with:" << std::endl
+            << "  x size = 70" << std::endl
+            << "  y size = 3" << std::endl;
+
+  WallGrid w( 70, 3 );
+  std::cout << "Completed." << std::endl
+            << "  Words per row (should be 2): " << w.WordsPerRow()
+            << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING SETWALL() AND ISWALL():"
+            << std::endl << std::endl;
+
+  const Coordinate c_63_1(63, 1);
+  const Coordinate c_64_1(64, 1);
+  const Coordinate c_64_2(64, 2);
+
+  std::cout << "Removing the Wall east of (63, 1)." << std::endl;
+  w.SetWall( c_63_1, Direction::kEast, false );
+  std::cout << "  East of (63, 1) is a Wall (should be 0): "
+            << w.IsWall( c_63_1, Direction::kEast ) << std::endl
+            << "  West of (64, 1) is a Wall (should be 0): "
+            << w.IsWall( c_64_1, Direction::kWest ) << std::endl
+            << std::endl;
+
+  std::cout << "Removing the Wall north of (64, 2)." << std::endl;
+  w.SetWall( c_64_2, Direction::kNorth, false );
+  std::cout << "  North of (64, 2) is a Wall (should be 0): "
+            << w.IsWall( c_64_2, Direction::kNorth ) << std::endl
+            << "  South of (64, 1) is a Wall (should be 0): "
+            << w.IsWall( c_64_1, Direction::kSouth ) << std::endl
+            << "  East of (64, 1) is a Wall (should be 1): "
+            << w.IsWall( c_64_1, Direction::kEast ) << std::endl
+            << std::endl;
+
+  std::cout << "Words of row 1 of the east bitmap (bit 63 of word 0 "
+            << "should be clear):" << std::endl
+            << "  " << std::hex << w.EastRow(1)[0] << " "
+            << w.EastRow(1)[1] << std::dec << std::endl << std::endl;
+
+  std::cout << "Restoring the Wall west of (64, 1)." << std::endl;
+  w.SetWall( c_64_1, Direction::kWest, true );
+  std::cout << "  East of (63, 1) is a Wall (should be 1): "
+            << w.IsWall( c_63_1, Direction::kEast ) << std::endl
+            << std::endl;
+
+
+
+  std::cout << "________________________________________________"
+            << std::endl << std::endl
+            << "TESTING OUTER WALLS:"
+            << std::endl << std::endl;
+
+  const Coordinate c_0_0(0, 0);
+  const Coordinate c_69_2(69, 2);
+
+  std::cout << "  North of (0, 0) is a Wall (should be 1): "
+            << w.IsWall( c_0_0, Direction::kNorth ) << std::endl
+            << "  West of (0, 0) is a Wall (should be 1): "
+            << w.IsWall( c_0_0, Direction::kWest ) << std::endl
+            << "  East of (69, 2) is a Wall (should be 1): "
+            << w.IsWall( c_69_2, Direction::kEast ) << std::endl
+            << "  South of (69, 2) is a Wall (should be 1): "
+            << w.IsWall( c_69_2, Direction::kSouth ) << std::endl
+            << std::endl;
+
+  std::cout << "Removing the Wall east of (69, 2) "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    w.SetWall( c_69_2, Direction::kEast, false );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+  std::cout << "Checking the Wall in direction kNone "
+            << "(An error should be thrown):" << std::endl;
+  try
+  {
+    w.IsWall( c_0_0, Direction::kNone );
+  }
+  catch( const std::exception& e )
+  {
+    std::cout << e.what();
+  }
+  std::cout << "Done." << std::endl << std::endl;
+
+
+
+  std::cout << "________________________________________________" << std::endl;
+  std::cout << std::endl;
+  std::cout << "All tests completed." << std::endl;
+  std::cout << std::endl;
+  std::cout << "Press enter to exit.";
+  getchar();
+  std::cout << std::endl;
+
+  return 0;
+}